@@ -0,0 +1,78 @@
+/**
+* A minimal harness for the benchmarks of the project
+*
+* Every benchmark runs its body in batches until a batch takes long enough to be measured with the
+* steady clock, and reports the median time per operation of several batches, so a single slow one
+* (a context switch, a page fault) doesn't skew the result.
+*/
+
+#pragma once
+
+import std;
+import formatter;
+import print_utils;
+
+namespace bench {
+    inline constexpr std::size_t batches = 7;
+    inline constexpr std::chrono::milliseconds min_batch_time {20};
+
+    /// Keeps the compiler from removing the computation of `value` as unused
+    template <typename T>
+    inline void keep(const T& value) noexcept {
+        asm volatile("" : : "r"(std::addressof(value)) : "memory");
+    }
+
+    /// @return `value`, which the compiler can't assume to be a constant anymore
+    template <typename T>
+    [[nodiscard]] inline T opaque(T value) noexcept {
+        asm volatile("" : "+m"(value));
+        return value;
+    }
+
+    /// Prints the title of a group of benchmarks
+    inline void section(std::string_view title) {
+        zero::fmt::println("\n{}", title);
+    }
+
+    /**
+     * Measures `body`, which performs `operations` operations on every call, and prints the median time of one of them
+     * @return the nanoseconds per operation
+     */
+    template <typename Body>
+    double run(std::string_view name, std::size_t operations, Body&& body) {
+        using clock = std::chrono::steady_clock;
+        std::size_t calls = 1;
+        for (;;) {
+            const auto start = clock::now();
+            for (std::size_t call = 0; call < calls; ++call)
+                body();
+            if (clock::now() - start >= min_batch_time)
+                break;
+            calls *= 2;
+        }
+
+        std::array<double, batches> times {};
+        for (auto& time : times) {
+            const auto start = clock::now();
+            for (std::size_t call = 0; call < calls; ++call)
+                body();
+            const std::chrono::duration<double, std::nano> elapsed = clock::now() - start;
+            time = elapsed.count() / static_cast<double>(calls * operations);
+        }
+        std::ranges::sort(times);
+        const double median = times[batches / 2];
+        zero::fmt::println("  {:<56} {:>12.2f} ns/op", name, median);
+        return median;
+    }
+
+    /// Prints the percentiles of a set of latencies, in nanoseconds
+    inline void percentiles(std::string_view name, std::vector<std::int64_t>& latencies) {
+        std::ranges::sort(latencies);
+        const auto at = [&](double percentile) {
+            const auto rank = static_cast<std::size_t>(percentile / 100 * static_cast<double>(latencies.size() - 1));
+            return latencies[rank];
+        };
+        zero::fmt::println("  {:<56} p50 {} ns, p99 {} ns, p99.9 {} ns, max {} ns",
+            name, at(50), at(99), at(99.9), latencies.back());
+    }
+}
@@ -0,0 +1,38 @@
+/**
+* Benchmarks of the arbitrary-precision integers of the math library
+*/
+
+#include "bench.h"
+
+import math;
+
+using zero::math::BigInt;
+
+namespace {
+    /// A number of `limbs` limbs of 64 bits, with pseudo random digits
+    BigInt number(std::size_t limbs, std::uint64_t seed) {
+        std::string digits(limbs * 19, '0');
+        for (auto& digit : digits) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            digit = static_cast<char>('0' + (seed >> 33) % 10);
+        }
+        digits.front() = '9';
+        return BigInt {digits};
+    }
+}
+
+void big_int_benchmarks() {
+    bench::section("BigInt");
+    for (const std::size_t limbs : std::to_array<std::size_t>({4, 16, 31, 64, 256, 1024})) {
+        const BigInt lhs = number(limbs, 1);
+        const BigInt rhs = number(limbs, 2);
+        bench::run(zero::fmt::formatter("multiplication of {} limbs", limbs), 1, [&] { bench::keep(lhs * rhs); });
+    }
+    for (const std::size_t limbs : std::to_array<std::size_t>({4, 64, 512})) {
+        const BigInt dividend = number(2 * limbs, 3);
+        const BigInt divisor = number(limbs, 4);
+        bench::run(zero::fmt::formatter("division of {} by {} limbs", 2 * limbs, limbs), 1, [&] { bench::keep(dividend / divisor); });
+    }
+    const BigInt big = number(256, 5);
+    bench::run("to_string of 256 limbs", 1, [&] { bench::keep(big.to_string()); });
+}
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""
+Generates a translation unit that declares many units and combines every one of them with others of the same and of
+other dimensions, so the compile time of the dimensional analysis of the quantities can be measured:
+
+    python3 generate_units.py 500 > units_500.cpp
+    time clang++-15 -std=c++2b -fsyntax-only <the flags and the prebuilt modules of the bench config> units_500.cpp
+
+It's not part of the benchmarks executable, it's only compiled on demand.
+"""
+
+import sys
+
+PREFIXES = [
+    'pico', 'nano', 'micro', 'milli', 'centi', 'deci', 'root', 'deca', 'hecto', 'kilo', 'mega', 'giga', 'tera',
+]
+TIMES = ['second', 'minute', 'hour', 'day']
+
+# The dimensions of the generated units, with the way of declaring a unit of them from a prefix and a time ratio
+KINDS = [
+    lambda prefix, time: f'public mass<>, public base_unit<{prefix}, g>',
+    lambda prefix, time: f'public length<>, public base_unit<{prefix}, m>',
+    lambda prefix, time: f'public time<>, public base_unit<{time}, s>',
+    lambda prefix, time: f'public derived_unit<speed, base_unit<{prefix}, m>, base_unit<{time}, s>>',
+    lambda prefix, time: f'public derived_unit<force, base_unit<{prefix}, g>, base_unit<root, m>, base_unit<{time}, s>>',
+]
+
+
+def generate(count: int) -> str:
+    kinds = len(KINDS)
+    lines = [
+        f'// Generated by generate_units.py with {count} units, don\'t edit it by hand',
+        '',
+        'import std;',
+        'import physics;',
+        '',
+        'using namespace zero::physics;',
+        '',
+        'namespace generated {',
+    ]
+    for i in range(count):
+        declaration = KINDS[i % kinds](PREFIXES[i // kinds % len(PREFIXES)], TIMES[i // kinds % len(TIMES)])
+        lines.append(f'    struct U{i}: {declaration} {{}};')
+    lines += ['}', '', 'using namespace generated;', '']
+
+    # Every unit is compared with the previous one, of another dimension, and added to a previous one of its own
+    for i in range(kinds, count):
+        lines.append(f'static_assert(CommonDimension<U{i}, U{i - kinds}> && !CommonDimension<U{i}, U{i - 1}>);')
+    lines += ['', 'double combine() {', '    double total = 0;']
+    for i in range(kinds, count):
+        lines.append(f'    total += (quantity<U{i}> {{1.}} + quantity<U{i - kinds}> {{1.}}).amount;')
+    lines += ['    return total;', '}', '', 'int main() {', '    return combine() > 0 ? 0 : 1;', '}', '']
+    return '\n'.join(lines)
+
+
+if __name__ == '__main__':
+    sys.stdout.write(generate(int(sys.argv[1]) if len(sys.argv) > 1 else 500))
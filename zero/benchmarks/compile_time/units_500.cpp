@@ -0,0 +1,1511 @@
+// Generated by generate_units.py with 500 units, don't edit it by hand
+
+import std;
+import physics;
+
+using namespace zero::physics;
+
+namespace generated {
+    struct U0: public mass<>, public base_unit<pico, g> {};
+    struct U1: public length<>, public base_unit<pico, m> {};
+    struct U2: public time<>, public base_unit<second, s> {};
+    struct U3: public derived_unit<speed, base_unit<pico, m>, base_unit<second, s>> {};
+    struct U4: public derived_unit<force, base_unit<pico, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U5: public mass<>, public base_unit<nano, g> {};
+    struct U6: public length<>, public base_unit<nano, m> {};
+    struct U7: public time<>, public base_unit<minute, s> {};
+    struct U8: public derived_unit<speed, base_unit<nano, m>, base_unit<minute, s>> {};
+    struct U9: public derived_unit<force, base_unit<nano, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U10: public mass<>, public base_unit<micro, g> {};
+    struct U11: public length<>, public base_unit<micro, m> {};
+    struct U12: public time<>, public base_unit<hour, s> {};
+    struct U13: public derived_unit<speed, base_unit<micro, m>, base_unit<hour, s>> {};
+    struct U14: public derived_unit<force, base_unit<micro, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U15: public mass<>, public base_unit<milli, g> {};
+    struct U16: public length<>, public base_unit<milli, m> {};
+    struct U17: public time<>, public base_unit<day, s> {};
+    struct U18: public derived_unit<speed, base_unit<milli, m>, base_unit<day, s>> {};
+    struct U19: public derived_unit<force, base_unit<milli, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U20: public mass<>, public base_unit<centi, g> {};
+    struct U21: public length<>, public base_unit<centi, m> {};
+    struct U22: public time<>, public base_unit<second, s> {};
+    struct U23: public derived_unit<speed, base_unit<centi, m>, base_unit<second, s>> {};
+    struct U24: public derived_unit<force, base_unit<centi, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U25: public mass<>, public base_unit<deci, g> {};
+    struct U26: public length<>, public base_unit<deci, m> {};
+    struct U27: public time<>, public base_unit<minute, s> {};
+    struct U28: public derived_unit<speed, base_unit<deci, m>, base_unit<minute, s>> {};
+    struct U29: public derived_unit<force, base_unit<deci, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U30: public mass<>, public base_unit<root, g> {};
+    struct U31: public length<>, public base_unit<root, m> {};
+    struct U32: public time<>, public base_unit<hour, s> {};
+    struct U33: public derived_unit<speed, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U34: public derived_unit<force, base_unit<root, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U35: public mass<>, public base_unit<deca, g> {};
+    struct U36: public length<>, public base_unit<deca, m> {};
+    struct U37: public time<>, public base_unit<day, s> {};
+    struct U38: public derived_unit<speed, base_unit<deca, m>, base_unit<day, s>> {};
+    struct U39: public derived_unit<force, base_unit<deca, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U40: public mass<>, public base_unit<hecto, g> {};
+    struct U41: public length<>, public base_unit<hecto, m> {};
+    struct U42: public time<>, public base_unit<second, s> {};
+    struct U43: public derived_unit<speed, base_unit<hecto, m>, base_unit<second, s>> {};
+    struct U44: public derived_unit<force, base_unit<hecto, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U45: public mass<>, public base_unit<kilo, g> {};
+    struct U46: public length<>, public base_unit<kilo, m> {};
+    struct U47: public time<>, public base_unit<minute, s> {};
+    struct U48: public derived_unit<speed, base_unit<kilo, m>, base_unit<minute, s>> {};
+    struct U49: public derived_unit<force, base_unit<kilo, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U50: public mass<>, public base_unit<mega, g> {};
+    struct U51: public length<>, public base_unit<mega, m> {};
+    struct U52: public time<>, public base_unit<hour, s> {};
+    struct U53: public derived_unit<speed, base_unit<mega, m>, base_unit<hour, s>> {};
+    struct U54: public derived_unit<force, base_unit<mega, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U55: public mass<>, public base_unit<giga, g> {};
+    struct U56: public length<>, public base_unit<giga, m> {};
+    struct U57: public time<>, public base_unit<day, s> {};
+    struct U58: public derived_unit<speed, base_unit<giga, m>, base_unit<day, s>> {};
+    struct U59: public derived_unit<force, base_unit<giga, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U60: public mass<>, public base_unit<tera, g> {};
+    struct U61: public length<>, public base_unit<tera, m> {};
+    struct U62: public time<>, public base_unit<second, s> {};
+    struct U63: public derived_unit<speed, base_unit<tera, m>, base_unit<second, s>> {};
+    struct U64: public derived_unit<force, base_unit<tera, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U65: public mass<>, public base_unit<pico, g> {};
+    struct U66: public length<>, public base_unit<pico, m> {};
+    struct U67: public time<>, public base_unit<minute, s> {};
+    struct U68: public derived_unit<speed, base_unit<pico, m>, base_unit<minute, s>> {};
+    struct U69: public derived_unit<force, base_unit<pico, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U70: public mass<>, public base_unit<nano, g> {};
+    struct U71: public length<>, public base_unit<nano, m> {};
+    struct U72: public time<>, public base_unit<hour, s> {};
+    struct U73: public derived_unit<speed, base_unit<nano, m>, base_unit<hour, s>> {};
+    struct U74: public derived_unit<force, base_unit<nano, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U75: public mass<>, public base_unit<micro, g> {};
+    struct U76: public length<>, public base_unit<micro, m> {};
+    struct U77: public time<>, public base_unit<day, s> {};
+    struct U78: public derived_unit<speed, base_unit<micro, m>, base_unit<day, s>> {};
+    struct U79: public derived_unit<force, base_unit<micro, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U80: public mass<>, public base_unit<milli, g> {};
+    struct U81: public length<>, public base_unit<milli, m> {};
+    struct U82: public time<>, public base_unit<second, s> {};
+    struct U83: public derived_unit<speed, base_unit<milli, m>, base_unit<second, s>> {};
+    struct U84: public derived_unit<force, base_unit<milli, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U85: public mass<>, public base_unit<centi, g> {};
+    struct U86: public length<>, public base_unit<centi, m> {};
+    struct U87: public time<>, public base_unit<minute, s> {};
+    struct U88: public derived_unit<speed, base_unit<centi, m>, base_unit<minute, s>> {};
+    struct U89: public derived_unit<force, base_unit<centi, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U90: public mass<>, public base_unit<deci, g> {};
+    struct U91: public length<>, public base_unit<deci, m> {};
+    struct U92: public time<>, public base_unit<hour, s> {};
+    struct U93: public derived_unit<speed, base_unit<deci, m>, base_unit<hour, s>> {};
+    struct U94: public derived_unit<force, base_unit<deci, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U95: public mass<>, public base_unit<root, g> {};
+    struct U96: public length<>, public base_unit<root, m> {};
+    struct U97: public time<>, public base_unit<day, s> {};
+    struct U98: public derived_unit<speed, base_unit<root, m>, base_unit<day, s>> {};
+    struct U99: public derived_unit<force, base_unit<root, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U100: public mass<>, public base_unit<deca, g> {};
+    struct U101: public length<>, public base_unit<deca, m> {};
+    struct U102: public time<>, public base_unit<second, s> {};
+    struct U103: public derived_unit<speed, base_unit<deca, m>, base_unit<second, s>> {};
+    struct U104: public derived_unit<force, base_unit<deca, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U105: public mass<>, public base_unit<hecto, g> {};
+    struct U106: public length<>, public base_unit<hecto, m> {};
+    struct U107: public time<>, public base_unit<minute, s> {};
+    struct U108: public derived_unit<speed, base_unit<hecto, m>, base_unit<minute, s>> {};
+    struct U109: public derived_unit<force, base_unit<hecto, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U110: public mass<>, public base_unit<kilo, g> {};
+    struct U111: public length<>, public base_unit<kilo, m> {};
+    struct U112: public time<>, public base_unit<hour, s> {};
+    struct U113: public derived_unit<speed, base_unit<kilo, m>, base_unit<hour, s>> {};
+    struct U114: public derived_unit<force, base_unit<kilo, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U115: public mass<>, public base_unit<mega, g> {};
+    struct U116: public length<>, public base_unit<mega, m> {};
+    struct U117: public time<>, public base_unit<day, s> {};
+    struct U118: public derived_unit<speed, base_unit<mega, m>, base_unit<day, s>> {};
+    struct U119: public derived_unit<force, base_unit<mega, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U120: public mass<>, public base_unit<giga, g> {};
+    struct U121: public length<>, public base_unit<giga, m> {};
+    struct U122: public time<>, public base_unit<second, s> {};
+    struct U123: public derived_unit<speed, base_unit<giga, m>, base_unit<second, s>> {};
+    struct U124: public derived_unit<force, base_unit<giga, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U125: public mass<>, public base_unit<tera, g> {};
+    struct U126: public length<>, public base_unit<tera, m> {};
+    struct U127: public time<>, public base_unit<minute, s> {};
+    struct U128: public derived_unit<speed, base_unit<tera, m>, base_unit<minute, s>> {};
+    struct U129: public derived_unit<force, base_unit<tera, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U130: public mass<>, public base_unit<pico, g> {};
+    struct U131: public length<>, public base_unit<pico, m> {};
+    struct U132: public time<>, public base_unit<hour, s> {};
+    struct U133: public derived_unit<speed, base_unit<pico, m>, base_unit<hour, s>> {};
+    struct U134: public derived_unit<force, base_unit<pico, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U135: public mass<>, public base_unit<nano, g> {};
+    struct U136: public length<>, public base_unit<nano, m> {};
+    struct U137: public time<>, public base_unit<day, s> {};
+    struct U138: public derived_unit<speed, base_unit<nano, m>, base_unit<day, s>> {};
+    struct U139: public derived_unit<force, base_unit<nano, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U140: public mass<>, public base_unit<micro, g> {};
+    struct U141: public length<>, public base_unit<micro, m> {};
+    struct U142: public time<>, public base_unit<second, s> {};
+    struct U143: public derived_unit<speed, base_unit<micro, m>, base_unit<second, s>> {};
+    struct U144: public derived_unit<force, base_unit<micro, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U145: public mass<>, public base_unit<milli, g> {};
+    struct U146: public length<>, public base_unit<milli, m> {};
+    struct U147: public time<>, public base_unit<minute, s> {};
+    struct U148: public derived_unit<speed, base_unit<milli, m>, base_unit<minute, s>> {};
+    struct U149: public derived_unit<force, base_unit<milli, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U150: public mass<>, public base_unit<centi, g> {};
+    struct U151: public length<>, public base_unit<centi, m> {};
+    struct U152: public time<>, public base_unit<hour, s> {};
+    struct U153: public derived_unit<speed, base_unit<centi, m>, base_unit<hour, s>> {};
+    struct U154: public derived_unit<force, base_unit<centi, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U155: public mass<>, public base_unit<deci, g> {};
+    struct U156: public length<>, public base_unit<deci, m> {};
+    struct U157: public time<>, public base_unit<day, s> {};
+    struct U158: public derived_unit<speed, base_unit<deci, m>, base_unit<day, s>> {};
+    struct U159: public derived_unit<force, base_unit<deci, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U160: public mass<>, public base_unit<root, g> {};
+    struct U161: public length<>, public base_unit<root, m> {};
+    struct U162: public time<>, public base_unit<second, s> {};
+    struct U163: public derived_unit<speed, base_unit<root, m>, base_unit<second, s>> {};
+    struct U164: public derived_unit<force, base_unit<root, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U165: public mass<>, public base_unit<deca, g> {};
+    struct U166: public length<>, public base_unit<deca, m> {};
+    struct U167: public time<>, public base_unit<minute, s> {};
+    struct U168: public derived_unit<speed, base_unit<deca, m>, base_unit<minute, s>> {};
+    struct U169: public derived_unit<force, base_unit<deca, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U170: public mass<>, public base_unit<hecto, g> {};
+    struct U171: public length<>, public base_unit<hecto, m> {};
+    struct U172: public time<>, public base_unit<hour, s> {};
+    struct U173: public derived_unit<speed, base_unit<hecto, m>, base_unit<hour, s>> {};
+    struct U174: public derived_unit<force, base_unit<hecto, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U175: public mass<>, public base_unit<kilo, g> {};
+    struct U176: public length<>, public base_unit<kilo, m> {};
+    struct U177: public time<>, public base_unit<day, s> {};
+    struct U178: public derived_unit<speed, base_unit<kilo, m>, base_unit<day, s>> {};
+    struct U179: public derived_unit<force, base_unit<kilo, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U180: public mass<>, public base_unit<mega, g> {};
+    struct U181: public length<>, public base_unit<mega, m> {};
+    struct U182: public time<>, public base_unit<second, s> {};
+    struct U183: public derived_unit<speed, base_unit<mega, m>, base_unit<second, s>> {};
+    struct U184: public derived_unit<force, base_unit<mega, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U185: public mass<>, public base_unit<giga, g> {};
+    struct U186: public length<>, public base_unit<giga, m> {};
+    struct U187: public time<>, public base_unit<minute, s> {};
+    struct U188: public derived_unit<speed, base_unit<giga, m>, base_unit<minute, s>> {};
+    struct U189: public derived_unit<force, base_unit<giga, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U190: public mass<>, public base_unit<tera, g> {};
+    struct U191: public length<>, public base_unit<tera, m> {};
+    struct U192: public time<>, public base_unit<hour, s> {};
+    struct U193: public derived_unit<speed, base_unit<tera, m>, base_unit<hour, s>> {};
+    struct U194: public derived_unit<force, base_unit<tera, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U195: public mass<>, public base_unit<pico, g> {};
+    struct U196: public length<>, public base_unit<pico, m> {};
+    struct U197: public time<>, public base_unit<day, s> {};
+    struct U198: public derived_unit<speed, base_unit<pico, m>, base_unit<day, s>> {};
+    struct U199: public derived_unit<force, base_unit<pico, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U200: public mass<>, public base_unit<nano, g> {};
+    struct U201: public length<>, public base_unit<nano, m> {};
+    struct U202: public time<>, public base_unit<second, s> {};
+    struct U203: public derived_unit<speed, base_unit<nano, m>, base_unit<second, s>> {};
+    struct U204: public derived_unit<force, base_unit<nano, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U205: public mass<>, public base_unit<micro, g> {};
+    struct U206: public length<>, public base_unit<micro, m> {};
+    struct U207: public time<>, public base_unit<minute, s> {};
+    struct U208: public derived_unit<speed, base_unit<micro, m>, base_unit<minute, s>> {};
+    struct U209: public derived_unit<force, base_unit<micro, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U210: public mass<>, public base_unit<milli, g> {};
+    struct U211: public length<>, public base_unit<milli, m> {};
+    struct U212: public time<>, public base_unit<hour, s> {};
+    struct U213: public derived_unit<speed, base_unit<milli, m>, base_unit<hour, s>> {};
+    struct U214: public derived_unit<force, base_unit<milli, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U215: public mass<>, public base_unit<centi, g> {};
+    struct U216: public length<>, public base_unit<centi, m> {};
+    struct U217: public time<>, public base_unit<day, s> {};
+    struct U218: public derived_unit<speed, base_unit<centi, m>, base_unit<day, s>> {};
+    struct U219: public derived_unit<force, base_unit<centi, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U220: public mass<>, public base_unit<deci, g> {};
+    struct U221: public length<>, public base_unit<deci, m> {};
+    struct U222: public time<>, public base_unit<second, s> {};
+    struct U223: public derived_unit<speed, base_unit<deci, m>, base_unit<second, s>> {};
+    struct U224: public derived_unit<force, base_unit<deci, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U225: public mass<>, public base_unit<root, g> {};
+    struct U226: public length<>, public base_unit<root, m> {};
+    struct U227: public time<>, public base_unit<minute, s> {};
+    struct U228: public derived_unit<speed, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U229: public derived_unit<force, base_unit<root, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U230: public mass<>, public base_unit<deca, g> {};
+    struct U231: public length<>, public base_unit<deca, m> {};
+    struct U232: public time<>, public base_unit<hour, s> {};
+    struct U233: public derived_unit<speed, base_unit<deca, m>, base_unit<hour, s>> {};
+    struct U234: public derived_unit<force, base_unit<deca, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U235: public mass<>, public base_unit<hecto, g> {};
+    struct U236: public length<>, public base_unit<hecto, m> {};
+    struct U237: public time<>, public base_unit<day, s> {};
+    struct U238: public derived_unit<speed, base_unit<hecto, m>, base_unit<day, s>> {};
+    struct U239: public derived_unit<force, base_unit<hecto, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U240: public mass<>, public base_unit<kilo, g> {};
+    struct U241: public length<>, public base_unit<kilo, m> {};
+    struct U242: public time<>, public base_unit<second, s> {};
+    struct U243: public derived_unit<speed, base_unit<kilo, m>, base_unit<second, s>> {};
+    struct U244: public derived_unit<force, base_unit<kilo, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U245: public mass<>, public base_unit<mega, g> {};
+    struct U246: public length<>, public base_unit<mega, m> {};
+    struct U247: public time<>, public base_unit<minute, s> {};
+    struct U248: public derived_unit<speed, base_unit<mega, m>, base_unit<minute, s>> {};
+    struct U249: public derived_unit<force, base_unit<mega, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U250: public mass<>, public base_unit<giga, g> {};
+    struct U251: public length<>, public base_unit<giga, m> {};
+    struct U252: public time<>, public base_unit<hour, s> {};
+    struct U253: public derived_unit<speed, base_unit<giga, m>, base_unit<hour, s>> {};
+    struct U254: public derived_unit<force, base_unit<giga, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U255: public mass<>, public base_unit<tera, g> {};
+    struct U256: public length<>, public base_unit<tera, m> {};
+    struct U257: public time<>, public base_unit<day, s> {};
+    struct U258: public derived_unit<speed, base_unit<tera, m>, base_unit<day, s>> {};
+    struct U259: public derived_unit<force, base_unit<tera, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U260: public mass<>, public base_unit<pico, g> {};
+    struct U261: public length<>, public base_unit<pico, m> {};
+    struct U262: public time<>, public base_unit<second, s> {};
+    struct U263: public derived_unit<speed, base_unit<pico, m>, base_unit<second, s>> {};
+    struct U264: public derived_unit<force, base_unit<pico, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U265: public mass<>, public base_unit<nano, g> {};
+    struct U266: public length<>, public base_unit<nano, m> {};
+    struct U267: public time<>, public base_unit<minute, s> {};
+    struct U268: public derived_unit<speed, base_unit<nano, m>, base_unit<minute, s>> {};
+    struct U269: public derived_unit<force, base_unit<nano, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U270: public mass<>, public base_unit<micro, g> {};
+    struct U271: public length<>, public base_unit<micro, m> {};
+    struct U272: public time<>, public base_unit<hour, s> {};
+    struct U273: public derived_unit<speed, base_unit<micro, m>, base_unit<hour, s>> {};
+    struct U274: public derived_unit<force, base_unit<micro, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U275: public mass<>, public base_unit<milli, g> {};
+    struct U276: public length<>, public base_unit<milli, m> {};
+    struct U277: public time<>, public base_unit<day, s> {};
+    struct U278: public derived_unit<speed, base_unit<milli, m>, base_unit<day, s>> {};
+    struct U279: public derived_unit<force, base_unit<milli, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U280: public mass<>, public base_unit<centi, g> {};
+    struct U281: public length<>, public base_unit<centi, m> {};
+    struct U282: public time<>, public base_unit<second, s> {};
+    struct U283: public derived_unit<speed, base_unit<centi, m>, base_unit<second, s>> {};
+    struct U284: public derived_unit<force, base_unit<centi, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U285: public mass<>, public base_unit<deci, g> {};
+    struct U286: public length<>, public base_unit<deci, m> {};
+    struct U287: public time<>, public base_unit<minute, s> {};
+    struct U288: public derived_unit<speed, base_unit<deci, m>, base_unit<minute, s>> {};
+    struct U289: public derived_unit<force, base_unit<deci, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U290: public mass<>, public base_unit<root, g> {};
+    struct U291: public length<>, public base_unit<root, m> {};
+    struct U292: public time<>, public base_unit<hour, s> {};
+    struct U293: public derived_unit<speed, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U294: public derived_unit<force, base_unit<root, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U295: public mass<>, public base_unit<deca, g> {};
+    struct U296: public length<>, public base_unit<deca, m> {};
+    struct U297: public time<>, public base_unit<day, s> {};
+    struct U298: public derived_unit<speed, base_unit<deca, m>, base_unit<day, s>> {};
+    struct U299: public derived_unit<force, base_unit<deca, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U300: public mass<>, public base_unit<hecto, g> {};
+    struct U301: public length<>, public base_unit<hecto, m> {};
+    struct U302: public time<>, public base_unit<second, s> {};
+    struct U303: public derived_unit<speed, base_unit<hecto, m>, base_unit<second, s>> {};
+    struct U304: public derived_unit<force, base_unit<hecto, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U305: public mass<>, public base_unit<kilo, g> {};
+    struct U306: public length<>, public base_unit<kilo, m> {};
+    struct U307: public time<>, public base_unit<minute, s> {};
+    struct U308: public derived_unit<speed, base_unit<kilo, m>, base_unit<minute, s>> {};
+    struct U309: public derived_unit<force, base_unit<kilo, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U310: public mass<>, public base_unit<mega, g> {};
+    struct U311: public length<>, public base_unit<mega, m> {};
+    struct U312: public time<>, public base_unit<hour, s> {};
+    struct U313: public derived_unit<speed, base_unit<mega, m>, base_unit<hour, s>> {};
+    struct U314: public derived_unit<force, base_unit<mega, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U315: public mass<>, public base_unit<giga, g> {};
+    struct U316: public length<>, public base_unit<giga, m> {};
+    struct U317: public time<>, public base_unit<day, s> {};
+    struct U318: public derived_unit<speed, base_unit<giga, m>, base_unit<day, s>> {};
+    struct U319: public derived_unit<force, base_unit<giga, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U320: public mass<>, public base_unit<tera, g> {};
+    struct U321: public length<>, public base_unit<tera, m> {};
+    struct U322: public time<>, public base_unit<second, s> {};
+    struct U323: public derived_unit<speed, base_unit<tera, m>, base_unit<second, s>> {};
+    struct U324: public derived_unit<force, base_unit<tera, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U325: public mass<>, public base_unit<pico, g> {};
+    struct U326: public length<>, public base_unit<pico, m> {};
+    struct U327: public time<>, public base_unit<minute, s> {};
+    struct U328: public derived_unit<speed, base_unit<pico, m>, base_unit<minute, s>> {};
+    struct U329: public derived_unit<force, base_unit<pico, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U330: public mass<>, public base_unit<nano, g> {};
+    struct U331: public length<>, public base_unit<nano, m> {};
+    struct U332: public time<>, public base_unit<hour, s> {};
+    struct U333: public derived_unit<speed, base_unit<nano, m>, base_unit<hour, s>> {};
+    struct U334: public derived_unit<force, base_unit<nano, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U335: public mass<>, public base_unit<micro, g> {};
+    struct U336: public length<>, public base_unit<micro, m> {};
+    struct U337: public time<>, public base_unit<day, s> {};
+    struct U338: public derived_unit<speed, base_unit<micro, m>, base_unit<day, s>> {};
+    struct U339: public derived_unit<force, base_unit<micro, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U340: public mass<>, public base_unit<milli, g> {};
+    struct U341: public length<>, public base_unit<milli, m> {};
+    struct U342: public time<>, public base_unit<second, s> {};
+    struct U343: public derived_unit<speed, base_unit<milli, m>, base_unit<second, s>> {};
+    struct U344: public derived_unit<force, base_unit<milli, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U345: public mass<>, public base_unit<centi, g> {};
+    struct U346: public length<>, public base_unit<centi, m> {};
+    struct U347: public time<>, public base_unit<minute, s> {};
+    struct U348: public derived_unit<speed, base_unit<centi, m>, base_unit<minute, s>> {};
+    struct U349: public derived_unit<force, base_unit<centi, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U350: public mass<>, public base_unit<deci, g> {};
+    struct U351: public length<>, public base_unit<deci, m> {};
+    struct U352: public time<>, public base_unit<hour, s> {};
+    struct U353: public derived_unit<speed, base_unit<deci, m>, base_unit<hour, s>> {};
+    struct U354: public derived_unit<force, base_unit<deci, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U355: public mass<>, public base_unit<root, g> {};
+    struct U356: public length<>, public base_unit<root, m> {};
+    struct U357: public time<>, public base_unit<day, s> {};
+    struct U358: public derived_unit<speed, base_unit<root, m>, base_unit<day, s>> {};
+    struct U359: public derived_unit<force, base_unit<root, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U360: public mass<>, public base_unit<deca, g> {};
+    struct U361: public length<>, public base_unit<deca, m> {};
+    struct U362: public time<>, public base_unit<second, s> {};
+    struct U363: public derived_unit<speed, base_unit<deca, m>, base_unit<second, s>> {};
+    struct U364: public derived_unit<force, base_unit<deca, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U365: public mass<>, public base_unit<hecto, g> {};
+    struct U366: public length<>, public base_unit<hecto, m> {};
+    struct U367: public time<>, public base_unit<minute, s> {};
+    struct U368: public derived_unit<speed, base_unit<hecto, m>, base_unit<minute, s>> {};
+    struct U369: public derived_unit<force, base_unit<hecto, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U370: public mass<>, public base_unit<kilo, g> {};
+    struct U371: public length<>, public base_unit<kilo, m> {};
+    struct U372: public time<>, public base_unit<hour, s> {};
+    struct U373: public derived_unit<speed, base_unit<kilo, m>, base_unit<hour, s>> {};
+    struct U374: public derived_unit<force, base_unit<kilo, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U375: public mass<>, public base_unit<mega, g> {};
+    struct U376: public length<>, public base_unit<mega, m> {};
+    struct U377: public time<>, public base_unit<day, s> {};
+    struct U378: public derived_unit<speed, base_unit<mega, m>, base_unit<day, s>> {};
+    struct U379: public derived_unit<force, base_unit<mega, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U380: public mass<>, public base_unit<giga, g> {};
+    struct U381: public length<>, public base_unit<giga, m> {};
+    struct U382: public time<>, public base_unit<second, s> {};
+    struct U383: public derived_unit<speed, base_unit<giga, m>, base_unit<second, s>> {};
+    struct U384: public derived_unit<force, base_unit<giga, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U385: public mass<>, public base_unit<tera, g> {};
+    struct U386: public length<>, public base_unit<tera, m> {};
+    struct U387: public time<>, public base_unit<minute, s> {};
+    struct U388: public derived_unit<speed, base_unit<tera, m>, base_unit<minute, s>> {};
+    struct U389: public derived_unit<force, base_unit<tera, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U390: public mass<>, public base_unit<pico, g> {};
+    struct U391: public length<>, public base_unit<pico, m> {};
+    struct U392: public time<>, public base_unit<hour, s> {};
+    struct U393: public derived_unit<speed, base_unit<pico, m>, base_unit<hour, s>> {};
+    struct U394: public derived_unit<force, base_unit<pico, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U395: public mass<>, public base_unit<nano, g> {};
+    struct U396: public length<>, public base_unit<nano, m> {};
+    struct U397: public time<>, public base_unit<day, s> {};
+    struct U398: public derived_unit<speed, base_unit<nano, m>, base_unit<day, s>> {};
+    struct U399: public derived_unit<force, base_unit<nano, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U400: public mass<>, public base_unit<micro, g> {};
+    struct U401: public length<>, public base_unit<micro, m> {};
+    struct U402: public time<>, public base_unit<second, s> {};
+    struct U403: public derived_unit<speed, base_unit<micro, m>, base_unit<second, s>> {};
+    struct U404: public derived_unit<force, base_unit<micro, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U405: public mass<>, public base_unit<milli, g> {};
+    struct U406: public length<>, public base_unit<milli, m> {};
+    struct U407: public time<>, public base_unit<minute, s> {};
+    struct U408: public derived_unit<speed, base_unit<milli, m>, base_unit<minute, s>> {};
+    struct U409: public derived_unit<force, base_unit<milli, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U410: public mass<>, public base_unit<centi, g> {};
+    struct U411: public length<>, public base_unit<centi, m> {};
+    struct U412: public time<>, public base_unit<hour, s> {};
+    struct U413: public derived_unit<speed, base_unit<centi, m>, base_unit<hour, s>> {};
+    struct U414: public derived_unit<force, base_unit<centi, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U415: public mass<>, public base_unit<deci, g> {};
+    struct U416: public length<>, public base_unit<deci, m> {};
+    struct U417: public time<>, public base_unit<day, s> {};
+    struct U418: public derived_unit<speed, base_unit<deci, m>, base_unit<day, s>> {};
+    struct U419: public derived_unit<force, base_unit<deci, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U420: public mass<>, public base_unit<root, g> {};
+    struct U421: public length<>, public base_unit<root, m> {};
+    struct U422: public time<>, public base_unit<second, s> {};
+    struct U423: public derived_unit<speed, base_unit<root, m>, base_unit<second, s>> {};
+    struct U424: public derived_unit<force, base_unit<root, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U425: public mass<>, public base_unit<deca, g> {};
+    struct U426: public length<>, public base_unit<deca, m> {};
+    struct U427: public time<>, public base_unit<minute, s> {};
+    struct U428: public derived_unit<speed, base_unit<deca, m>, base_unit<minute, s>> {};
+    struct U429: public derived_unit<force, base_unit<deca, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U430: public mass<>, public base_unit<hecto, g> {};
+    struct U431: public length<>, public base_unit<hecto, m> {};
+    struct U432: public time<>, public base_unit<hour, s> {};
+    struct U433: public derived_unit<speed, base_unit<hecto, m>, base_unit<hour, s>> {};
+    struct U434: public derived_unit<force, base_unit<hecto, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U435: public mass<>, public base_unit<kilo, g> {};
+    struct U436: public length<>, public base_unit<kilo, m> {};
+    struct U437: public time<>, public base_unit<day, s> {};
+    struct U438: public derived_unit<speed, base_unit<kilo, m>, base_unit<day, s>> {};
+    struct U439: public derived_unit<force, base_unit<kilo, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U440: public mass<>, public base_unit<mega, g> {};
+    struct U441: public length<>, public base_unit<mega, m> {};
+    struct U442: public time<>, public base_unit<second, s> {};
+    struct U443: public derived_unit<speed, base_unit<mega, m>, base_unit<second, s>> {};
+    struct U444: public derived_unit<force, base_unit<mega, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U445: public mass<>, public base_unit<giga, g> {};
+    struct U446: public length<>, public base_unit<giga, m> {};
+    struct U447: public time<>, public base_unit<minute, s> {};
+    struct U448: public derived_unit<speed, base_unit<giga, m>, base_unit<minute, s>> {};
+    struct U449: public derived_unit<force, base_unit<giga, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U450: public mass<>, public base_unit<tera, g> {};
+    struct U451: public length<>, public base_unit<tera, m> {};
+    struct U452: public time<>, public base_unit<hour, s> {};
+    struct U453: public derived_unit<speed, base_unit<tera, m>, base_unit<hour, s>> {};
+    struct U454: public derived_unit<force, base_unit<tera, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U455: public mass<>, public base_unit<pico, g> {};
+    struct U456: public length<>, public base_unit<pico, m> {};
+    struct U457: public time<>, public base_unit<day, s> {};
+    struct U458: public derived_unit<speed, base_unit<pico, m>, base_unit<day, s>> {};
+    struct U459: public derived_unit<force, base_unit<pico, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U460: public mass<>, public base_unit<nano, g> {};
+    struct U461: public length<>, public base_unit<nano, m> {};
+    struct U462: public time<>, public base_unit<second, s> {};
+    struct U463: public derived_unit<speed, base_unit<nano, m>, base_unit<second, s>> {};
+    struct U464: public derived_unit<force, base_unit<nano, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U465: public mass<>, public base_unit<micro, g> {};
+    struct U466: public length<>, public base_unit<micro, m> {};
+    struct U467: public time<>, public base_unit<minute, s> {};
+    struct U468: public derived_unit<speed, base_unit<micro, m>, base_unit<minute, s>> {};
+    struct U469: public derived_unit<force, base_unit<micro, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U470: public mass<>, public base_unit<milli, g> {};
+    struct U471: public length<>, public base_unit<milli, m> {};
+    struct U472: public time<>, public base_unit<hour, s> {};
+    struct U473: public derived_unit<speed, base_unit<milli, m>, base_unit<hour, s>> {};
+    struct U474: public derived_unit<force, base_unit<milli, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U475: public mass<>, public base_unit<centi, g> {};
+    struct U476: public length<>, public base_unit<centi, m> {};
+    struct U477: public time<>, public base_unit<day, s> {};
+    struct U478: public derived_unit<speed, base_unit<centi, m>, base_unit<day, s>> {};
+    struct U479: public derived_unit<force, base_unit<centi, g>, base_unit<root, m>, base_unit<day, s>> {};
+    struct U480: public mass<>, public base_unit<deci, g> {};
+    struct U481: public length<>, public base_unit<deci, m> {};
+    struct U482: public time<>, public base_unit<second, s> {};
+    struct U483: public derived_unit<speed, base_unit<deci, m>, base_unit<second, s>> {};
+    struct U484: public derived_unit<force, base_unit<deci, g>, base_unit<root, m>, base_unit<second, s>> {};
+    struct U485: public mass<>, public base_unit<root, g> {};
+    struct U486: public length<>, public base_unit<root, m> {};
+    struct U487: public time<>, public base_unit<minute, s> {};
+    struct U488: public derived_unit<speed, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U489: public derived_unit<force, base_unit<root, g>, base_unit<root, m>, base_unit<minute, s>> {};
+    struct U490: public mass<>, public base_unit<deca, g> {};
+    struct U491: public length<>, public base_unit<deca, m> {};
+    struct U492: public time<>, public base_unit<hour, s> {};
+    struct U493: public derived_unit<speed, base_unit<deca, m>, base_unit<hour, s>> {};
+    struct U494: public derived_unit<force, base_unit<deca, g>, base_unit<root, m>, base_unit<hour, s>> {};
+    struct U495: public mass<>, public base_unit<hecto, g> {};
+    struct U496: public length<>, public base_unit<hecto, m> {};
+    struct U497: public time<>, public base_unit<day, s> {};
+    struct U498: public derived_unit<speed, base_unit<hecto, m>, base_unit<day, s>> {};
+    struct U499: public derived_unit<force, base_unit<hecto, g>, base_unit<root, m>, base_unit<day, s>> {};
+}
+
+using namespace generated;
+
+static_assert(CommonDimension<U5, U0> && !CommonDimension<U5, U4>);
+static_assert(CommonDimension<U6, U1> && !CommonDimension<U6, U5>);
+static_assert(CommonDimension<U7, U2> && !CommonDimension<U7, U6>);
+static_assert(CommonDimension<U8, U3> && !CommonDimension<U8, U7>);
+static_assert(CommonDimension<U9, U4> && !CommonDimension<U9, U8>);
+static_assert(CommonDimension<U10, U5> && !CommonDimension<U10, U9>);
+static_assert(CommonDimension<U11, U6> && !CommonDimension<U11, U10>);
+static_assert(CommonDimension<U12, U7> && !CommonDimension<U12, U11>);
+static_assert(CommonDimension<U13, U8> && !CommonDimension<U13, U12>);
+static_assert(CommonDimension<U14, U9> && !CommonDimension<U14, U13>);
+static_assert(CommonDimension<U15, U10> && !CommonDimension<U15, U14>);
+static_assert(CommonDimension<U16, U11> && !CommonDimension<U16, U15>);
+static_assert(CommonDimension<U17, U12> && !CommonDimension<U17, U16>);
+static_assert(CommonDimension<U18, U13> && !CommonDimension<U18, U17>);
+static_assert(CommonDimension<U19, U14> && !CommonDimension<U19, U18>);
+static_assert(CommonDimension<U20, U15> && !CommonDimension<U20, U19>);
+static_assert(CommonDimension<U21, U16> && !CommonDimension<U21, U20>);
+static_assert(CommonDimension<U22, U17> && !CommonDimension<U22, U21>);
+static_assert(CommonDimension<U23, U18> && !CommonDimension<U23, U22>);
+static_assert(CommonDimension<U24, U19> && !CommonDimension<U24, U23>);
+static_assert(CommonDimension<U25, U20> && !CommonDimension<U25, U24>);
+static_assert(CommonDimension<U26, U21> && !CommonDimension<U26, U25>);
+static_assert(CommonDimension<U27, U22> && !CommonDimension<U27, U26>);
+static_assert(CommonDimension<U28, U23> && !CommonDimension<U28, U27>);
+static_assert(CommonDimension<U29, U24> && !CommonDimension<U29, U28>);
+static_assert(CommonDimension<U30, U25> && !CommonDimension<U30, U29>);
+static_assert(CommonDimension<U31, U26> && !CommonDimension<U31, U30>);
+static_assert(CommonDimension<U32, U27> && !CommonDimension<U32, U31>);
+static_assert(CommonDimension<U33, U28> && !CommonDimension<U33, U32>);
+static_assert(CommonDimension<U34, U29> && !CommonDimension<U34, U33>);
+static_assert(CommonDimension<U35, U30> && !CommonDimension<U35, U34>);
+static_assert(CommonDimension<U36, U31> && !CommonDimension<U36, U35>);
+static_assert(CommonDimension<U37, U32> && !CommonDimension<U37, U36>);
+static_assert(CommonDimension<U38, U33> && !CommonDimension<U38, U37>);
+static_assert(CommonDimension<U39, U34> && !CommonDimension<U39, U38>);
+static_assert(CommonDimension<U40, U35> && !CommonDimension<U40, U39>);
+static_assert(CommonDimension<U41, U36> && !CommonDimension<U41, U40>);
+static_assert(CommonDimension<U42, U37> && !CommonDimension<U42, U41>);
+static_assert(CommonDimension<U43, U38> && !CommonDimension<U43, U42>);
+static_assert(CommonDimension<U44, U39> && !CommonDimension<U44, U43>);
+static_assert(CommonDimension<U45, U40> && !CommonDimension<U45, U44>);
+static_assert(CommonDimension<U46, U41> && !CommonDimension<U46, U45>);
+static_assert(CommonDimension<U47, U42> && !CommonDimension<U47, U46>);
+static_assert(CommonDimension<U48, U43> && !CommonDimension<U48, U47>);
+static_assert(CommonDimension<U49, U44> && !CommonDimension<U49, U48>);
+static_assert(CommonDimension<U50, U45> && !CommonDimension<U50, U49>);
+static_assert(CommonDimension<U51, U46> && !CommonDimension<U51, U50>);
+static_assert(CommonDimension<U52, U47> && !CommonDimension<U52, U51>);
+static_assert(CommonDimension<U53, U48> && !CommonDimension<U53, U52>);
+static_assert(CommonDimension<U54, U49> && !CommonDimension<U54, U53>);
+static_assert(CommonDimension<U55, U50> && !CommonDimension<U55, U54>);
+static_assert(CommonDimension<U56, U51> && !CommonDimension<U56, U55>);
+static_assert(CommonDimension<U57, U52> && !CommonDimension<U57, U56>);
+static_assert(CommonDimension<U58, U53> && !CommonDimension<U58, U57>);
+static_assert(CommonDimension<U59, U54> && !CommonDimension<U59, U58>);
+static_assert(CommonDimension<U60, U55> && !CommonDimension<U60, U59>);
+static_assert(CommonDimension<U61, U56> && !CommonDimension<U61, U60>);
+static_assert(CommonDimension<U62, U57> && !CommonDimension<U62, U61>);
+static_assert(CommonDimension<U63, U58> && !CommonDimension<U63, U62>);
+static_assert(CommonDimension<U64, U59> && !CommonDimension<U64, U63>);
+static_assert(CommonDimension<U65, U60> && !CommonDimension<U65, U64>);
+static_assert(CommonDimension<U66, U61> && !CommonDimension<U66, U65>);
+static_assert(CommonDimension<U67, U62> && !CommonDimension<U67, U66>);
+static_assert(CommonDimension<U68, U63> && !CommonDimension<U68, U67>);
+static_assert(CommonDimension<U69, U64> && !CommonDimension<U69, U68>);
+static_assert(CommonDimension<U70, U65> && !CommonDimension<U70, U69>);
+static_assert(CommonDimension<U71, U66> && !CommonDimension<U71, U70>);
+static_assert(CommonDimension<U72, U67> && !CommonDimension<U72, U71>);
+static_assert(CommonDimension<U73, U68> && !CommonDimension<U73, U72>);
+static_assert(CommonDimension<U74, U69> && !CommonDimension<U74, U73>);
+static_assert(CommonDimension<U75, U70> && !CommonDimension<U75, U74>);
+static_assert(CommonDimension<U76, U71> && !CommonDimension<U76, U75>);
+static_assert(CommonDimension<U77, U72> && !CommonDimension<U77, U76>);
+static_assert(CommonDimension<U78, U73> && !CommonDimension<U78, U77>);
+static_assert(CommonDimension<U79, U74> && !CommonDimension<U79, U78>);
+static_assert(CommonDimension<U80, U75> && !CommonDimension<U80, U79>);
+static_assert(CommonDimension<U81, U76> && !CommonDimension<U81, U80>);
+static_assert(CommonDimension<U82, U77> && !CommonDimension<U82, U81>);
+static_assert(CommonDimension<U83, U78> && !CommonDimension<U83, U82>);
+static_assert(CommonDimension<U84, U79> && !CommonDimension<U84, U83>);
+static_assert(CommonDimension<U85, U80> && !CommonDimension<U85, U84>);
+static_assert(CommonDimension<U86, U81> && !CommonDimension<U86, U85>);
+static_assert(CommonDimension<U87, U82> && !CommonDimension<U87, U86>);
+static_assert(CommonDimension<U88, U83> && !CommonDimension<U88, U87>);
+static_assert(CommonDimension<U89, U84> && !CommonDimension<U89, U88>);
+static_assert(CommonDimension<U90, U85> && !CommonDimension<U90, U89>);
+static_assert(CommonDimension<U91, U86> && !CommonDimension<U91, U90>);
+static_assert(CommonDimension<U92, U87> && !CommonDimension<U92, U91>);
+static_assert(CommonDimension<U93, U88> && !CommonDimension<U93, U92>);
+static_assert(CommonDimension<U94, U89> && !CommonDimension<U94, U93>);
+static_assert(CommonDimension<U95, U90> && !CommonDimension<U95, U94>);
+static_assert(CommonDimension<U96, U91> && !CommonDimension<U96, U95>);
+static_assert(CommonDimension<U97, U92> && !CommonDimension<U97, U96>);
+static_assert(CommonDimension<U98, U93> && !CommonDimension<U98, U97>);
+static_assert(CommonDimension<U99, U94> && !CommonDimension<U99, U98>);
+static_assert(CommonDimension<U100, U95> && !CommonDimension<U100, U99>);
+static_assert(CommonDimension<U101, U96> && !CommonDimension<U101, U100>);
+static_assert(CommonDimension<U102, U97> && !CommonDimension<U102, U101>);
+static_assert(CommonDimension<U103, U98> && !CommonDimension<U103, U102>);
+static_assert(CommonDimension<U104, U99> && !CommonDimension<U104, U103>);
+static_assert(CommonDimension<U105, U100> && !CommonDimension<U105, U104>);
+static_assert(CommonDimension<U106, U101> && !CommonDimension<U106, U105>);
+static_assert(CommonDimension<U107, U102> && !CommonDimension<U107, U106>);
+static_assert(CommonDimension<U108, U103> && !CommonDimension<U108, U107>);
+static_assert(CommonDimension<U109, U104> && !CommonDimension<U109, U108>);
+static_assert(CommonDimension<U110, U105> && !CommonDimension<U110, U109>);
+static_assert(CommonDimension<U111, U106> && !CommonDimension<U111, U110>);
+static_assert(CommonDimension<U112, U107> && !CommonDimension<U112, U111>);
+static_assert(CommonDimension<U113, U108> && !CommonDimension<U113, U112>);
+static_assert(CommonDimension<U114, U109> && !CommonDimension<U114, U113>);
+static_assert(CommonDimension<U115, U110> && !CommonDimension<U115, U114>);
+static_assert(CommonDimension<U116, U111> && !CommonDimension<U116, U115>);
+static_assert(CommonDimension<U117, U112> && !CommonDimension<U117, U116>);
+static_assert(CommonDimension<U118, U113> && !CommonDimension<U118, U117>);
+static_assert(CommonDimension<U119, U114> && !CommonDimension<U119, U118>);
+static_assert(CommonDimension<U120, U115> && !CommonDimension<U120, U119>);
+static_assert(CommonDimension<U121, U116> && !CommonDimension<U121, U120>);
+static_assert(CommonDimension<U122, U117> && !CommonDimension<U122, U121>);
+static_assert(CommonDimension<U123, U118> && !CommonDimension<U123, U122>);
+static_assert(CommonDimension<U124, U119> && !CommonDimension<U124, U123>);
+static_assert(CommonDimension<U125, U120> && !CommonDimension<U125, U124>);
+static_assert(CommonDimension<U126, U121> && !CommonDimension<U126, U125>);
+static_assert(CommonDimension<U127, U122> && !CommonDimension<U127, U126>);
+static_assert(CommonDimension<U128, U123> && !CommonDimension<U128, U127>);
+static_assert(CommonDimension<U129, U124> && !CommonDimension<U129, U128>);
+static_assert(CommonDimension<U130, U125> && !CommonDimension<U130, U129>);
+static_assert(CommonDimension<U131, U126> && !CommonDimension<U131, U130>);
+static_assert(CommonDimension<U132, U127> && !CommonDimension<U132, U131>);
+static_assert(CommonDimension<U133, U128> && !CommonDimension<U133, U132>);
+static_assert(CommonDimension<U134, U129> && !CommonDimension<U134, U133>);
+static_assert(CommonDimension<U135, U130> && !CommonDimension<U135, U134>);
+static_assert(CommonDimension<U136, U131> && !CommonDimension<U136, U135>);
+static_assert(CommonDimension<U137, U132> && !CommonDimension<U137, U136>);
+static_assert(CommonDimension<U138, U133> && !CommonDimension<U138, U137>);
+static_assert(CommonDimension<U139, U134> && !CommonDimension<U139, U138>);
+static_assert(CommonDimension<U140, U135> && !CommonDimension<U140, U139>);
+static_assert(CommonDimension<U141, U136> && !CommonDimension<U141, U140>);
+static_assert(CommonDimension<U142, U137> && !CommonDimension<U142, U141>);
+static_assert(CommonDimension<U143, U138> && !CommonDimension<U143, U142>);
+static_assert(CommonDimension<U144, U139> && !CommonDimension<U144, U143>);
+static_assert(CommonDimension<U145, U140> && !CommonDimension<U145, U144>);
+static_assert(CommonDimension<U146, U141> && !CommonDimension<U146, U145>);
+static_assert(CommonDimension<U147, U142> && !CommonDimension<U147, U146>);
+static_assert(CommonDimension<U148, U143> && !CommonDimension<U148, U147>);
+static_assert(CommonDimension<U149, U144> && !CommonDimension<U149, U148>);
+static_assert(CommonDimension<U150, U145> && !CommonDimension<U150, U149>);
+static_assert(CommonDimension<U151, U146> && !CommonDimension<U151, U150>);
+static_assert(CommonDimension<U152, U147> && !CommonDimension<U152, U151>);
+static_assert(CommonDimension<U153, U148> && !CommonDimension<U153, U152>);
+static_assert(CommonDimension<U154, U149> && !CommonDimension<U154, U153>);
+static_assert(CommonDimension<U155, U150> && !CommonDimension<U155, U154>);
+static_assert(CommonDimension<U156, U151> && !CommonDimension<U156, U155>);
+static_assert(CommonDimension<U157, U152> && !CommonDimension<U157, U156>);
+static_assert(CommonDimension<U158, U153> && !CommonDimension<U158, U157>);
+static_assert(CommonDimension<U159, U154> && !CommonDimension<U159, U158>);
+static_assert(CommonDimension<U160, U155> && !CommonDimension<U160, U159>);
+static_assert(CommonDimension<U161, U156> && !CommonDimension<U161, U160>);
+static_assert(CommonDimension<U162, U157> && !CommonDimension<U162, U161>);
+static_assert(CommonDimension<U163, U158> && !CommonDimension<U163, U162>);
+static_assert(CommonDimension<U164, U159> && !CommonDimension<U164, U163>);
+static_assert(CommonDimension<U165, U160> && !CommonDimension<U165, U164>);
+static_assert(CommonDimension<U166, U161> && !CommonDimension<U166, U165>);
+static_assert(CommonDimension<U167, U162> && !CommonDimension<U167, U166>);
+static_assert(CommonDimension<U168, U163> && !CommonDimension<U168, U167>);
+static_assert(CommonDimension<U169, U164> && !CommonDimension<U169, U168>);
+static_assert(CommonDimension<U170, U165> && !CommonDimension<U170, U169>);
+static_assert(CommonDimension<U171, U166> && !CommonDimension<U171, U170>);
+static_assert(CommonDimension<U172, U167> && !CommonDimension<U172, U171>);
+static_assert(CommonDimension<U173, U168> && !CommonDimension<U173, U172>);
+static_assert(CommonDimension<U174, U169> && !CommonDimension<U174, U173>);
+static_assert(CommonDimension<U175, U170> && !CommonDimension<U175, U174>);
+static_assert(CommonDimension<U176, U171> && !CommonDimension<U176, U175>);
+static_assert(CommonDimension<U177, U172> && !CommonDimension<U177, U176>);
+static_assert(CommonDimension<U178, U173> && !CommonDimension<U178, U177>);
+static_assert(CommonDimension<U179, U174> && !CommonDimension<U179, U178>);
+static_assert(CommonDimension<U180, U175> && !CommonDimension<U180, U179>);
+static_assert(CommonDimension<U181, U176> && !CommonDimension<U181, U180>);
+static_assert(CommonDimension<U182, U177> && !CommonDimension<U182, U181>);
+static_assert(CommonDimension<U183, U178> && !CommonDimension<U183, U182>);
+static_assert(CommonDimension<U184, U179> && !CommonDimension<U184, U183>);
+static_assert(CommonDimension<U185, U180> && !CommonDimension<U185, U184>);
+static_assert(CommonDimension<U186, U181> && !CommonDimension<U186, U185>);
+static_assert(CommonDimension<U187, U182> && !CommonDimension<U187, U186>);
+static_assert(CommonDimension<U188, U183> && !CommonDimension<U188, U187>);
+static_assert(CommonDimension<U189, U184> && !CommonDimension<U189, U188>);
+static_assert(CommonDimension<U190, U185> && !CommonDimension<U190, U189>);
+static_assert(CommonDimension<U191, U186> && !CommonDimension<U191, U190>);
+static_assert(CommonDimension<U192, U187> && !CommonDimension<U192, U191>);
+static_assert(CommonDimension<U193, U188> && !CommonDimension<U193, U192>);
+static_assert(CommonDimension<U194, U189> && !CommonDimension<U194, U193>);
+static_assert(CommonDimension<U195, U190> && !CommonDimension<U195, U194>);
+static_assert(CommonDimension<U196, U191> && !CommonDimension<U196, U195>);
+static_assert(CommonDimension<U197, U192> && !CommonDimension<U197, U196>);
+static_assert(CommonDimension<U198, U193> && !CommonDimension<U198, U197>);
+static_assert(CommonDimension<U199, U194> && !CommonDimension<U199, U198>);
+static_assert(CommonDimension<U200, U195> && !CommonDimension<U200, U199>);
+static_assert(CommonDimension<U201, U196> && !CommonDimension<U201, U200>);
+static_assert(CommonDimension<U202, U197> && !CommonDimension<U202, U201>);
+static_assert(CommonDimension<U203, U198> && !CommonDimension<U203, U202>);
+static_assert(CommonDimension<U204, U199> && !CommonDimension<U204, U203>);
+static_assert(CommonDimension<U205, U200> && !CommonDimension<U205, U204>);
+static_assert(CommonDimension<U206, U201> && !CommonDimension<U206, U205>);
+static_assert(CommonDimension<U207, U202> && !CommonDimension<U207, U206>);
+static_assert(CommonDimension<U208, U203> && !CommonDimension<U208, U207>);
+static_assert(CommonDimension<U209, U204> && !CommonDimension<U209, U208>);
+static_assert(CommonDimension<U210, U205> && !CommonDimension<U210, U209>);
+static_assert(CommonDimension<U211, U206> && !CommonDimension<U211, U210>);
+static_assert(CommonDimension<U212, U207> && !CommonDimension<U212, U211>);
+static_assert(CommonDimension<U213, U208> && !CommonDimension<U213, U212>);
+static_assert(CommonDimension<U214, U209> && !CommonDimension<U214, U213>);
+static_assert(CommonDimension<U215, U210> && !CommonDimension<U215, U214>);
+static_assert(CommonDimension<U216, U211> && !CommonDimension<U216, U215>);
+static_assert(CommonDimension<U217, U212> && !CommonDimension<U217, U216>);
+static_assert(CommonDimension<U218, U213> && !CommonDimension<U218, U217>);
+static_assert(CommonDimension<U219, U214> && !CommonDimension<U219, U218>);
+static_assert(CommonDimension<U220, U215> && !CommonDimension<U220, U219>);
+static_assert(CommonDimension<U221, U216> && !CommonDimension<U221, U220>);
+static_assert(CommonDimension<U222, U217> && !CommonDimension<U222, U221>);
+static_assert(CommonDimension<U223, U218> && !CommonDimension<U223, U222>);
+static_assert(CommonDimension<U224, U219> && !CommonDimension<U224, U223>);
+static_assert(CommonDimension<U225, U220> && !CommonDimension<U225, U224>);
+static_assert(CommonDimension<U226, U221> && !CommonDimension<U226, U225>);
+static_assert(CommonDimension<U227, U222> && !CommonDimension<U227, U226>);
+static_assert(CommonDimension<U228, U223> && !CommonDimension<U228, U227>);
+static_assert(CommonDimension<U229, U224> && !CommonDimension<U229, U228>);
+static_assert(CommonDimension<U230, U225> && !CommonDimension<U230, U229>);
+static_assert(CommonDimension<U231, U226> && !CommonDimension<U231, U230>);
+static_assert(CommonDimension<U232, U227> && !CommonDimension<U232, U231>);
+static_assert(CommonDimension<U233, U228> && !CommonDimension<U233, U232>);
+static_assert(CommonDimension<U234, U229> && !CommonDimension<U234, U233>);
+static_assert(CommonDimension<U235, U230> && !CommonDimension<U235, U234>);
+static_assert(CommonDimension<U236, U231> && !CommonDimension<U236, U235>);
+static_assert(CommonDimension<U237, U232> && !CommonDimension<U237, U236>);
+static_assert(CommonDimension<U238, U233> && !CommonDimension<U238, U237>);
+static_assert(CommonDimension<U239, U234> && !CommonDimension<U239, U238>);
+static_assert(CommonDimension<U240, U235> && !CommonDimension<U240, U239>);
+static_assert(CommonDimension<U241, U236> && !CommonDimension<U241, U240>);
+static_assert(CommonDimension<U242, U237> && !CommonDimension<U242, U241>);
+static_assert(CommonDimension<U243, U238> && !CommonDimension<U243, U242>);
+static_assert(CommonDimension<U244, U239> && !CommonDimension<U244, U243>);
+static_assert(CommonDimension<U245, U240> && !CommonDimension<U245, U244>);
+static_assert(CommonDimension<U246, U241> && !CommonDimension<U246, U245>);
+static_assert(CommonDimension<U247, U242> && !CommonDimension<U247, U246>);
+static_assert(CommonDimension<U248, U243> && !CommonDimension<U248, U247>);
+static_assert(CommonDimension<U249, U244> && !CommonDimension<U249, U248>);
+static_assert(CommonDimension<U250, U245> && !CommonDimension<U250, U249>);
+static_assert(CommonDimension<U251, U246> && !CommonDimension<U251, U250>);
+static_assert(CommonDimension<U252, U247> && !CommonDimension<U252, U251>);
+static_assert(CommonDimension<U253, U248> && !CommonDimension<U253, U252>);
+static_assert(CommonDimension<U254, U249> && !CommonDimension<U254, U253>);
+static_assert(CommonDimension<U255, U250> && !CommonDimension<U255, U254>);
+static_assert(CommonDimension<U256, U251> && !CommonDimension<U256, U255>);
+static_assert(CommonDimension<U257, U252> && !CommonDimension<U257, U256>);
+static_assert(CommonDimension<U258, U253> && !CommonDimension<U258, U257>);
+static_assert(CommonDimension<U259, U254> && !CommonDimension<U259, U258>);
+static_assert(CommonDimension<U260, U255> && !CommonDimension<U260, U259>);
+static_assert(CommonDimension<U261, U256> && !CommonDimension<U261, U260>);
+static_assert(CommonDimension<U262, U257> && !CommonDimension<U262, U261>);
+static_assert(CommonDimension<U263, U258> && !CommonDimension<U263, U262>);
+static_assert(CommonDimension<U264, U259> && !CommonDimension<U264, U263>);
+static_assert(CommonDimension<U265, U260> && !CommonDimension<U265, U264>);
+static_assert(CommonDimension<U266, U261> && !CommonDimension<U266, U265>);
+static_assert(CommonDimension<U267, U262> && !CommonDimension<U267, U266>);
+static_assert(CommonDimension<U268, U263> && !CommonDimension<U268, U267>);
+static_assert(CommonDimension<U269, U264> && !CommonDimension<U269, U268>);
+static_assert(CommonDimension<U270, U265> && !CommonDimension<U270, U269>);
+static_assert(CommonDimension<U271, U266> && !CommonDimension<U271, U270>);
+static_assert(CommonDimension<U272, U267> && !CommonDimension<U272, U271>);
+static_assert(CommonDimension<U273, U268> && !CommonDimension<U273, U272>);
+static_assert(CommonDimension<U274, U269> && !CommonDimension<U274, U273>);
+static_assert(CommonDimension<U275, U270> && !CommonDimension<U275, U274>);
+static_assert(CommonDimension<U276, U271> && !CommonDimension<U276, U275>);
+static_assert(CommonDimension<U277, U272> && !CommonDimension<U277, U276>);
+static_assert(CommonDimension<U278, U273> && !CommonDimension<U278, U277>);
+static_assert(CommonDimension<U279, U274> && !CommonDimension<U279, U278>);
+static_assert(CommonDimension<U280, U275> && !CommonDimension<U280, U279>);
+static_assert(CommonDimension<U281, U276> && !CommonDimension<U281, U280>);
+static_assert(CommonDimension<U282, U277> && !CommonDimension<U282, U281>);
+static_assert(CommonDimension<U283, U278> && !CommonDimension<U283, U282>);
+static_assert(CommonDimension<U284, U279> && !CommonDimension<U284, U283>);
+static_assert(CommonDimension<U285, U280> && !CommonDimension<U285, U284>);
+static_assert(CommonDimension<U286, U281> && !CommonDimension<U286, U285>);
+static_assert(CommonDimension<U287, U282> && !CommonDimension<U287, U286>);
+static_assert(CommonDimension<U288, U283> && !CommonDimension<U288, U287>);
+static_assert(CommonDimension<U289, U284> && !CommonDimension<U289, U288>);
+static_assert(CommonDimension<U290, U285> && !CommonDimension<U290, U289>);
+static_assert(CommonDimension<U291, U286> && !CommonDimension<U291, U290>);
+static_assert(CommonDimension<U292, U287> && !CommonDimension<U292, U291>);
+static_assert(CommonDimension<U293, U288> && !CommonDimension<U293, U292>);
+static_assert(CommonDimension<U294, U289> && !CommonDimension<U294, U293>);
+static_assert(CommonDimension<U295, U290> && !CommonDimension<U295, U294>);
+static_assert(CommonDimension<U296, U291> && !CommonDimension<U296, U295>);
+static_assert(CommonDimension<U297, U292> && !CommonDimension<U297, U296>);
+static_assert(CommonDimension<U298, U293> && !CommonDimension<U298, U297>);
+static_assert(CommonDimension<U299, U294> && !CommonDimension<U299, U298>);
+static_assert(CommonDimension<U300, U295> && !CommonDimension<U300, U299>);
+static_assert(CommonDimension<U301, U296> && !CommonDimension<U301, U300>);
+static_assert(CommonDimension<U302, U297> && !CommonDimension<U302, U301>);
+static_assert(CommonDimension<U303, U298> && !CommonDimension<U303, U302>);
+static_assert(CommonDimension<U304, U299> && !CommonDimension<U304, U303>);
+static_assert(CommonDimension<U305, U300> && !CommonDimension<U305, U304>);
+static_assert(CommonDimension<U306, U301> && !CommonDimension<U306, U305>);
+static_assert(CommonDimension<U307, U302> && !CommonDimension<U307, U306>);
+static_assert(CommonDimension<U308, U303> && !CommonDimension<U308, U307>);
+static_assert(CommonDimension<U309, U304> && !CommonDimension<U309, U308>);
+static_assert(CommonDimension<U310, U305> && !CommonDimension<U310, U309>);
+static_assert(CommonDimension<U311, U306> && !CommonDimension<U311, U310>);
+static_assert(CommonDimension<U312, U307> && !CommonDimension<U312, U311>);
+static_assert(CommonDimension<U313, U308> && !CommonDimension<U313, U312>);
+static_assert(CommonDimension<U314, U309> && !CommonDimension<U314, U313>);
+static_assert(CommonDimension<U315, U310> && !CommonDimension<U315, U314>);
+static_assert(CommonDimension<U316, U311> && !CommonDimension<U316, U315>);
+static_assert(CommonDimension<U317, U312> && !CommonDimension<U317, U316>);
+static_assert(CommonDimension<U318, U313> && !CommonDimension<U318, U317>);
+static_assert(CommonDimension<U319, U314> && !CommonDimension<U319, U318>);
+static_assert(CommonDimension<U320, U315> && !CommonDimension<U320, U319>);
+static_assert(CommonDimension<U321, U316> && !CommonDimension<U321, U320>);
+static_assert(CommonDimension<U322, U317> && !CommonDimension<U322, U321>);
+static_assert(CommonDimension<U323, U318> && !CommonDimension<U323, U322>);
+static_assert(CommonDimension<U324, U319> && !CommonDimension<U324, U323>);
+static_assert(CommonDimension<U325, U320> && !CommonDimension<U325, U324>);
+static_assert(CommonDimension<U326, U321> && !CommonDimension<U326, U325>);
+static_assert(CommonDimension<U327, U322> && !CommonDimension<U327, U326>);
+static_assert(CommonDimension<U328, U323> && !CommonDimension<U328, U327>);
+static_assert(CommonDimension<U329, U324> && !CommonDimension<U329, U328>);
+static_assert(CommonDimension<U330, U325> && !CommonDimension<U330, U329>);
+static_assert(CommonDimension<U331, U326> && !CommonDimension<U331, U330>);
+static_assert(CommonDimension<U332, U327> && !CommonDimension<U332, U331>);
+static_assert(CommonDimension<U333, U328> && !CommonDimension<U333, U332>);
+static_assert(CommonDimension<U334, U329> && !CommonDimension<U334, U333>);
+static_assert(CommonDimension<U335, U330> && !CommonDimension<U335, U334>);
+static_assert(CommonDimension<U336, U331> && !CommonDimension<U336, U335>);
+static_assert(CommonDimension<U337, U332> && !CommonDimension<U337, U336>);
+static_assert(CommonDimension<U338, U333> && !CommonDimension<U338, U337>);
+static_assert(CommonDimension<U339, U334> && !CommonDimension<U339, U338>);
+static_assert(CommonDimension<U340, U335> && !CommonDimension<U340, U339>);
+static_assert(CommonDimension<U341, U336> && !CommonDimension<U341, U340>);
+static_assert(CommonDimension<U342, U337> && !CommonDimension<U342, U341>);
+static_assert(CommonDimension<U343, U338> && !CommonDimension<U343, U342>);
+static_assert(CommonDimension<U344, U339> && !CommonDimension<U344, U343>);
+static_assert(CommonDimension<U345, U340> && !CommonDimension<U345, U344>);
+static_assert(CommonDimension<U346, U341> && !CommonDimension<U346, U345>);
+static_assert(CommonDimension<U347, U342> && !CommonDimension<U347, U346>);
+static_assert(CommonDimension<U348, U343> && !CommonDimension<U348, U347>);
+static_assert(CommonDimension<U349, U344> && !CommonDimension<U349, U348>);
+static_assert(CommonDimension<U350, U345> && !CommonDimension<U350, U349>);
+static_assert(CommonDimension<U351, U346> && !CommonDimension<U351, U350>);
+static_assert(CommonDimension<U352, U347> && !CommonDimension<U352, U351>);
+static_assert(CommonDimension<U353, U348> && !CommonDimension<U353, U352>);
+static_assert(CommonDimension<U354, U349> && !CommonDimension<U354, U353>);
+static_assert(CommonDimension<U355, U350> && !CommonDimension<U355, U354>);
+static_assert(CommonDimension<U356, U351> && !CommonDimension<U356, U355>);
+static_assert(CommonDimension<U357, U352> && !CommonDimension<U357, U356>);
+static_assert(CommonDimension<U358, U353> && !CommonDimension<U358, U357>);
+static_assert(CommonDimension<U359, U354> && !CommonDimension<U359, U358>);
+static_assert(CommonDimension<U360, U355> && !CommonDimension<U360, U359>);
+static_assert(CommonDimension<U361, U356> && !CommonDimension<U361, U360>);
+static_assert(CommonDimension<U362, U357> && !CommonDimension<U362, U361>);
+static_assert(CommonDimension<U363, U358> && !CommonDimension<U363, U362>);
+static_assert(CommonDimension<U364, U359> && !CommonDimension<U364, U363>);
+static_assert(CommonDimension<U365, U360> && !CommonDimension<U365, U364>);
+static_assert(CommonDimension<U366, U361> && !CommonDimension<U366, U365>);
+static_assert(CommonDimension<U367, U362> && !CommonDimension<U367, U366>);
+static_assert(CommonDimension<U368, U363> && !CommonDimension<U368, U367>);
+static_assert(CommonDimension<U369, U364> && !CommonDimension<U369, U368>);
+static_assert(CommonDimension<U370, U365> && !CommonDimension<U370, U369>);
+static_assert(CommonDimension<U371, U366> && !CommonDimension<U371, U370>);
+static_assert(CommonDimension<U372, U367> && !CommonDimension<U372, U371>);
+static_assert(CommonDimension<U373, U368> && !CommonDimension<U373, U372>);
+static_assert(CommonDimension<U374, U369> && !CommonDimension<U374, U373>);
+static_assert(CommonDimension<U375, U370> && !CommonDimension<U375, U374>);
+static_assert(CommonDimension<U376, U371> && !CommonDimension<U376, U375>);
+static_assert(CommonDimension<U377, U372> && !CommonDimension<U377, U376>);
+static_assert(CommonDimension<U378, U373> && !CommonDimension<U378, U377>);
+static_assert(CommonDimension<U379, U374> && !CommonDimension<U379, U378>);
+static_assert(CommonDimension<U380, U375> && !CommonDimension<U380, U379>);
+static_assert(CommonDimension<U381, U376> && !CommonDimension<U381, U380>);
+static_assert(CommonDimension<U382, U377> && !CommonDimension<U382, U381>);
+static_assert(CommonDimension<U383, U378> && !CommonDimension<U383, U382>);
+static_assert(CommonDimension<U384, U379> && !CommonDimension<U384, U383>);
+static_assert(CommonDimension<U385, U380> && !CommonDimension<U385, U384>);
+static_assert(CommonDimension<U386, U381> && !CommonDimension<U386, U385>);
+static_assert(CommonDimension<U387, U382> && !CommonDimension<U387, U386>);
+static_assert(CommonDimension<U388, U383> && !CommonDimension<U388, U387>);
+static_assert(CommonDimension<U389, U384> && !CommonDimension<U389, U388>);
+static_assert(CommonDimension<U390, U385> && !CommonDimension<U390, U389>);
+static_assert(CommonDimension<U391, U386> && !CommonDimension<U391, U390>);
+static_assert(CommonDimension<U392, U387> && !CommonDimension<U392, U391>);
+static_assert(CommonDimension<U393, U388> && !CommonDimension<U393, U392>);
+static_assert(CommonDimension<U394, U389> && !CommonDimension<U394, U393>);
+static_assert(CommonDimension<U395, U390> && !CommonDimension<U395, U394>);
+static_assert(CommonDimension<U396, U391> && !CommonDimension<U396, U395>);
+static_assert(CommonDimension<U397, U392> && !CommonDimension<U397, U396>);
+static_assert(CommonDimension<U398, U393> && !CommonDimension<U398, U397>);
+static_assert(CommonDimension<U399, U394> && !CommonDimension<U399, U398>);
+static_assert(CommonDimension<U400, U395> && !CommonDimension<U400, U399>);
+static_assert(CommonDimension<U401, U396> && !CommonDimension<U401, U400>);
+static_assert(CommonDimension<U402, U397> && !CommonDimension<U402, U401>);
+static_assert(CommonDimension<U403, U398> && !CommonDimension<U403, U402>);
+static_assert(CommonDimension<U404, U399> && !CommonDimension<U404, U403>);
+static_assert(CommonDimension<U405, U400> && !CommonDimension<U405, U404>);
+static_assert(CommonDimension<U406, U401> && !CommonDimension<U406, U405>);
+static_assert(CommonDimension<U407, U402> && !CommonDimension<U407, U406>);
+static_assert(CommonDimension<U408, U403> && !CommonDimension<U408, U407>);
+static_assert(CommonDimension<U409, U404> && !CommonDimension<U409, U408>);
+static_assert(CommonDimension<U410, U405> && !CommonDimension<U410, U409>);
+static_assert(CommonDimension<U411, U406> && !CommonDimension<U411, U410>);
+static_assert(CommonDimension<U412, U407> && !CommonDimension<U412, U411>);
+static_assert(CommonDimension<U413, U408> && !CommonDimension<U413, U412>);
+static_assert(CommonDimension<U414, U409> && !CommonDimension<U414, U413>);
+static_assert(CommonDimension<U415, U410> && !CommonDimension<U415, U414>);
+static_assert(CommonDimension<U416, U411> && !CommonDimension<U416, U415>);
+static_assert(CommonDimension<U417, U412> && !CommonDimension<U417, U416>);
+static_assert(CommonDimension<U418, U413> && !CommonDimension<U418, U417>);
+static_assert(CommonDimension<U419, U414> && !CommonDimension<U419, U418>);
+static_assert(CommonDimension<U420, U415> && !CommonDimension<U420, U419>);
+static_assert(CommonDimension<U421, U416> && !CommonDimension<U421, U420>);
+static_assert(CommonDimension<U422, U417> && !CommonDimension<U422, U421>);
+static_assert(CommonDimension<U423, U418> && !CommonDimension<U423, U422>);
+static_assert(CommonDimension<U424, U419> && !CommonDimension<U424, U423>);
+static_assert(CommonDimension<U425, U420> && !CommonDimension<U425, U424>);
+static_assert(CommonDimension<U426, U421> && !CommonDimension<U426, U425>);
+static_assert(CommonDimension<U427, U422> && !CommonDimension<U427, U426>);
+static_assert(CommonDimension<U428, U423> && !CommonDimension<U428, U427>);
+static_assert(CommonDimension<U429, U424> && !CommonDimension<U429, U428>);
+static_assert(CommonDimension<U430, U425> && !CommonDimension<U430, U429>);
+static_assert(CommonDimension<U431, U426> && !CommonDimension<U431, U430>);
+static_assert(CommonDimension<U432, U427> && !CommonDimension<U432, U431>);
+static_assert(CommonDimension<U433, U428> && !CommonDimension<U433, U432>);
+static_assert(CommonDimension<U434, U429> && !CommonDimension<U434, U433>);
+static_assert(CommonDimension<U435, U430> && !CommonDimension<U435, U434>);
+static_assert(CommonDimension<U436, U431> && !CommonDimension<U436, U435>);
+static_assert(CommonDimension<U437, U432> && !CommonDimension<U437, U436>);
+static_assert(CommonDimension<U438, U433> && !CommonDimension<U438, U437>);
+static_assert(CommonDimension<U439, U434> && !CommonDimension<U439, U438>);
+static_assert(CommonDimension<U440, U435> && !CommonDimension<U440, U439>);
+static_assert(CommonDimension<U441, U436> && !CommonDimension<U441, U440>);
+static_assert(CommonDimension<U442, U437> && !CommonDimension<U442, U441>);
+static_assert(CommonDimension<U443, U438> && !CommonDimension<U443, U442>);
+static_assert(CommonDimension<U444, U439> && !CommonDimension<U444, U443>);
+static_assert(CommonDimension<U445, U440> && !CommonDimension<U445, U444>);
+static_assert(CommonDimension<U446, U441> && !CommonDimension<U446, U445>);
+static_assert(CommonDimension<U447, U442> && !CommonDimension<U447, U446>);
+static_assert(CommonDimension<U448, U443> && !CommonDimension<U448, U447>);
+static_assert(CommonDimension<U449, U444> && !CommonDimension<U449, U448>);
+static_assert(CommonDimension<U450, U445> && !CommonDimension<U450, U449>);
+static_assert(CommonDimension<U451, U446> && !CommonDimension<U451, U450>);
+static_assert(CommonDimension<U452, U447> && !CommonDimension<U452, U451>);
+static_assert(CommonDimension<U453, U448> && !CommonDimension<U453, U452>);
+static_assert(CommonDimension<U454, U449> && !CommonDimension<U454, U453>);
+static_assert(CommonDimension<U455, U450> && !CommonDimension<U455, U454>);
+static_assert(CommonDimension<U456, U451> && !CommonDimension<U456, U455>);
+static_assert(CommonDimension<U457, U452> && !CommonDimension<U457, U456>);
+static_assert(CommonDimension<U458, U453> && !CommonDimension<U458, U457>);
+static_assert(CommonDimension<U459, U454> && !CommonDimension<U459, U458>);
+static_assert(CommonDimension<U460, U455> && !CommonDimension<U460, U459>);
+static_assert(CommonDimension<U461, U456> && !CommonDimension<U461, U460>);
+static_assert(CommonDimension<U462, U457> && !CommonDimension<U462, U461>);
+static_assert(CommonDimension<U463, U458> && !CommonDimension<U463, U462>);
+static_assert(CommonDimension<U464, U459> && !CommonDimension<U464, U463>);
+static_assert(CommonDimension<U465, U460> && !CommonDimension<U465, U464>);
+static_assert(CommonDimension<U466, U461> && !CommonDimension<U466, U465>);
+static_assert(CommonDimension<U467, U462> && !CommonDimension<U467, U466>);
+static_assert(CommonDimension<U468, U463> && !CommonDimension<U468, U467>);
+static_assert(CommonDimension<U469, U464> && !CommonDimension<U469, U468>);
+static_assert(CommonDimension<U470, U465> && !CommonDimension<U470, U469>);
+static_assert(CommonDimension<U471, U466> && !CommonDimension<U471, U470>);
+static_assert(CommonDimension<U472, U467> && !CommonDimension<U472, U471>);
+static_assert(CommonDimension<U473, U468> && !CommonDimension<U473, U472>);
+static_assert(CommonDimension<U474, U469> && !CommonDimension<U474, U473>);
+static_assert(CommonDimension<U475, U470> && !CommonDimension<U475, U474>);
+static_assert(CommonDimension<U476, U471> && !CommonDimension<U476, U475>);
+static_assert(CommonDimension<U477, U472> && !CommonDimension<U477, U476>);
+static_assert(CommonDimension<U478, U473> && !CommonDimension<U478, U477>);
+static_assert(CommonDimension<U479, U474> && !CommonDimension<U479, U478>);
+static_assert(CommonDimension<U480, U475> && !CommonDimension<U480, U479>);
+static_assert(CommonDimension<U481, U476> && !CommonDimension<U481, U480>);
+static_assert(CommonDimension<U482, U477> && !CommonDimension<U482, U481>);
+static_assert(CommonDimension<U483, U478> && !CommonDimension<U483, U482>);
+static_assert(CommonDimension<U484, U479> && !CommonDimension<U484, U483>);
+static_assert(CommonDimension<U485, U480> && !CommonDimension<U485, U484>);
+static_assert(CommonDimension<U486, U481> && !CommonDimension<U486, U485>);
+static_assert(CommonDimension<U487, U482> && !CommonDimension<U487, U486>);
+static_assert(CommonDimension<U488, U483> && !CommonDimension<U488, U487>);
+static_assert(CommonDimension<U489, U484> && !CommonDimension<U489, U488>);
+static_assert(CommonDimension<U490, U485> && !CommonDimension<U490, U489>);
+static_assert(CommonDimension<U491, U486> && !CommonDimension<U491, U490>);
+static_assert(CommonDimension<U492, U487> && !CommonDimension<U492, U491>);
+static_assert(CommonDimension<U493, U488> && !CommonDimension<U493, U492>);
+static_assert(CommonDimension<U494, U489> && !CommonDimension<U494, U493>);
+static_assert(CommonDimension<U495, U490> && !CommonDimension<U495, U494>);
+static_assert(CommonDimension<U496, U491> && !CommonDimension<U496, U495>);
+static_assert(CommonDimension<U497, U492> && !CommonDimension<U497, U496>);
+static_assert(CommonDimension<U498, U493> && !CommonDimension<U498, U497>);
+static_assert(CommonDimension<U499, U494> && !CommonDimension<U499, U498>);
+
+double combine() {
+    double total = 0;
+    total += (quantity<U5> {1.} + quantity<U0> {1.}).amount;
+    total += (quantity<U6> {1.} + quantity<U1> {1.}).amount;
+    total += (quantity<U7> {1.} + quantity<U2> {1.}).amount;
+    total += (quantity<U8> {1.} + quantity<U3> {1.}).amount;
+    total += (quantity<U9> {1.} + quantity<U4> {1.}).amount;
+    total += (quantity<U10> {1.} + quantity<U5> {1.}).amount;
+    total += (quantity<U11> {1.} + quantity<U6> {1.}).amount;
+    total += (quantity<U12> {1.} + quantity<U7> {1.}).amount;
+    total += (quantity<U13> {1.} + quantity<U8> {1.}).amount;
+    total += (quantity<U14> {1.} + quantity<U9> {1.}).amount;
+    total += (quantity<U15> {1.} + quantity<U10> {1.}).amount;
+    total += (quantity<U16> {1.} + quantity<U11> {1.}).amount;
+    total += (quantity<U17> {1.} + quantity<U12> {1.}).amount;
+    total += (quantity<U18> {1.} + quantity<U13> {1.}).amount;
+    total += (quantity<U19> {1.} + quantity<U14> {1.}).amount;
+    total += (quantity<U20> {1.} + quantity<U15> {1.}).amount;
+    total += (quantity<U21> {1.} + quantity<U16> {1.}).amount;
+    total += (quantity<U22> {1.} + quantity<U17> {1.}).amount;
+    total += (quantity<U23> {1.} + quantity<U18> {1.}).amount;
+    total += (quantity<U24> {1.} + quantity<U19> {1.}).amount;
+    total += (quantity<U25> {1.} + quantity<U20> {1.}).amount;
+    total += (quantity<U26> {1.} + quantity<U21> {1.}).amount;
+    total += (quantity<U27> {1.} + quantity<U22> {1.}).amount;
+    total += (quantity<U28> {1.} + quantity<U23> {1.}).amount;
+    total += (quantity<U29> {1.} + quantity<U24> {1.}).amount;
+    total += (quantity<U30> {1.} + quantity<U25> {1.}).amount;
+    total += (quantity<U31> {1.} + quantity<U26> {1.}).amount;
+    total += (quantity<U32> {1.} + quantity<U27> {1.}).amount;
+    total += (quantity<U33> {1.} + quantity<U28> {1.}).amount;
+    total += (quantity<U34> {1.} + quantity<U29> {1.}).amount;
+    total += (quantity<U35> {1.} + quantity<U30> {1.}).amount;
+    total += (quantity<U36> {1.} + quantity<U31> {1.}).amount;
+    total += (quantity<U37> {1.} + quantity<U32> {1.}).amount;
+    total += (quantity<U38> {1.} + quantity<U33> {1.}).amount;
+    total += (quantity<U39> {1.} + quantity<U34> {1.}).amount;
+    total += (quantity<U40> {1.} + quantity<U35> {1.}).amount;
+    total += (quantity<U41> {1.} + quantity<U36> {1.}).amount;
+    total += (quantity<U42> {1.} + quantity<U37> {1.}).amount;
+    total += (quantity<U43> {1.} + quantity<U38> {1.}).amount;
+    total += (quantity<U44> {1.} + quantity<U39> {1.}).amount;
+    total += (quantity<U45> {1.} + quantity<U40> {1.}).amount;
+    total += (quantity<U46> {1.} + quantity<U41> {1.}).amount;
+    total += (quantity<U47> {1.} + quantity<U42> {1.}).amount;
+    total += (quantity<U48> {1.} + quantity<U43> {1.}).amount;
+    total += (quantity<U49> {1.} + quantity<U44> {1.}).amount;
+    total += (quantity<U50> {1.} + quantity<U45> {1.}).amount;
+    total += (quantity<U51> {1.} + quantity<U46> {1.}).amount;
+    total += (quantity<U52> {1.} + quantity<U47> {1.}).amount;
+    total += (quantity<U53> {1.} + quantity<U48> {1.}).amount;
+    total += (quantity<U54> {1.} + quantity<U49> {1.}).amount;
+    total += (quantity<U55> {1.} + quantity<U50> {1.}).amount;
+    total += (quantity<U56> {1.} + quantity<U51> {1.}).amount;
+    total += (quantity<U57> {1.} + quantity<U52> {1.}).amount;
+    total += (quantity<U58> {1.} + quantity<U53> {1.}).amount;
+    total += (quantity<U59> {1.} + quantity<U54> {1.}).amount;
+    total += (quantity<U60> {1.} + quantity<U55> {1.}).amount;
+    total += (quantity<U61> {1.} + quantity<U56> {1.}).amount;
+    total += (quantity<U62> {1.} + quantity<U57> {1.}).amount;
+    total += (quantity<U63> {1.} + quantity<U58> {1.}).amount;
+    total += (quantity<U64> {1.} + quantity<U59> {1.}).amount;
+    total += (quantity<U65> {1.} + quantity<U60> {1.}).amount;
+    total += (quantity<U66> {1.} + quantity<U61> {1.}).amount;
+    total += (quantity<U67> {1.} + quantity<U62> {1.}).amount;
+    total += (quantity<U68> {1.} + quantity<U63> {1.}).amount;
+    total += (quantity<U69> {1.} + quantity<U64> {1.}).amount;
+    total += (quantity<U70> {1.} + quantity<U65> {1.}).amount;
+    total += (quantity<U71> {1.} + quantity<U66> {1.}).amount;
+    total += (quantity<U72> {1.} + quantity<U67> {1.}).amount;
+    total += (quantity<U73> {1.} + quantity<U68> {1.}).amount;
+    total += (quantity<U74> {1.} + quantity<U69> {1.}).amount;
+    total += (quantity<U75> {1.} + quantity<U70> {1.}).amount;
+    total += (quantity<U76> {1.} + quantity<U71> {1.}).amount;
+    total += (quantity<U77> {1.} + quantity<U72> {1.}).amount;
+    total += (quantity<U78> {1.} + quantity<U73> {1.}).amount;
+    total += (quantity<U79> {1.} + quantity<U74> {1.}).amount;
+    total += (quantity<U80> {1.} + quantity<U75> {1.}).amount;
+    total += (quantity<U81> {1.} + quantity<U76> {1.}).amount;
+    total += (quantity<U82> {1.} + quantity<U77> {1.}).amount;
+    total += (quantity<U83> {1.} + quantity<U78> {1.}).amount;
+    total += (quantity<U84> {1.} + quantity<U79> {1.}).amount;
+    total += (quantity<U85> {1.} + quantity<U80> {1.}).amount;
+    total += (quantity<U86> {1.} + quantity<U81> {1.}).amount;
+    total += (quantity<U87> {1.} + quantity<U82> {1.}).amount;
+    total += (quantity<U88> {1.} + quantity<U83> {1.}).amount;
+    total += (quantity<U89> {1.} + quantity<U84> {1.}).amount;
+    total += (quantity<U90> {1.} + quantity<U85> {1.}).amount;
+    total += (quantity<U91> {1.} + quantity<U86> {1.}).amount;
+    total += (quantity<U92> {1.} + quantity<U87> {1.}).amount;
+    total += (quantity<U93> {1.} + quantity<U88> {1.}).amount;
+    total += (quantity<U94> {1.} + quantity<U89> {1.}).amount;
+    total += (quantity<U95> {1.} + quantity<U90> {1.}).amount;
+    total += (quantity<U96> {1.} + quantity<U91> {1.}).amount;
+    total += (quantity<U97> {1.} + quantity<U92> {1.}).amount;
+    total += (quantity<U98> {1.} + quantity<U93> {1.}).amount;
+    total += (quantity<U99> {1.} + quantity<U94> {1.}).amount;
+    total += (quantity<U100> {1.} + quantity<U95> {1.}).amount;
+    total += (quantity<U101> {1.} + quantity<U96> {1.}).amount;
+    total += (quantity<U102> {1.} + quantity<U97> {1.}).amount;
+    total += (quantity<U103> {1.} + quantity<U98> {1.}).amount;
+    total += (quantity<U104> {1.} + quantity<U99> {1.}).amount;
+    total += (quantity<U105> {1.} + quantity<U100> {1.}).amount;
+    total += (quantity<U106> {1.} + quantity<U101> {1.}).amount;
+    total += (quantity<U107> {1.} + quantity<U102> {1.}).amount;
+    total += (quantity<U108> {1.} + quantity<U103> {1.}).amount;
+    total += (quantity<U109> {1.} + quantity<U104> {1.}).amount;
+    total += (quantity<U110> {1.} + quantity<U105> {1.}).amount;
+    total += (quantity<U111> {1.} + quantity<U106> {1.}).amount;
+    total += (quantity<U112> {1.} + quantity<U107> {1.}).amount;
+    total += (quantity<U113> {1.} + quantity<U108> {1.}).amount;
+    total += (quantity<U114> {1.} + quantity<U109> {1.}).amount;
+    total += (quantity<U115> {1.} + quantity<U110> {1.}).amount;
+    total += (quantity<U116> {1.} + quantity<U111> {1.}).amount;
+    total += (quantity<U117> {1.} + quantity<U112> {1.}).amount;
+    total += (quantity<U118> {1.} + quantity<U113> {1.}).amount;
+    total += (quantity<U119> {1.} + quantity<U114> {1.}).amount;
+    total += (quantity<U120> {1.} + quantity<U115> {1.}).amount;
+    total += (quantity<U121> {1.} + quantity<U116> {1.}).amount;
+    total += (quantity<U122> {1.} + quantity<U117> {1.}).amount;
+    total += (quantity<U123> {1.} + quantity<U118> {1.}).amount;
+    total += (quantity<U124> {1.} + quantity<U119> {1.}).amount;
+    total += (quantity<U125> {1.} + quantity<U120> {1.}).amount;
+    total += (quantity<U126> {1.} + quantity<U121> {1.}).amount;
+    total += (quantity<U127> {1.} + quantity<U122> {1.}).amount;
+    total += (quantity<U128> {1.} + quantity<U123> {1.}).amount;
+    total += (quantity<U129> {1.} + quantity<U124> {1.}).amount;
+    total += (quantity<U130> {1.} + quantity<U125> {1.}).amount;
+    total += (quantity<U131> {1.} + quantity<U126> {1.}).amount;
+    total += (quantity<U132> {1.} + quantity<U127> {1.}).amount;
+    total += (quantity<U133> {1.} + quantity<U128> {1.}).amount;
+    total += (quantity<U134> {1.} + quantity<U129> {1.}).amount;
+    total += (quantity<U135> {1.} + quantity<U130> {1.}).amount;
+    total += (quantity<U136> {1.} + quantity<U131> {1.}).amount;
+    total += (quantity<U137> {1.} + quantity<U132> {1.}).amount;
+    total += (quantity<U138> {1.} + quantity<U133> {1.}).amount;
+    total += (quantity<U139> {1.} + quantity<U134> {1.}).amount;
+    total += (quantity<U140> {1.} + quantity<U135> {1.}).amount;
+    total += (quantity<U141> {1.} + quantity<U136> {1.}).amount;
+    total += (quantity<U142> {1.} + quantity<U137> {1.}).amount;
+    total += (quantity<U143> {1.} + quantity<U138> {1.}).amount;
+    total += (quantity<U144> {1.} + quantity<U139> {1.}).amount;
+    total += (quantity<U145> {1.} + quantity<U140> {1.}).amount;
+    total += (quantity<U146> {1.} + quantity<U141> {1.}).amount;
+    total += (quantity<U147> {1.} + quantity<U142> {1.}).amount;
+    total += (quantity<U148> {1.} + quantity<U143> {1.}).amount;
+    total += (quantity<U149> {1.} + quantity<U144> {1.}).amount;
+    total += (quantity<U150> {1.} + quantity<U145> {1.}).amount;
+    total += (quantity<U151> {1.} + quantity<U146> {1.}).amount;
+    total += (quantity<U152> {1.} + quantity<U147> {1.}).amount;
+    total += (quantity<U153> {1.} + quantity<U148> {1.}).amount;
+    total += (quantity<U154> {1.} + quantity<U149> {1.}).amount;
+    total += (quantity<U155> {1.} + quantity<U150> {1.}).amount;
+    total += (quantity<U156> {1.} + quantity<U151> {1.}).amount;
+    total += (quantity<U157> {1.} + quantity<U152> {1.}).amount;
+    total += (quantity<U158> {1.} + quantity<U153> {1.}).amount;
+    total += (quantity<U159> {1.} + quantity<U154> {1.}).amount;
+    total += (quantity<U160> {1.} + quantity<U155> {1.}).amount;
+    total += (quantity<U161> {1.} + quantity<U156> {1.}).amount;
+    total += (quantity<U162> {1.} + quantity<U157> {1.}).amount;
+    total += (quantity<U163> {1.} + quantity<U158> {1.}).amount;
+    total += (quantity<U164> {1.} + quantity<U159> {1.}).amount;
+    total += (quantity<U165> {1.} + quantity<U160> {1.}).amount;
+    total += (quantity<U166> {1.} + quantity<U161> {1.}).amount;
+    total += (quantity<U167> {1.} + quantity<U162> {1.}).amount;
+    total += (quantity<U168> {1.} + quantity<U163> {1.}).amount;
+    total += (quantity<U169> {1.} + quantity<U164> {1.}).amount;
+    total += (quantity<U170> {1.} + quantity<U165> {1.}).amount;
+    total += (quantity<U171> {1.} + quantity<U166> {1.}).amount;
+    total += (quantity<U172> {1.} + quantity<U167> {1.}).amount;
+    total += (quantity<U173> {1.} + quantity<U168> {1.}).amount;
+    total += (quantity<U174> {1.} + quantity<U169> {1.}).amount;
+    total += (quantity<U175> {1.} + quantity<U170> {1.}).amount;
+    total += (quantity<U176> {1.} + quantity<U171> {1.}).amount;
+    total += (quantity<U177> {1.} + quantity<U172> {1.}).amount;
+    total += (quantity<U178> {1.} + quantity<U173> {1.}).amount;
+    total += (quantity<U179> {1.} + quantity<U174> {1.}).amount;
+    total += (quantity<U180> {1.} + quantity<U175> {1.}).amount;
+    total += (quantity<U181> {1.} + quantity<U176> {1.}).amount;
+    total += (quantity<U182> {1.} + quantity<U177> {1.}).amount;
+    total += (quantity<U183> {1.} + quantity<U178> {1.}).amount;
+    total += (quantity<U184> {1.} + quantity<U179> {1.}).amount;
+    total += (quantity<U185> {1.} + quantity<U180> {1.}).amount;
+    total += (quantity<U186> {1.} + quantity<U181> {1.}).amount;
+    total += (quantity<U187> {1.} + quantity<U182> {1.}).amount;
+    total += (quantity<U188> {1.} + quantity<U183> {1.}).amount;
+    total += (quantity<U189> {1.} + quantity<U184> {1.}).amount;
+    total += (quantity<U190> {1.} + quantity<U185> {1.}).amount;
+    total += (quantity<U191> {1.} + quantity<U186> {1.}).amount;
+    total += (quantity<U192> {1.} + quantity<U187> {1.}).amount;
+    total += (quantity<U193> {1.} + quantity<U188> {1.}).amount;
+    total += (quantity<U194> {1.} + quantity<U189> {1.}).amount;
+    total += (quantity<U195> {1.} + quantity<U190> {1.}).amount;
+    total += (quantity<U196> {1.} + quantity<U191> {1.}).amount;
+    total += (quantity<U197> {1.} + quantity<U192> {1.}).amount;
+    total += (quantity<U198> {1.} + quantity<U193> {1.}).amount;
+    total += (quantity<U199> {1.} + quantity<U194> {1.}).amount;
+    total += (quantity<U200> {1.} + quantity<U195> {1.}).amount;
+    total += (quantity<U201> {1.} + quantity<U196> {1.}).amount;
+    total += (quantity<U202> {1.} + quantity<U197> {1.}).amount;
+    total += (quantity<U203> {1.} + quantity<U198> {1.}).amount;
+    total += (quantity<U204> {1.} + quantity<U199> {1.}).amount;
+    total += (quantity<U205> {1.} + quantity<U200> {1.}).amount;
+    total += (quantity<U206> {1.} + quantity<U201> {1.}).amount;
+    total += (quantity<U207> {1.} + quantity<U202> {1.}).amount;
+    total += (quantity<U208> {1.} + quantity<U203> {1.}).amount;
+    total += (quantity<U209> {1.} + quantity<U204> {1.}).amount;
+    total += (quantity<U210> {1.} + quantity<U205> {1.}).amount;
+    total += (quantity<U211> {1.} + quantity<U206> {1.}).amount;
+    total += (quantity<U212> {1.} + quantity<U207> {1.}).amount;
+    total += (quantity<U213> {1.} + quantity<U208> {1.}).amount;
+    total += (quantity<U214> {1.} + quantity<U209> {1.}).amount;
+    total += (quantity<U215> {1.} + quantity<U210> {1.}).amount;
+    total += (quantity<U216> {1.} + quantity<U211> {1.}).amount;
+    total += (quantity<U217> {1.} + quantity<U212> {1.}).amount;
+    total += (quantity<U218> {1.} + quantity<U213> {1.}).amount;
+    total += (quantity<U219> {1.} + quantity<U214> {1.}).amount;
+    total += (quantity<U220> {1.} + quantity<U215> {1.}).amount;
+    total += (quantity<U221> {1.} + quantity<U216> {1.}).amount;
+    total += (quantity<U222> {1.} + quantity<U217> {1.}).amount;
+    total += (quantity<U223> {1.} + quantity<U218> {1.}).amount;
+    total += (quantity<U224> {1.} + quantity<U219> {1.}).amount;
+    total += (quantity<U225> {1.} + quantity<U220> {1.}).amount;
+    total += (quantity<U226> {1.} + quantity<U221> {1.}).amount;
+    total += (quantity<U227> {1.} + quantity<U222> {1.}).amount;
+    total += (quantity<U228> {1.} + quantity<U223> {1.}).amount;
+    total += (quantity<U229> {1.} + quantity<U224> {1.}).amount;
+    total += (quantity<U230> {1.} + quantity<U225> {1.}).amount;
+    total += (quantity<U231> {1.} + quantity<U226> {1.}).amount;
+    total += (quantity<U232> {1.} + quantity<U227> {1.}).amount;
+    total += (quantity<U233> {1.} + quantity<U228> {1.}).amount;
+    total += (quantity<U234> {1.} + quantity<U229> {1.}).amount;
+    total += (quantity<U235> {1.} + quantity<U230> {1.}).amount;
+    total += (quantity<U236> {1.} + quantity<U231> {1.}).amount;
+    total += (quantity<U237> {1.} + quantity<U232> {1.}).amount;
+    total += (quantity<U238> {1.} + quantity<U233> {1.}).amount;
+    total += (quantity<U239> {1.} + quantity<U234> {1.}).amount;
+    total += (quantity<U240> {1.} + quantity<U235> {1.}).amount;
+    total += (quantity<U241> {1.} + quantity<U236> {1.}).amount;
+    total += (quantity<U242> {1.} + quantity<U237> {1.}).amount;
+    total += (quantity<U243> {1.} + quantity<U238> {1.}).amount;
+    total += (quantity<U244> {1.} + quantity<U239> {1.}).amount;
+    total += (quantity<U245> {1.} + quantity<U240> {1.}).amount;
+    total += (quantity<U246> {1.} + quantity<U241> {1.}).amount;
+    total += (quantity<U247> {1.} + quantity<U242> {1.}).amount;
+    total += (quantity<U248> {1.} + quantity<U243> {1.}).amount;
+    total += (quantity<U249> {1.} + quantity<U244> {1.}).amount;
+    total += (quantity<U250> {1.} + quantity<U245> {1.}).amount;
+    total += (quantity<U251> {1.} + quantity<U246> {1.}).amount;
+    total += (quantity<U252> {1.} + quantity<U247> {1.}).amount;
+    total += (quantity<U253> {1.} + quantity<U248> {1.}).amount;
+    total += (quantity<U254> {1.} + quantity<U249> {1.}).amount;
+    total += (quantity<U255> {1.} + quantity<U250> {1.}).amount;
+    total += (quantity<U256> {1.} + quantity<U251> {1.}).amount;
+    total += (quantity<U257> {1.} + quantity<U252> {1.}).amount;
+    total += (quantity<U258> {1.} + quantity<U253> {1.}).amount;
+    total += (quantity<U259> {1.} + quantity<U254> {1.}).amount;
+    total += (quantity<U260> {1.} + quantity<U255> {1.}).amount;
+    total += (quantity<U261> {1.} + quantity<U256> {1.}).amount;
+    total += (quantity<U262> {1.} + quantity<U257> {1.}).amount;
+    total += (quantity<U263> {1.} + quantity<U258> {1.}).amount;
+    total += (quantity<U264> {1.} + quantity<U259> {1.}).amount;
+    total += (quantity<U265> {1.} + quantity<U260> {1.}).amount;
+    total += (quantity<U266> {1.} + quantity<U261> {1.}).amount;
+    total += (quantity<U267> {1.} + quantity<U262> {1.}).amount;
+    total += (quantity<U268> {1.} + quantity<U263> {1.}).amount;
+    total += (quantity<U269> {1.} + quantity<U264> {1.}).amount;
+    total += (quantity<U270> {1.} + quantity<U265> {1.}).amount;
+    total += (quantity<U271> {1.} + quantity<U266> {1.}).amount;
+    total += (quantity<U272> {1.} + quantity<U267> {1.}).amount;
+    total += (quantity<U273> {1.} + quantity<U268> {1.}).amount;
+    total += (quantity<U274> {1.} + quantity<U269> {1.}).amount;
+    total += (quantity<U275> {1.} + quantity<U270> {1.}).amount;
+    total += (quantity<U276> {1.} + quantity<U271> {1.}).amount;
+    total += (quantity<U277> {1.} + quantity<U272> {1.}).amount;
+    total += (quantity<U278> {1.} + quantity<U273> {1.}).amount;
+    total += (quantity<U279> {1.} + quantity<U274> {1.}).amount;
+    total += (quantity<U280> {1.} + quantity<U275> {1.}).amount;
+    total += (quantity<U281> {1.} + quantity<U276> {1.}).amount;
+    total += (quantity<U282> {1.} + quantity<U277> {1.}).amount;
+    total += (quantity<U283> {1.} + quantity<U278> {1.}).amount;
+    total += (quantity<U284> {1.} + quantity<U279> {1.}).amount;
+    total += (quantity<U285> {1.} + quantity<U280> {1.}).amount;
+    total += (quantity<U286> {1.} + quantity<U281> {1.}).amount;
+    total += (quantity<U287> {1.} + quantity<U282> {1.}).amount;
+    total += (quantity<U288> {1.} + quantity<U283> {1.}).amount;
+    total += (quantity<U289> {1.} + quantity<U284> {1.}).amount;
+    total += (quantity<U290> {1.} + quantity<U285> {1.}).amount;
+    total += (quantity<U291> {1.} + quantity<U286> {1.}).amount;
+    total += (quantity<U292> {1.} + quantity<U287> {1.}).amount;
+    total += (quantity<U293> {1.} + quantity<U288> {1.}).amount;
+    total += (quantity<U294> {1.} + quantity<U289> {1.}).amount;
+    total += (quantity<U295> {1.} + quantity<U290> {1.}).amount;
+    total += (quantity<U296> {1.} + quantity<U291> {1.}).amount;
+    total += (quantity<U297> {1.} + quantity<U292> {1.}).amount;
+    total += (quantity<U298> {1.} + quantity<U293> {1.}).amount;
+    total += (quantity<U299> {1.} + quantity<U294> {1.}).amount;
+    total += (quantity<U300> {1.} + quantity<U295> {1.}).amount;
+    total += (quantity<U301> {1.} + quantity<U296> {1.}).amount;
+    total += (quantity<U302> {1.} + quantity<U297> {1.}).amount;
+    total += (quantity<U303> {1.} + quantity<U298> {1.}).amount;
+    total += (quantity<U304> {1.} + quantity<U299> {1.}).amount;
+    total += (quantity<U305> {1.} + quantity<U300> {1.}).amount;
+    total += (quantity<U306> {1.} + quantity<U301> {1.}).amount;
+    total += (quantity<U307> {1.} + quantity<U302> {1.}).amount;
+    total += (quantity<U308> {1.} + quantity<U303> {1.}).amount;
+    total += (quantity<U309> {1.} + quantity<U304> {1.}).amount;
+    total += (quantity<U310> {1.} + quantity<U305> {1.}).amount;
+    total += (quantity<U311> {1.} + quantity<U306> {1.}).amount;
+    total += (quantity<U312> {1.} + quantity<U307> {1.}).amount;
+    total += (quantity<U313> {1.} + quantity<U308> {1.}).amount;
+    total += (quantity<U314> {1.} + quantity<U309> {1.}).amount;
+    total += (quantity<U315> {1.} + quantity<U310> {1.}).amount;
+    total += (quantity<U316> {1.} + quantity<U311> {1.}).amount;
+    total += (quantity<U317> {1.} + quantity<U312> {1.}).amount;
+    total += (quantity<U318> {1.} + quantity<U313> {1.}).amount;
+    total += (quantity<U319> {1.} + quantity<U314> {1.}).amount;
+    total += (quantity<U320> {1.} + quantity<U315> {1.}).amount;
+    total += (quantity<U321> {1.} + quantity<U316> {1.}).amount;
+    total += (quantity<U322> {1.} + quantity<U317> {1.}).amount;
+    total += (quantity<U323> {1.} + quantity<U318> {1.}).amount;
+    total += (quantity<U324> {1.} + quantity<U319> {1.}).amount;
+    total += (quantity<U325> {1.} + quantity<U320> {1.}).amount;
+    total += (quantity<U326> {1.} + quantity<U321> {1.}).amount;
+    total += (quantity<U327> {1.} + quantity<U322> {1.}).amount;
+    total += (quantity<U328> {1.} + quantity<U323> {1.}).amount;
+    total += (quantity<U329> {1.} + quantity<U324> {1.}).amount;
+    total += (quantity<U330> {1.} + quantity<U325> {1.}).amount;
+    total += (quantity<U331> {1.} + quantity<U326> {1.}).amount;
+    total += (quantity<U332> {1.} + quantity<U327> {1.}).amount;
+    total += (quantity<U333> {1.} + quantity<U328> {1.}).amount;
+    total += (quantity<U334> {1.} + quantity<U329> {1.}).amount;
+    total += (quantity<U335> {1.} + quantity<U330> {1.}).amount;
+    total += (quantity<U336> {1.} + quantity<U331> {1.}).amount;
+    total += (quantity<U337> {1.} + quantity<U332> {1.}).amount;
+    total += (quantity<U338> {1.} + quantity<U333> {1.}).amount;
+    total += (quantity<U339> {1.} + quantity<U334> {1.}).amount;
+    total += (quantity<U340> {1.} + quantity<U335> {1.}).amount;
+    total += (quantity<U341> {1.} + quantity<U336> {1.}).amount;
+    total += (quantity<U342> {1.} + quantity<U337> {1.}).amount;
+    total += (quantity<U343> {1.} + quantity<U338> {1.}).amount;
+    total += (quantity<U344> {1.} + quantity<U339> {1.}).amount;
+    total += (quantity<U345> {1.} + quantity<U340> {1.}).amount;
+    total += (quantity<U346> {1.} + quantity<U341> {1.}).amount;
+    total += (quantity<U347> {1.} + quantity<U342> {1.}).amount;
+    total += (quantity<U348> {1.} + quantity<U343> {1.}).amount;
+    total += (quantity<U349> {1.} + quantity<U344> {1.}).amount;
+    total += (quantity<U350> {1.} + quantity<U345> {1.}).amount;
+    total += (quantity<U351> {1.} + quantity<U346> {1.}).amount;
+    total += (quantity<U352> {1.} + quantity<U347> {1.}).amount;
+    total += (quantity<U353> {1.} + quantity<U348> {1.}).amount;
+    total += (quantity<U354> {1.} + quantity<U349> {1.}).amount;
+    total += (quantity<U355> {1.} + quantity<U350> {1.}).amount;
+    total += (quantity<U356> {1.} + quantity<U351> {1.}).amount;
+    total += (quantity<U357> {1.} + quantity<U352> {1.}).amount;
+    total += (quantity<U358> {1.} + quantity<U353> {1.}).amount;
+    total += (quantity<U359> {1.} + quantity<U354> {1.}).amount;
+    total += (quantity<U360> {1.} + quantity<U355> {1.}).amount;
+    total += (quantity<U361> {1.} + quantity<U356> {1.}).amount;
+    total += (quantity<U362> {1.} + quantity<U357> {1.}).amount;
+    total += (quantity<U363> {1.} + quantity<U358> {1.}).amount;
+    total += (quantity<U364> {1.} + quantity<U359> {1.}).amount;
+    total += (quantity<U365> {1.} + quantity<U360> {1.}).amount;
+    total += (quantity<U366> {1.} + quantity<U361> {1.}).amount;
+    total += (quantity<U367> {1.} + quantity<U362> {1.}).amount;
+    total += (quantity<U368> {1.} + quantity<U363> {1.}).amount;
+    total += (quantity<U369> {1.} + quantity<U364> {1.}).amount;
+    total += (quantity<U370> {1.} + quantity<U365> {1.}).amount;
+    total += (quantity<U371> {1.} + quantity<U366> {1.}).amount;
+    total += (quantity<U372> {1.} + quantity<U367> {1.}).amount;
+    total += (quantity<U373> {1.} + quantity<U368> {1.}).amount;
+    total += (quantity<U374> {1.} + quantity<U369> {1.}).amount;
+    total += (quantity<U375> {1.} + quantity<U370> {1.}).amount;
+    total += (quantity<U376> {1.} + quantity<U371> {1.}).amount;
+    total += (quantity<U377> {1.} + quantity<U372> {1.}).amount;
+    total += (quantity<U378> {1.} + quantity<U373> {1.}).amount;
+    total += (quantity<U379> {1.} + quantity<U374> {1.}).amount;
+    total += (quantity<U380> {1.} + quantity<U375> {1.}).amount;
+    total += (quantity<U381> {1.} + quantity<U376> {1.}).amount;
+    total += (quantity<U382> {1.} + quantity<U377> {1.}).amount;
+    total += (quantity<U383> {1.} + quantity<U378> {1.}).amount;
+    total += (quantity<U384> {1.} + quantity<U379> {1.}).amount;
+    total += (quantity<U385> {1.} + quantity<U380> {1.}).amount;
+    total += (quantity<U386> {1.} + quantity<U381> {1.}).amount;
+    total += (quantity<U387> {1.} + quantity<U382> {1.}).amount;
+    total += (quantity<U388> {1.} + quantity<U383> {1.}).amount;
+    total += (quantity<U389> {1.} + quantity<U384> {1.}).amount;
+    total += (quantity<U390> {1.} + quantity<U385> {1.}).amount;
+    total += (quantity<U391> {1.} + quantity<U386> {1.}).amount;
+    total += (quantity<U392> {1.} + quantity<U387> {1.}).amount;
+    total += (quantity<U393> {1.} + quantity<U388> {1.}).amount;
+    total += (quantity<U394> {1.} + quantity<U389> {1.}).amount;
+    total += (quantity<U395> {1.} + quantity<U390> {1.}).amount;
+    total += (quantity<U396> {1.} + quantity<U391> {1.}).amount;
+    total += (quantity<U397> {1.} + quantity<U392> {1.}).amount;
+    total += (quantity<U398> {1.} + quantity<U393> {1.}).amount;
+    total += (quantity<U399> {1.} + quantity<U394> {1.}).amount;
+    total += (quantity<U400> {1.} + quantity<U395> {1.}).amount;
+    total += (quantity<U401> {1.} + quantity<U396> {1.}).amount;
+    total += (quantity<U402> {1.} + quantity<U397> {1.}).amount;
+    total += (quantity<U403> {1.} + quantity<U398> {1.}).amount;
+    total += (quantity<U404> {1.} + quantity<U399> {1.}).amount;
+    total += (quantity<U405> {1.} + quantity<U400> {1.}).amount;
+    total += (quantity<U406> {1.} + quantity<U401> {1.}).amount;
+    total += (quantity<U407> {1.} + quantity<U402> {1.}).amount;
+    total += (quantity<U408> {1.} + quantity<U403> {1.}).amount;
+    total += (quantity<U409> {1.} + quantity<U404> {1.}).amount;
+    total += (quantity<U410> {1.} + quantity<U405> {1.}).amount;
+    total += (quantity<U411> {1.} + quantity<U406> {1.}).amount;
+    total += (quantity<U412> {1.} + quantity<U407> {1.}).amount;
+    total += (quantity<U413> {1.} + quantity<U408> {1.}).amount;
+    total += (quantity<U414> {1.} + quantity<U409> {1.}).amount;
+    total += (quantity<U415> {1.} + quantity<U410> {1.}).amount;
+    total += (quantity<U416> {1.} + quantity<U411> {1.}).amount;
+    total += (quantity<U417> {1.} + quantity<U412> {1.}).amount;
+    total += (quantity<U418> {1.} + quantity<U413> {1.}).amount;
+    total += (quantity<U419> {1.} + quantity<U414> {1.}).amount;
+    total += (quantity<U420> {1.} + quantity<U415> {1.}).amount;
+    total += (quantity<U421> {1.} + quantity<U416> {1.}).amount;
+    total += (quantity<U422> {1.} + quantity<U417> {1.}).amount;
+    total += (quantity<U423> {1.} + quantity<U418> {1.}).amount;
+    total += (quantity<U424> {1.} + quantity<U419> {1.}).amount;
+    total += (quantity<U425> {1.} + quantity<U420> {1.}).amount;
+    total += (quantity<U426> {1.} + quantity<U421> {1.}).amount;
+    total += (quantity<U427> {1.} + quantity<U422> {1.}).amount;
+    total += (quantity<U428> {1.} + quantity<U423> {1.}).amount;
+    total += (quantity<U429> {1.} + quantity<U424> {1.}).amount;
+    total += (quantity<U430> {1.} + quantity<U425> {1.}).amount;
+    total += (quantity<U431> {1.} + quantity<U426> {1.}).amount;
+    total += (quantity<U432> {1.} + quantity<U427> {1.}).amount;
+    total += (quantity<U433> {1.} + quantity<U428> {1.}).amount;
+    total += (quantity<U434> {1.} + quantity<U429> {1.}).amount;
+    total += (quantity<U435> {1.} + quantity<U430> {1.}).amount;
+    total += (quantity<U436> {1.} + quantity<U431> {1.}).amount;
+    total += (quantity<U437> {1.} + quantity<U432> {1.}).amount;
+    total += (quantity<U438> {1.} + quantity<U433> {1.}).amount;
+    total += (quantity<U439> {1.} + quantity<U434> {1.}).amount;
+    total += (quantity<U440> {1.} + quantity<U435> {1.}).amount;
+    total += (quantity<U441> {1.} + quantity<U436> {1.}).amount;
+    total += (quantity<U442> {1.} + quantity<U437> {1.}).amount;
+    total += (quantity<U443> {1.} + quantity<U438> {1.}).amount;
+    total += (quantity<U444> {1.} + quantity<U439> {1.}).amount;
+    total += (quantity<U445> {1.} + quantity<U440> {1.}).amount;
+    total += (quantity<U446> {1.} + quantity<U441> {1.}).amount;
+    total += (quantity<U447> {1.} + quantity<U442> {1.}).amount;
+    total += (quantity<U448> {1.} + quantity<U443> {1.}).amount;
+    total += (quantity<U449> {1.} + quantity<U444> {1.}).amount;
+    total += (quantity<U450> {1.} + quantity<U445> {1.}).amount;
+    total += (quantity<U451> {1.} + quantity<U446> {1.}).amount;
+    total += (quantity<U452> {1.} + quantity<U447> {1.}).amount;
+    total += (quantity<U453> {1.} + quantity<U448> {1.}).amount;
+    total += (quantity<U454> {1.} + quantity<U449> {1.}).amount;
+    total += (quantity<U455> {1.} + quantity<U450> {1.}).amount;
+    total += (quantity<U456> {1.} + quantity<U451> {1.}).amount;
+    total += (quantity<U457> {1.} + quantity<U452> {1.}).amount;
+    total += (quantity<U458> {1.} + quantity<U453> {1.}).amount;
+    total += (quantity<U459> {1.} + quantity<U454> {1.}).amount;
+    total += (quantity<U460> {1.} + quantity<U455> {1.}).amount;
+    total += (quantity<U461> {1.} + quantity<U456> {1.}).amount;
+    total += (quantity<U462> {1.} + quantity<U457> {1.}).amount;
+    total += (quantity<U463> {1.} + quantity<U458> {1.}).amount;
+    total += (quantity<U464> {1.} + quantity<U459> {1.}).amount;
+    total += (quantity<U465> {1.} + quantity<U460> {1.}).amount;
+    total += (quantity<U466> {1.} + quantity<U461> {1.}).amount;
+    total += (quantity<U467> {1.} + quantity<U462> {1.}).amount;
+    total += (quantity<U468> {1.} + quantity<U463> {1.}).amount;
+    total += (quantity<U469> {1.} + quantity<U464> {1.}).amount;
+    total += (quantity<U470> {1.} + quantity<U465> {1.}).amount;
+    total += (quantity<U471> {1.} + quantity<U466> {1.}).amount;
+    total += (quantity<U472> {1.} + quantity<U467> {1.}).amount;
+    total += (quantity<U473> {1.} + quantity<U468> {1.}).amount;
+    total += (quantity<U474> {1.} + quantity<U469> {1.}).amount;
+    total += (quantity<U475> {1.} + quantity<U470> {1.}).amount;
+    total += (quantity<U476> {1.} + quantity<U471> {1.}).amount;
+    total += (quantity<U477> {1.} + quantity<U472> {1.}).amount;
+    total += (quantity<U478> {1.} + quantity<U473> {1.}).amount;
+    total += (quantity<U479> {1.} + quantity<U474> {1.}).amount;
+    total += (quantity<U480> {1.} + quantity<U475> {1.}).amount;
+    total += (quantity<U481> {1.} + quantity<U476> {1.}).amount;
+    total += (quantity<U482> {1.} + quantity<U477> {1.}).amount;
+    total += (quantity<U483> {1.} + quantity<U478> {1.}).amount;
+    total += (quantity<U484> {1.} + quantity<U479> {1.}).amount;
+    total += (quantity<U485> {1.} + quantity<U480> {1.}).amount;
+    total += (quantity<U486> {1.} + quantity<U481> {1.}).amount;
+    total += (quantity<U487> {1.} + quantity<U482> {1.}).amount;
+    total += (quantity<U488> {1.} + quantity<U483> {1.}).amount;
+    total += (quantity<U489> {1.} + quantity<U484> {1.}).amount;
+    total += (quantity<U490> {1.} + quantity<U485> {1.}).amount;
+    total += (quantity<U491> {1.} + quantity<U486> {1.}).amount;
+    total += (quantity<U492> {1.} + quantity<U487> {1.}).amount;
+    total += (quantity<U493> {1.} + quantity<U488> {1.}).amount;
+    total += (quantity<U494> {1.} + quantity<U489> {1.}).amount;
+    total += (quantity<U495> {1.} + quantity<U490> {1.}).amount;
+    total += (quantity<U496> {1.} + quantity<U491> {1.}).amount;
+    total += (quantity<U497> {1.} + quantity<U492> {1.}).amount;
+    total += (quantity<U498> {1.} + quantity<U493> {1.}).amount;
+    total += (quantity<U499> {1.} + quantity<U494> {1.}).amount;
+    return total;
+}
+
+int main() {
+    return combine() > 0 ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+/**
+* Benchmarks of the Fast Fourier Transforms of the math library
+*/
+
+#include "bench.h"
+
+import math;
+
+using namespace zero::math;
+
+namespace {
+    std::vector<std::complex<double>> signal(std::size_t size) {
+        std::vector<std::complex<double>> values(size);
+        for (std::size_t i = 0; i < size; ++i)
+            values[i] = {std::sin(0.3 * static_cast<double>(i)), std::cos(0.7 * static_cast<double>(i % 17))};
+        return values;
+    }
+
+    /// The naive transform, for the small sizes
+    void dft(std::span<const std::complex<double>> in, std::span<std::complex<double>> out) {
+        const std::size_t n = in.size();
+        for (std::size_t k = 0; k < n; ++k) {
+            std::complex<double> sum {};
+            for (std::size_t j = 0; j < n; ++j)
+                sum += in[j] * std::polar(1.0, -2 * std::numbers::pi * static_cast<double>(j * k % n) / static_cast<double>(n));
+            out[k] = sum;
+        }
+    }
+}
+
+void fft_benchmarks() {
+    bench::section("FFT, per point");
+    for (const std::size_t size : std::to_array<std::size_t>({64, 1000, 1009, 1024, 1 << 14, 1 << 16, 1 << 20, 1 << 24})) {
+        const auto in = signal(size);
+        std::vector<std::complex<double>> out(size);
+        fft<double>(in, out); // Builds and caches the plan
+        bench::run(zero::fmt::formatter("fft of {} points", size), size, [&] { fft<double>(in, out); bench::keep(out.front()); });
+        if (size <= 1024)
+            bench::run(zero::fmt::formatter("naive DFT of {} points", size), size, [&] { dft(in, out); bench::keep(out.front()); });
+    }
+
+    for (const std::size_t size : std::to_array<std::size_t>({1024, 1 << 16, 1 << 20})) {
+        std::vector<double> in(size);
+        for (std::size_t i = 0; i < size; ++i)
+            in[i] = std::sin(0.3 * static_cast<double>(i));
+        std::vector<std::complex<double>> out(size / 2 + 1);
+        rfft<double>(in, out);
+        bench::run(zero::fmt::formatter("rfft of {} points", size), size, [&] { rfft<double>(in, out); bench::keep(out.front()); });
+    }
+
+    // Sweeps the thread count up to twice the cores, on a batch that parallel_batches splits over up to 32 threads
+    bench::section("fft_batch thread scaling, per point");
+    constexpr std::size_t signals = 1024;
+    constexpr std::size_t size = 1024;
+    const auto batch = signal(signals * size);
+    std::vector<std::complex<double>> out(batch.size());
+    const std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    double single = 0;
+    for (std::size_t threads = 1; threads <= 2 * cores; threads *= 2) {
+        const double time = bench::run(zero::fmt::formatter("fft_batch of {} x {} points on {} thread(s)", signals, size, threads),
+            batch.size(), [&] { fft_batch<double>(batch, out, size, threads); bench::keep(out.front()); });
+        if (threads == 1)
+            single = time;
+        else
+            zero::fmt::println("  {:<56} {:>12.2f}x on {} core(s)", "speedup over 1 thread", single / time, cores);
+    }
+}
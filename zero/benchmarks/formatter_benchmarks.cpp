@@ -0,0 +1,69 @@
+/**
+* Benchmarks of the formatter, against the standard streams, snprintf and std::format, when the standard
+* library implements it
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <version>
+
+using namespace zero::fmt;
+
+void formatter_benchmarks() {
+    bench::section("Formatting a line with a string, two integers and a double, per line");
+    const std::string name = "sensor";
+    const int id = bench::opaque(42);
+    const long count = bench::opaque(123456789L);
+    const double value = bench::opaque(3.14159265);
+
+    bench::run("zero::fmt::formatter", 1, [&] {
+        bench::keep(formatter("{} #{}: {} readings, mean {:.3f}", name, id, count, value));
+    });
+    bench::run("zero::fmt::formatter, with widths and alignment", 1, [&] {
+        bench::keep(formatter("{:<10}|{:>4}|{:>12}|{:>10.3f}", name, id, count, value));
+    });
+    const std::string path(200, '/');
+    bench::run("zero::fmt::formatter, with a 200 characters string", 1, [&] {
+        bench::keep(formatter("{} #{}: {} readings from {}", name, id, count, path));
+    });
+    bench::run("std::ostringstream", 1, [&] {
+        std::ostringstream out;
+        out << name << " #" << id << ": " << count << " readings, mean " << std::fixed << std::setprecision(3) << value;
+        bench::keep(std::move(out).str());
+    });
+    bench::run("snprintf into a std::string", 1, [&] {
+        std::array<char, 128> line {};
+        const int size = std::snprintf(line.data(), line.size(), "%s #%d: %ld readings, mean %.3f", name.c_str(), id, count, value);
+        bench::keep(std::string {line.data(), static_cast<std::size_t>(size)});
+    });
+#if defined(__cpp_lib_format)
+    bench::run("std::format", 1, [&] {
+        bench::keep(std::format("{} #{}: {} readings, mean {:.3f}", name, id, count, value));
+    });
+    bench::run("std::format, with widths and alignment", 1, [&] {
+        bench::keep(std::format("{:<10}|{:>4}|{:>12}|{:>10.3f}", name, id, count, value));
+    });
+#endif
+
+    bench::section("Formatting into a caller provided buffer, per line");
+    std::array<char, 128> buffer {};
+    bench::run("zero::fmt::format_to", 1, [&] {
+        bench::keep(*format_to(buffer.data(), "{} #{}: {} readings, mean {:.3f}", name, id, count, value));
+    });
+    bench::run("snprintf", 1, [&] {
+        bench::keep(std::snprintf(buffer.data(), buffer.size(), "%s #%d: %ld readings, mean %.3f", name.c_str(), id, count, value));
+    });
+#if defined(__cpp_lib_format)
+    bench::run("std::format_to_n", 1, [&] {
+        bench::keep(std::format_to_n(buffer.data(), buffer.size(), "{} #{}: {} readings, mean {:.3f}", name, id, count, value).size);
+    });
+#endif
+
+    bench::section("Formatting a double in its shortest round-trip representation, per number");
+    bench::run("zero::fmt::format_to, {}", 1, [&] { bench::keep(*format_to(buffer.data(), "{}", bench::opaque(value))); });
+    bench::run("snprintf, %.17g", 1, [&] { bench::keep(std::snprintf(buffer.data(), buffer.size(), "%.17g", bench::opaque(value))); });
+#if defined(__cpp_lib_format)
+    bench::run("std::format_to, {}", 1, [&] { bench::keep(*std::format_to(buffer.data(), "{}", bench::opaque(value))); });
+#endif
+}
@@ -0,0 +1,82 @@
+/**
+* Benchmarks of the logger, against writing every message synchronously under a lock
+*/
+
+#include "bench.h"
+
+import log;
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+using namespace zero::log;
+
+namespace {
+    constexpr int producers = 16;
+    constexpr int messages = 20'000;
+
+    /**
+     * Logs `messages` messages from each of the `producers` threads with `log_one`, and records how long every call
+     * keeps its thread busy
+     */
+    template <typename Log>
+    std::vector<std::int64_t> latencies(Log&& log_one) {
+        using clock = std::chrono::steady_clock;
+        std::vector<std::vector<std::int64_t>> per_thread(producers);
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < producers; ++thread)
+            threads.emplace_back([&, thread] {
+                auto& own = per_thread[static_cast<std::size_t>(thread)];
+                own.reserve(messages);
+                for (int message = 0; message < messages; ++message) {
+                    const auto start = clock::now();
+                    log_one(thread, message);
+                    own.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count());
+                }
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        std::vector<std::int64_t> all;
+        for (const auto& own : per_thread)
+            all.insert(all.end(), own.begin(), own.end());
+        return all;
+    }
+}
+
+void log_benchmarks() {
+    const int null = ::open("/dev/null", O_WRONLY);
+    if (null < 0)
+        return;
+
+    bench::section(zero::fmt::formatter("Logging from {} threads to /dev/null, latency of a call", producers));
+    {
+        logger log {{.fd = null, .policy = overflow_policy::block}};
+        auto calls = latencies([&](int thread, int message) { log.info("thread {} message {} value {:.3f}", thread, message, 0.5); });
+        bench::percentiles("zero::log::logger, block policy", calls);
+    }
+    {
+        logger log {{.fd = null, .policy = overflow_policy::drop}};
+        auto calls = latencies([&](int thread, int message) { log.info("thread {} message {} value {:.3f}", thread, message, 0.5); });
+        bench::percentiles("zero::log::logger, drop policy", calls);
+    }
+    {
+        std::mutex lock;
+        auto calls = latencies([&](int thread, int message) {
+            std::array<char, 128> line {};
+            const int size = std::snprintf(line.data(), line.size(), "[INFO ] thread %d message %d value %.3f\n", thread, message, 0.5);
+            const std::scoped_lock guard {lock};
+            bench::keep(::write(null, line.data(), static_cast<std::size_t>(size)));
+        });
+        bench::percentiles("snprintf and write under a mutex", calls);
+    }
+
+    bench::section("Logging from a single thread with a full queue, per message, bounded by the background thread");
+    {
+        logger log {{.fd = null, .policy = overflow_policy::block}};
+        bench::run("zero::log::logger, 2 integers and a double", 1, [&] { log.info("thread {} message {} value {:.3f}", 1, 2, 0.5); });
+    }
+
+    ::close(null);
+}
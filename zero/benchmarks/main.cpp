@@ -0,0 +1,25 @@
+/**
+* The benchmarks of the project, built and run with `zork++ --match-files bench_linux -c run`
+*/
+
+#include "bench.h"
+
+// Forward decls
+void big_int_benchmarks();
+void random_benchmarks();
+void fft_benchmarks();
+void quantities_benchmarks();
+void str_manip_benchmarks();
+void formatter_benchmarks();
+void log_benchmarks();
+
+int main() {
+    big_int_benchmarks();
+    random_benchmarks();
+    fft_benchmarks();
+    quantities_benchmarks();
+    str_manip_benchmarks();
+    formatter_benchmarks();
+    log_benchmarks();
+    return 0;
+}
@@ -0,0 +1,153 @@
+/**
+* Benchmarks of the physical quantities, against the same arithmetic over raw numbers
+*/
+
+#include "bench.h"
+
+import physics;
+import str_manip;
+
+using namespace zero::physics;
+
+namespace {
+    constexpr std::size_t count = 4096;
+
+    template <typename T>
+    std::vector<T> amounts(T first) {
+        std::vector<T> values(count);
+        for (std::size_t i = 0; i < count; ++i)
+            values[i] = static_cast<T>(first + static_cast<T>(i % 100));
+        return values;
+    }
+
+    template <typename M, typename T>
+    std::vector<quantity<M, T>> readings(T first) {
+        std::vector<quantity<M, T>> values;
+        for (const T amount : amounts(first))
+            values.emplace_back(amount);
+        return values;
+    }
+}
+
+void quantities_benchmarks() {
+    bench::section("Quantities, per operation");
+    {
+        const auto lhs = readings<MetersPerSecond>(1.5);
+        const auto rhs = readings<KilometersPerHour>(2.5);
+        const auto raw_lhs = amounts(1.5);
+        const auto raw_rhs = amounts(2.5);
+        std::vector<quantity<KilometersPerHour>> out(count);
+        std::vector<double> raw_out(count);
+        bench::run("m/s + km/h as quantities", count, [&] {
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = lhs[i] + rhs[i];
+            bench::keep(out.front());
+        });
+        bench::run("m/s + km/h as doubles, converted by hand", count, [&] {
+            for (std::size_t i = 0; i < count; ++i)
+                raw_out[i] = raw_lhs[i] * 3.6 + raw_rhs[i];
+            bench::keep(raw_out.front());
+        });
+    }
+    {
+        const auto speeds = readings<MetersPerSecond>(1.5);
+        const auto raw_speeds = amounts(1.5);
+        std::vector<quantity<KilometersPerHour>> out(count);
+        std::vector<double> raw_out(count);
+        bench::run("to<KilometersPerHour>() of every m/s", count, [&] {
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = speeds[i].to<KilometersPerHour>();
+            bench::keep(out.front());
+        });
+        bench::run("convert<KilometersPerHour> of a span of m/s", count, [&] {
+            convert<KilometersPerHour>(std::span {speeds}, std::span {out});
+            bench::keep(out.front());
+        });
+        bench::run("convert<MetersPerSecond, KilometersPerHour> of doubles", count, [&] {
+            convert<MetersPerSecond, KilometersPerHour>(std::span<const double> {raw_speeds}, std::span {raw_out});
+            bench::keep(raw_out.front());
+        });
+        // The terms of both scales applied one after another, as the conversions used to be
+        const double from_num = bench::opaque(1.0);
+        const double from_den = bench::opaque(1.0);
+        const double to_num = bench::opaque(1000.0);
+        const double to_den = bench::opaque(3600.0);
+        bench::run("m/s to km/h as four dependent operations", count, [&] {
+            for (std::size_t i = 0; i < count; ++i)
+                raw_out[i] = raw_speeds[i] * from_num / from_den * to_den / to_num;
+            bench::keep(raw_out.front());
+        });
+    }
+    {
+        const auto lhs = readings<Kilogram>(3L);
+        const auto rhs = readings<Hectogram>(7L);
+        std::vector<quantity<Hectogram, long>> out(count);
+        bench::run("kg + hg with long amounts, exact in hg", count, [&] {
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = lhs[i] + rhs[i];
+            bench::keep(out.front());
+        });
+    }
+
+    bench::section("Formatting quantities, per quantity");
+    {
+        const auto speeds = readings<KilometersPerHour>(12.345);
+        std::array<char, 128> buffer {};
+        bench::run("to_chars of km/h", count, [&] {
+            for (const auto& speed : speeds)
+                bench::keep(to_chars(buffer.data(), buffer.data() + buffer.size(), speed).ptr);
+        });
+        bench::run("format_to of km/h into a buffer", count, [&] {
+            for (const auto& speed : speeds)
+                bench::keep(format_to(buffer.data(), speed));
+        });
+        bench::run("zero::fmt::formatter(\"{}\") of km/h", count, [&] {
+            for (const auto& speed : speeds)
+                bench::keep(zero::fmt::formatter("{}", speed));
+        });
+        bench::run("std::ostringstream << km/h", count, [&] {
+            for (const auto& speed : speeds) {
+                std::ostringstream out;
+                out << speed;
+                bench::keep(std::move(out).str());
+            }
+        });
+    }
+
+    bench::section("Parsing quantities, per byte of text");
+    {
+        // One reading per line, half of them in another unit than the target, like a column of a CSV
+        std::string same_unit;
+        std::string mixed_units;
+        std::string bare_numbers;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto amount = zero::fmt::formatter("{}", 10.0 + static_cast<double>(i % 1000) / 8);
+            same_unit += amount + " km/h\n";
+            mixed_units += amount + (i % 2 == 0 ? " km/h\n" : " m/s\n");
+            bare_numbers += amount + "\n";
+        }
+
+        double total = 0.;
+        const auto sum = [&](quantity<KilometersPerHour> speed) { total += speed.amount; };
+        bench::run("parse_quantities of km/h", same_unit.size(), [&] {
+            bench::keep(parse_quantities<KilometersPerHour>(same_unit, sum).ptr);
+        });
+        bench::run("parse_quantities of km/h and m/s", mixed_units.size(), [&] {
+            bench::keep(parse_quantities<KilometersPerHour>(mixed_units, sum).ptr);
+        });
+        bench::run("parse_quantity<KilometersPerHour> of every line", same_unit.size(), [&] {
+            for (const auto line : zero::split(std::string_view {same_unit}, '\n'))
+                if (!line.empty())
+                    total += parse_quantity<KilometersPerHour>(line).amount;
+        });
+        bench::run("std::strtod of the bare numbers", bare_numbers.size(), [&] {
+            const char* first = bare_numbers.c_str();
+            char* end = nullptr;
+            for (double value = std::strtod(first, &end); end != first; value = std::strtod(first, &end)) {
+                total += value;
+                first = end;
+            }
+        });
+        bench::keep(total);
+    }
+}
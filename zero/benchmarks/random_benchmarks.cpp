@@ -0,0 +1,57 @@
+/**
+* Benchmarks of the random number engines of the math library, against the ones of the standard library
+*/
+
+#include "bench.h"
+
+import math;
+
+using namespace zero::math;
+
+namespace {
+    constexpr std::size_t values = 4096;
+
+    template <typename Engine>
+    void one_at_a_time(std::string_view name, Engine engine) {
+        bench::run(name, values, [&] {
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < values; ++i)
+                sum += engine();
+            bench::keep(sum);
+        });
+    }
+}
+
+void random_benchmarks() {
+    bench::section("Random engines, per 64 bit value");
+    one_at_a_time("std::mt19937_64", std::mt19937_64 {42});
+    one_at_a_time("Xoshiro256StarStar", Xoshiro256StarStar {42});
+    one_at_a_time("Pcg64", Pcg64 {42});
+    one_at_a_time("Xoshiro256StarStarSimd<8>", Xoshiro256StarStarSimd<8> {42});
+
+    bench::section("Filling 4096 values, per value");
+    std::vector<std::uint64_t> bits(values);
+    std::vector<double> uniform(values);
+    {
+        std::mt19937_64 engine {42};
+        bench::run("std::ranges::generate with std::mt19937_64", values, [&] {
+            std::ranges::generate(bits, std::ref(engine));
+            bench::keep(bits.front());
+        });
+        std::uniform_real_distribution<double> distribution {0.0, 1.0};
+        bench::run("std::uniform_real_distribution with std::mt19937_64", values, [&] {
+            std::ranges::generate(uniform, [&] { return distribution(engine); });
+            bench::keep(uniform.front());
+        });
+    }
+    {
+        Xoshiro256StarStar engine {42};
+        bench::run("fill with Xoshiro256StarStar", values, [&] { fill(engine, std::span {bits}); bench::keep(bits.front()); });
+        bench::run("fill_uniform with Xoshiro256StarStar", values, [&] { fill_uniform(engine, std::span {uniform}); bench::keep(uniform.front()); });
+    }
+    {
+        Xoshiro256StarStarSimd<8> engine {42};
+        bench::run("fill with Xoshiro256StarStarSimd<8>", values, [&] { fill(engine, std::span {bits}); bench::keep(bits.front()); });
+        bench::run("fill_uniform with Xoshiro256StarStarSimd<8>", values, [&] { fill_uniform(engine, std::span {uniform}); bench::keep(uniform.front()); });
+    }
+}
@@ -0,0 +1,56 @@
+/**
+* Benchmarks of the searches of str_manip, against the standard library and memmem
+*/
+
+#include "bench.h"
+
+import str_manip;
+
+#include <string.h>
+
+namespace {
+    /// Text that looks like prose: words of a few letters from a small vocabulary, separated by spaces
+    std::string prose(std::size_t size) {
+        constexpr std::array<std::string_view, 12> words {
+            "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "and", "then", "sleeps", "again"
+        };
+        std::string text;
+        std::uint64_t seed = 12345;
+        while (text.size() < size) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            text += words[(seed >> 33) % words.size()];
+            text += ' ';
+        }
+        text.resize(size);
+        return text;
+    }
+
+    std::size_t memmem_find(std::string_view haystack, std::string_view needle) {
+        const void* found = ::memmem(haystack.data(), haystack.size(), needle.data(), needle.size());
+        return found == nullptr ? std::string_view::npos : static_cast<std::size_t>(static_cast<const char*>(found) - haystack.data());
+    }
+
+    void searches(std::string_view title, std::string_view text, std::string_view needle) {
+        bench::run(zero::fmt::formatter("zero::find, {}", title), text.size(), [&] { bench::keep(zero::find(text, needle)); });
+        bench::run(zero::fmt::formatter("std::string_view::find, {}", title), text.size(), [&] { bench::keep(text.find(needle)); });
+        bench::run(zero::fmt::formatter("memmem, {}", title), text.size(), [&] { bench::keep(memmem_find(text, needle)); });
+    }
+}
+
+void str_manip_benchmarks() {
+    bench::section("Searching 1 MiB of text, per byte");
+    const std::string text = prose(1 << 20);
+    searches("absent word", text, "zebra");
+    searches("absent phrase", text, "the lazy fox jumps again over the quick brown dog");
+    searches("single character", text, "#");
+
+    const std::string repetitive(1 << 20, 'a');
+    const std::string periodic = std::string(64, 'a') + "b" + std::string(64, 'a');
+    searches("periodic needle in a periodic text", repetitive, periodic);
+
+    const std::string_view view = text;
+    bench::run("zero::count of a character", text.size(), [&] { bench::keep(zero::count(view, 'e')); });
+    bench::run("std::ranges::count of a character", text.size(), [&] { bench::keep(std::ranges::count(view, 'e')); });
+    bench::run("zero::find_first_of of 3 characters", text.size(), [&] { bench::keep(zero::find_first_of(view, "#@!")); });
+    bench::run("std::string_view::find_first_of of 3 characters", text.size(), [&] { bench::keep(view.find_first_of("#@!")); });
+}
@@ -0,0 +1,576 @@
+/**
+* Provides an asynchronous logger
+*
+* Logging a message only copies its raw arguments into a lock-free queue of the calling thread:
+* the pattern is checked at compile time, but it's a background thread that formats the
+* messages with the `formatter`, stylizes their levels with the `stylizer`, and writes them in
+* batches through a {@link zero::fmt::Writer}.
+*
+* Every thread has its own single producer, single consumer ring buffer for every logger, so the
+* threads never contend when they log. The order of the messages of every thread is kept, but the
+* messages of different threads can be written in any order, so every message has a timestamp.
+*/
+
+export module log;
+
+import std;
+import formatter;
+import stylizer;
+import print_utils;
+
+export namespace zero::log {
+    enum class level : std::uint8_t { trace, debug, info, warn, error, fatal, off };
+
+    /**
+     * The minimum level of the messages compiled into the loggers by default: the calls to log a message
+     * of a lower level are removed at compile time. It's set with the `ZERO_LOG_LEVEL` macro, the number
+     * of a {@link level}, when this module is compiled
+     */
+#ifdef ZERO_LOG_LEVEL
+    constexpr level compile_time_level = static_cast<level>(ZERO_LOG_LEVEL);
+#else
+    constexpr level compile_time_level = level::trace;
+#endif
+
+    /// What a thread that logs does when its queue is full
+    enum class overflow_policy : std::uint8_t {
+        /// Waits until the background thread frees enough space
+        block,
+        /// Discards the message, and the number of discarded messages is logged later
+        drop,
+        /// Allocates a bigger queue
+        grow
+    };
+
+    struct options {
+        /// The file descriptor where the messages are written, the standard error by default
+        int fd = 2;
+        /// The initial size of the queue of every thread, in bytes, rounded up to a power of two
+        std::size_t queue_capacity = 256 * 1024;
+        overflow_policy policy = overflow_policy::block;
+        /// The minimum level of the messages that are logged, that can be changed at runtime
+        level min_level = level::trace;
+        /// Whether the levels are colored with ANSI escape sequences, detected with `zero::fmt::colors_enabled` when it's empty
+        std::optional<bool> colors {};
+        /// How long the background thread sleeps when there aren't messages
+        std::chrono::microseconds poll_interval {500};
+    };
+}
+
+namespace logging::__detail {
+    using zero::log::level;
+
+    template <typename T>
+    concept StringLike = std::is_convertible_v<const T&, std::string_view>;
+
+    /**
+     * The arguments copied as they are, whose bytes are enough to format them on the background thread: only the
+     * numbers, the characters and the enumerations, as any other type, even a trivially copyable one like a span or
+     * a pointer, may refer to data that doesn't outlive the call
+     */
+    template <typename T>
+    concept CopiedAsIs = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+    /// The type of an argument once it's read back from the queue: the strings, and the types formatted eagerly, are views
+    template <typename T>
+    using stored_t = std::conditional_t<CopiedAsIs<T>, T, std::string_view>;
+
+    using decode_fn = void (*)(std::string_view pattern, const std::byte* arguments, zero::fmt::Writer& out);
+
+    /// The header of every record of a queue, followed by the arguments of the message
+    struct record_header {
+        /// Formats the message, or null for the padding at the end of the buffer
+        decode_fn decode;
+        std::string_view pattern;
+        std::int64_t timestamp;
+        /// The size of the whole record
+        std::uint32_t size;
+        level severity;
+    };
+
+    constexpr std::size_t record_alignment = 8;
+
+    [[nodiscard]] constexpr std::size_t align_record(std::size_t size) noexcept {
+        return (size + record_alignment - 1) & ~(record_alignment - 1);
+    }
+
+    /**
+     * Makes an argument ready to be copied: the types copied as they are and the strings are left
+     * untouched, but anything else is formatted on the calling thread, as its bytes may not outlive the call
+     */
+    template <typename T>
+    [[nodiscard]] decltype(auto) prepare(const T& value) {
+        if constexpr (CopiedAsIs<T>)
+            return (value);
+        else if constexpr (StringLike<T>)
+            return std::string_view {value};
+        else
+            return zero::fmt::formatter("{}", value);
+    }
+
+    template <typename T>
+    [[nodiscard]] std::size_t encoded_size(const T& prepared) noexcept {
+        if constexpr (CopiedAsIs<T>)
+            return sizeof(T);
+        else
+            return sizeof(std::uint32_t) + std::string_view {prepared}.size();
+    }
+
+    template <typename T>
+    void encode(std::byte*& out, const T& prepared) noexcept {
+        if constexpr (CopiedAsIs<T>) {
+            std::memcpy(out, std::addressof(prepared), sizeof(T));
+            out += sizeof(T);
+        } else {
+            const std::string_view text {prepared};
+            const auto size = static_cast<std::uint32_t>(text.size());
+            std::memcpy(out, &size, sizeof(size));
+            std::memcpy(out + sizeof(size), text.data(), text.size());
+            out += sizeof(size) + text.size();
+        }
+    }
+
+    template <typename T>
+    [[nodiscard]] stored_t<T> decode_one(const std::byte*& in) noexcept {
+        if constexpr (CopiedAsIs<T>) {
+            std::array<std::byte, sizeof(T)> bytes;
+            std::memcpy(bytes.data(), in, sizeof(T));
+            in += sizeof(T);
+            return std::bit_cast<T>(bytes);
+        } else {
+            std::uint32_t size;
+            std::memcpy(&size, in, sizeof(size));
+            const std::string_view text {reinterpret_cast<const char*>(in + sizeof(size)), size};
+            in += sizeof(size) + size;
+            return text;
+        }
+    }
+
+    /// Reads back the arguments of a message and formats it into `out`
+    template <typename... Args>
+    void decode(std::string_view pattern, [[maybe_unused]] const std::byte* in, zero::fmt::Writer& out) {
+        // The braced initialization reads the arguments in order
+        const std::tuple<stored_t<Args>...> values {decode_one<Args>(in)...};
+        std::apply([&](const auto&... arguments) { out.print(zero::fmt::runtime_format(pattern), arguments...); }, values);
+    }
+
+    /**
+     * A lock-free single producer, single consumer queue of records, stored contiguously in a ring
+     * buffer. A record that doesn't fit before the end of the buffer starts at the beginning, after a padding record
+     */
+    class ring {
+    public:
+        explicit ring(std::size_t capacity)
+            : _capacity {std::bit_ceil(std::max(capacity, std::size_t {4096}))}
+            , _data {std::make_unique_for_overwrite<std::byte[]>(_capacity)}
+            , _head {0}
+            , _tail {0}
+            , _cached_tail {0}
+            , _pending {0}
+            , _padding_start {0}
+            , _padding_end {0}
+            , next {nullptr} {}
+
+        [[nodiscard]] std::size_t capacity() const noexcept { return _capacity; }
+
+        /**
+         * Producer: a contiguous space for a record of `size` bytes, or null when the queue is full. A record
+         * that doesn't fit before the end of the buffer publishes the padding on its own first, as the record
+         * may only fit once the consumer skips it, i.e. when it's bigger than the space before its position
+         */
+        [[nodiscard]] std::byte* try_reserve(std::size_t size) noexcept {
+            std::size_t head = _head.load(std::memory_order_relaxed);
+            std::size_t offset = head & (_capacity - 1);
+            if (const std::size_t to_end = _capacity - offset; to_end < size) {
+                if (!has_room(head, to_end))
+                    return nullptr;
+                if (to_end >= sizeof(record_header)) {
+                    const record_header padding {nullptr, {}, 0, static_cast<std::uint32_t>(to_end), level::off};
+                    std::memcpy(_data.get() + offset, &padding, sizeof(padding));
+                }
+                _padding_start = head;
+                head += to_end;
+                _padding_end = head;
+                offset = 0;
+                _head.store(head, std::memory_order_release);
+            }
+            if (!has_room(head, size))
+                return nullptr;
+            _pending = head + size;
+            return _data.get() + offset;
+        }
+
+        /// Producer: whether the queue only holds the last padding, so its space is free once the consumer skips it
+        [[nodiscard]] bool only_padding_pending() const noexcept {
+            return _head.load(std::memory_order_relaxed) == _padding_end && _padding_end != _padding_start
+                && _tail.load(std::memory_order_acquire) >= _padding_start;
+        }
+
+        /// Producer: publishes the last reserved record
+        void commit() noexcept { _head.store(_pending, std::memory_order_release); }
+
+        /// Consumer: the next record, or null when the queue is empty
+        [[nodiscard]] const std::byte* front(record_header& header) noexcept {
+            std::size_t tail = _tail.load(std::memory_order_relaxed);
+            const std::size_t head = _head.load(std::memory_order_acquire);
+            while (tail != head) {
+                const std::size_t offset = tail & (_capacity - 1);
+                const std::size_t to_end = _capacity - offset;
+                if (to_end < sizeof(record_header)) { // Too small even for a padding record
+                    tail += to_end;
+                    continue;
+                }
+                std::memcpy(&header, _data.get() + offset, sizeof(header));
+                if (header.decode != nullptr) {
+                    _tail.store(tail, std::memory_order_relaxed);
+                    return _data.get() + offset;
+                }
+                tail += header.size;
+            }
+            _tail.store(tail, std::memory_order_release);
+            return nullptr;
+        }
+
+        /// Consumer: frees the record returned by {@link front}
+        void pop(const record_header& header) noexcept {
+            _tail.store(_tail.load(std::memory_order_relaxed) + header.size, std::memory_order_release);
+        }
+
+    private:
+        std::size_t _capacity;
+        std::unique_ptr<std::byte[]> _data;
+        alignas(64) std::atomic<std::size_t> _head;
+        alignas(64) std::atomic<std::size_t> _tail;
+        // Only used by the producer
+        alignas(64) std::size_t _cached_tail;
+        std::size_t _pending;
+        std::size_t _padding_start;
+        std::size_t _padding_end;
+
+        [[nodiscard]] bool has_room(std::size_t head, std::size_t size) noexcept {
+            if (head + size - _cached_tail <= _capacity)
+                return true;
+            _cached_tail = _tail.load(std::memory_order_acquire);
+            return head + size - _cached_tail <= _capacity;
+        }
+
+    public:
+        /// The bigger queue that replaced this one, once it's full, with the {@link zero::log::overflow_policy::grow} policy
+        std::atomic<ring*> next;
+    };
+
+    /// The queues of a thread for a logger: a chain of rings, as the full ones are replaced when they grow
+    struct producer_queue {
+        explicit producer_queue(std::size_t capacity) : write {new ring(capacity)}, read {write} {}
+
+        producer_queue(const producer_queue&) = delete;
+        producer_queue& operator=(const producer_queue&) = delete;
+
+        ~producer_queue() {
+            while (read != nullptr)
+                delete std::exchange(read, read->next.load(std::memory_order_acquire));
+        }
+
+        /// The ring written by the producer
+        ring* write;
+        /// The ring read by the consumer
+        ring* read;
+        /// Set when the thread ends
+        std::atomic<bool> closed {false};
+        /// Set when the logger is destroyed, so the thread releases the queue
+        std::atomic<bool> orphaned {false};
+        /// Set by the consumer when it drains the queue after the thread ended
+        bool finished = false;
+        std::atomic<std::uint64_t> dropped {0};
+    };
+
+    /// The queues of the calling thread, one per live logger, which are closed when it ends
+    struct thread_queues {
+        std::vector<std::pair<std::uint64_t, std::shared_ptr<producer_queue>>> queues {};
+
+        ~thread_queues() {
+            for (auto& [logger, queue] : queues)
+                queue->closed.store(true, std::memory_order_release);
+        }
+    };
+
+    thread_local thread_queues local_queues;
+
+    inline std::atomic<std::uint64_t> logger_ids {0};
+
+    /// The part of the loggers that doesn't depend on their compile time level
+    class logger_core {
+    public:
+        explicit logger_core(const zero::log::options& opts)
+            : _options {opts}
+            , _id {logger_ids.fetch_add(1, std::memory_order_relaxed)}
+            , _level {opts.min_level}
+            , _labels {build_labels(opts.colors.value_or(zero::fmt::colors_enabled(opts.fd)))}
+            , _mutex {}
+            , _queues {}
+            , _queues_changed {false}
+            , _wake_mutex {}
+            , _wake {}
+            , _flush_requested {0}
+            , _flushed {0}
+            , _worker {[this](std::stop_token stop) { run(stop); }} {}
+
+        logger_core(const logger_core&) = delete;
+        logger_core& operator=(const logger_core&) = delete;
+
+        /// Writes the pending messages and stops the background thread
+        ~logger_core() {
+            _worker.request_stop();
+            _wake.notify_one();
+            _worker.join();
+            for (const auto& queue : _queues)
+                queue->orphaned.store(true, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] level min_level() const noexcept { return _level.load(std::memory_order_relaxed); }
+        void min_level(level severity) noexcept { _level.store(severity, std::memory_order_relaxed); }
+
+        /// @return whether a message of the level `severity` is logged, checked before its arguments are copied
+        [[nodiscard]] bool enabled(level severity) const noexcept { return severity >= min_level() && severity != level::off; }
+
+        /// Copies the arguments of a message into the queue of the calling thread
+        template <typename... Args>
+        void enqueue(level severity, std::string_view pattern, const Args&... args) {
+            const auto timestamp = std::chrono::system_clock::now().time_since_epoch();
+            [&](const auto&... prepared) {
+                const std::size_t size = align_record(sizeof(record_header) + (std::size_t {0} + ... + encoded_size(prepared)));
+                producer_queue& queue = local_queue();
+                std::byte* out = reserve(queue, size);
+                if (out == nullptr)
+                    return;
+                const record_header header {
+                    &decode<Args...>, pattern,
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp).count(),
+                    static_cast<std::uint32_t>(size), severity
+                };
+                std::memcpy(out, &header, sizeof(header));
+                out += sizeof(header);
+                (encode(out, prepared), ...);
+                queue.write->commit();
+            }(prepare(args)...);
+        }
+
+        /// Blocks until every message logged before by any thread is written
+        void flush() {
+            const std::uint64_t ticket = _flush_requested.fetch_add(1) + 1;
+            std::unique_lock lock {_wake_mutex};
+            _wake.notify_one();
+            _wake.wait(lock, [&] { return _flushed.load() >= ticket; });
+        }
+
+    private:
+        zero::log::options _options;
+        std::uint64_t _id;
+        std::atomic<level> _level;
+        std::array<std::string, 6> _labels;
+
+        std::mutex _mutex;
+        std::vector<std::shared_ptr<producer_queue>> _queues;
+        std::atomic<bool> _queues_changed;
+
+        std::mutex _wake_mutex;
+        std::condition_variable_any _wake;
+        std::atomic<std::uint64_t> _flush_requested;
+        std::atomic<std::uint64_t> _flushed;
+
+        std::jthread _worker;
+
+        static std::array<std::string, 6> build_labels(bool colors) {
+            using zero::fmt::Color;
+            using zero::fmt::Modifier;
+            constexpr std::array<std::string_view, 6> names {"TRACE", "DEBUG", "INFO ", "WARN ", "ERROR", "FATAL"};
+            constexpr std::array<Color, 6> palette {Color::GREY, Color::CYAN, Color::GREEN, Color::YELLOW, Color::RED, Color::PURPLE};
+            std::array<std::string, 6> labels;
+            for (std::size_t i = 0; i < labels.size(); ++i)
+                labels[i] = colors ? zero::fmt::stylize(names[i], palette[i], Modifier::BOLD) : std::string {names[i]};
+            return labels;
+        }
+
+        /// The queue of the calling thread for this logger, releasing the ones of the loggers that were destroyed
+        producer_queue& local_queue() {
+            std::erase_if(local_queues.queues, [](const auto& entry) { return entry.second->orphaned.load(std::memory_order_relaxed); });
+            for (auto& [logger, queue] : local_queues.queues)
+                if (logger == _id)
+                    return *queue;
+            auto queue = std::make_shared<producer_queue>(_options.queue_capacity);
+            local_queues.queues.emplace_back(_id, queue);
+            const std::scoped_lock lock {_mutex};
+            _queues.push_back(std::move(queue));
+            _queues_changed.store(true, std::memory_order_release);
+            return *local_queues.queues.back().second;
+        }
+
+        /// Reserves the space of a record, following the overflow policy when the queue is full
+        std::byte* reserve(producer_queue& queue, std::size_t size) {
+            if (std::byte* out = queue.write->try_reserve(size))
+                return out;
+            const bool fits = size <= queue.write->capacity();
+            switch (_options.policy) {
+                case zero::log::overflow_policy::block:
+                    if (fits)
+                        for (;;) {
+                            std::this_thread::yield();
+                            if (std::byte* out = queue.write->try_reserve(size))
+                                return out;
+                        }
+                    break; // A record bigger than the whole queue can't wait for it
+                case zero::log::overflow_policy::grow: {
+                    auto* bigger = new ring(std::max(2 * queue.write->capacity(), 2 * size));
+                    queue.write->next.store(bigger, std::memory_order_release);
+                    queue.write = bigger;
+                    return bigger->try_reserve(size);
+                }
+                case zero::log::overflow_policy::drop:
+                    // Not full, but waiting for the background thread to skip the padding at the end of the buffer
+                    if (fits)
+                        while (queue.write->only_padding_pending()) {
+                            std::this_thread::yield();
+                            if (std::byte* out = queue.write->try_reserve(size))
+                                return out;
+                        }
+                    break;
+            }
+            queue.dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        /// Formats and writes the pending messages of a queue, and @return whether it had any
+        bool drain(producer_queue& queue, zero::fmt::Writer& out) {
+            bool written = false;
+            for (;;) {
+                ring& current = *queue.read;
+                record_header header;
+                while (const std::byte* record = current.front(header)) {
+                    write_message(header, record + sizeof(record_header), out);
+                    current.pop(header);
+                    written = true;
+                }
+                ring* next = current.next.load(std::memory_order_acquire);
+                if (next == nullptr)
+                    return written;
+                if (current.front(header) == nullptr) // The producer is done with it, once it has a successor
+                    delete std::exchange(queue.read, next);
+            }
+        }
+
+        void write_message(const record_header& header, const std::byte* arguments, zero::fmt::Writer& out) {
+            using namespace std::chrono;
+            const sys_time<nanoseconds> time {nanoseconds {header.timestamp}};
+            const auto day = floor<days>(time);
+            const year_month_day date {day};
+            const hh_mm_ss clock {floor<microseconds>(time - day)};
+            out.print(
+                "{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:06} [{}] ",
+                static_cast<int>(date.year()), static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+                clock.hours().count(), clock.minutes().count(), clock.seconds().count(), clock.subseconds().count(),
+                std::string_view {_labels[static_cast<std::size_t>(header.severity)]}
+            );
+            try {
+                header.decode(header.pattern, arguments, out);
+            } catch (const std::exception& error) {
+                // The writer has already dropped the part of the message formatted before the error
+                out.print("<unformattable message: {}>", std::string_view {error.what()});
+            }
+            out.write("\n");
+        }
+
+        void run(std::stop_token stop) {
+            zero::fmt::Writer out {_options.fd};
+            out.line_buffered(false);
+            std::vector<std::shared_ptr<producer_queue>> queues;
+            for (;;) {
+                const bool stopping = stop.stop_requested();
+                const std::uint64_t requested = _flush_requested.load();
+                if (_queues_changed.exchange(false, std::memory_order_acquire)) {
+                    const std::scoped_lock lock {_mutex};
+                    queues = _queues;
+                }
+
+                bool written = false;
+                bool finished = false;
+                for (const auto& queue : queues) {
+                    // Checked before draining it, so the last messages of a thread that ended are written
+                    queue->finished = queue->closed.load(std::memory_order_acquire);
+                    written |= drain(*queue, out);
+                    if (const auto dropped = queue->dropped.exchange(0, std::memory_order_relaxed); dropped != 0) {
+                        out.println("[{}] {} messages were dropped, as the queue of their thread was full",
+                            std::string_view {_labels[static_cast<std::size_t>(level::warn)]}, dropped);
+                        written = true;
+                    }
+                    finished |= queue->finished;
+                }
+                if (written)
+                    out.flush();
+                if (finished) { // The queues of the threads that ended are removed once they are drained
+                    const std::scoped_lock lock {_mutex};
+                    std::erase_if(_queues, [](const auto& queue) { return queue->finished; });
+                    queues = _queues;
+                }
+
+                if (requested != _flushed.load()) {
+                    const std::scoped_lock lock {_wake_mutex};
+                    _flushed.store(requested);
+                    _wake.notify_all();
+                }
+                if (stopping)
+                    return;
+                if (!written) {
+                    std::unique_lock lock {_wake_mutex};
+                    _wake.wait_for(lock, stop, _options.poll_interval, [&] { return _flush_requested.load() != _flushed.load(); });
+                }
+            }
+        }
+    };
+}
+
+export namespace zero::log {
+    /**
+     * An asynchronous logger
+     * @tparam MinLevel the minimum level of the messages compiled in: logging a message of a lower level
+     * is removed at compile time, although its arguments are still evaluated
+     */
+    template <level MinLevel = compile_time_level>
+    class basic_logger {
+    public:
+        explicit basic_logger(const options& opts = {}) : _core {opts} {}
+
+        /// Logs a message of the level `L`, copying its arguments to be formatted by the background thread
+        template <level L, typename... Args>
+        void log(fmt::format_string<Args...> format, const Args&... args) {
+            if constexpr (L >= MinLevel && L != level::off) {
+                if (_core.enabled(L))
+                    _core.enqueue(L, format.get(), args...);
+            }
+        }
+
+        template <typename... Args>
+        void trace(fmt::format_string<Args...> format, const Args&... args) { log<level::trace>(format, args...); }
+        template <typename... Args>
+        void debug(fmt::format_string<Args...> format, const Args&... args) { log<level::debug>(format, args...); }
+        template <typename... Args>
+        void info(fmt::format_string<Args...> format, const Args&... args) { log<level::info>(format, args...); }
+        template <typename... Args>
+        void warn(fmt::format_string<Args...> format, const Args&... args) { log<level::warn>(format, args...); }
+        template <typename... Args>
+        void error(fmt::format_string<Args...> format, const Args&... args) { log<level::error>(format, args...); }
+        template <typename... Args>
+        void fatal(fmt::format_string<Args...> format, const Args&... args) { log<level::fatal>(format, args...); }
+
+        /// @return the minimum level of the messages logged, at runtime
+        [[nodiscard]] level min_level() const noexcept { return _core.min_level(); }
+        void min_level(level severity) noexcept { _core.min_level(severity); }
+
+        /// Blocks until every message logged before by any thread is written
+        void flush() { _core.flush(); }
+
+    private:
+        logging::__detail::logger_core _core;
+    };
+
+    using logger = basic_logger<>;
+}
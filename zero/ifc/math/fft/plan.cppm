@@ -0,0 +1,465 @@
+/**
+ * @brief Precomputed plans for the Fast Fourier Transform
+ *
+ * A plan factorizes the size of the transform and precomputes every twiddle factor
+ * once, so transforming many signals of the same size only pays for the butterflies.
+ *
+ * - `FftPlan<T>` - Complex to complex transforms of any size. The size is split into
+ * radix-4 stages (plus a radix-2 one when needed) and then into small prime factors,
+ * that are computed with the self-sorting Stockham formulation, so there's no
+ * bit-reversal pass. Sizes with a prime factor too big for a direct butterfly fall
+ * back to the Bluestein's algorithm, that rewrites the transform as a convolution
+ * computed with a power of two plan
+ * - `RealFftPlan<T>` - Real to complex transforms, that only return the non-redundant
+ * half of the spectrum. An even sized signal is packed into a complex one of half its size,
+ * so it costs about a half of the complex transform
+ *
+ * The innermost loops of every stage run over contiguous data with plain real arithmetic,
+ * so the compiler vectorizes them.
+ *
+ * The forward transform is unnormalized, while the inverse one is scaled by 1/N, so
+ * `inverse(forward(x)) == x`.
+ */
+
+export module math.fft:plan;
+
+import std;
+
+namespace fourier::__detail {
+    /**
+     * Complex product, without the NaN and infinity recovery of the `std::complex`
+     * operator, that blocks the vectorization of the butterflies
+     */
+    template <typename T>
+    [[nodiscard]] inline std::complex<T> mul(std::complex<T> a, std::complex<T> b) noexcept {
+        return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+    }
+
+    /// Multiplies by -i in the forward direction, and by +i in the inverse one
+    template <bool Inverse, typename T>
+    [[nodiscard]] inline std::complex<T> rotate(std::complex<T> a) noexcept {
+        if constexpr (Inverse)
+            return {-a.imag(), a.real()};
+        else
+            return {a.imag(), -a.real()};
+    }
+
+    template <bool Inverse, typename T>
+    [[nodiscard]] inline std::complex<T> directed(std::complex<T> a) noexcept {
+        if constexpr (Inverse)
+            return std::conj(a);
+        else
+            return a;
+    }
+
+    /// e^(-2πik/n), computed in extended precision before rounding it to `T`
+    template <typename T>
+    [[nodiscard]] std::complex<T> root_of_unity(std::size_t k, std::size_t n) noexcept {
+        const long double angle = -2.0L * std::numbers::pi_v<long double>
+            * static_cast<long double>(k % n) / static_cast<long double>(n);
+        return {static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle))};
+    }
+
+    /// The biggest prime factor that is computed with a direct butterfly, instead of with Bluestein's algorithm
+    constexpr std::size_t max_direct_radix = 31;
+
+    /// @return the radices of the stages of a transform of `n` points, none for the empty and the single point ones
+    [[nodiscard]] inline std::vector<std::size_t> factorize(std::size_t n) {
+        std::vector<std::size_t> radices;
+        if (n <= 1)
+            return radices;
+        while (n % 4 == 0) {
+            radices.push_back(4);
+            n /= 4;
+        }
+        if (n % 2 == 0) {
+            radices.push_back(2);
+            n /= 2;
+        }
+        for (std::size_t p = 3; p * p <= n; p += 2)
+            while (n % p == 0) {
+                radices.push_back(p);
+                n /= p;
+            }
+        if (n > 1)
+            radices.push_back(n);
+        return radices;
+    }
+}
+
+export namespace zero::math {
+    /**
+     * @brief A reusable complex Fast Fourier Transform of a fixed size
+     *
+     * A plan is immutable after its construction, so a single one can be shared
+     * between any number of threads. The working memory is kept per thread.
+     */
+    template <std::floating_point T = double>
+    class FftPlan {
+    public:
+        using complex_type = std::complex<T>;
+
+    private:
+        struct Stage {
+            std::size_t radix;
+            std::size_t m;          // The number of butterflies of the sub-transforms of this stage
+            std::size_t stride;     // The number of interleaved sub-transforms
+            std::size_t twiddles;   // The offset of the twiddles of the stage, as (radix - 1) rows of m
+            std::size_t roots;      // The offset of the roots of unity of the radix, for the generic butterflies
+        };
+
+        std::size_t _size;
+        std::vector<Stage> _stages;
+        std::vector<complex_type> _twiddles;
+        std::vector<complex_type> _roots;
+
+        // Bluestein's algorithm
+        std::unique_ptr<const FftPlan> _convolution;
+        std::vector<complex_type> _chirp;
+        std::vector<complex_type> _chirp_spectrum;
+
+        [[nodiscard]] static std::vector<complex_type>& stockham_scratch(std::size_t size) {
+            thread_local std::vector<complex_type> scratch;
+            if (scratch.size() < size)
+                scratch.resize(size);
+            return scratch;
+        }
+
+        [[nodiscard]] static std::vector<complex_type>& bluestein_scratch(std::size_t size) {
+            thread_local std::vector<complex_type> scratch;
+            if (scratch.size() < size)
+                scratch.resize(size);
+            return scratch;
+        }
+
+        /// Calls `butterfly(p, q)` for every butterfly of the stage, with the longest loop innermost
+        template <typename F>
+        static void for_each_butterfly(const Stage& stage, F&& butterfly) {
+            if (stage.stride == 1)
+                for (std::size_t p = 0; p < stage.m; ++p)
+                    butterfly(p, std::size_t {0});
+            else
+                for (std::size_t p = 0; p < stage.m; ++p)
+                    for (std::size_t q = 0; q < stage.stride; ++q)
+                        butterfly(p, q);
+        }
+
+        template <bool Inverse>
+        void run_stage(const Stage& stage, const complex_type* x, complex_type* y) const noexcept {
+            using fourier::__detail::mul;
+            using fourier::__detail::directed;
+            const std::size_t m = stage.m;
+            const std::size_t s = stage.stride;
+            const complex_type* tw = _twiddles.data() + stage.twiddles;
+
+            switch (stage.radix) {
+                case 2:
+                    for_each_butterfly(stage, [=](std::size_t p, std::size_t q) {
+                        const complex_type a = x[q + s * p];
+                        const complex_type b = x[q + s * (p + m)];
+                        y[q + s * (2 * p)] = a + b;
+                        y[q + s * (2 * p + 1)] = mul(a - b, directed<Inverse>(tw[p]));
+                    });
+                    break;
+                case 4:
+                    for_each_butterfly(stage, [=](std::size_t p, std::size_t q) {
+                        const complex_type a0 = x[q + s * p];
+                        const complex_type a1 = x[q + s * (p + m)];
+                        const complex_type a2 = x[q + s * (p + 2 * m)];
+                        const complex_type a3 = x[q + s * (p + 3 * m)];
+                        const complex_type t0 = a0 + a2;
+                        const complex_type t1 = a0 - a2;
+                        const complex_type t2 = a1 + a3;
+                        const complex_type t3 = fourier::__detail::rotate<Inverse>(a1 - a3);
+                        y[q + s * (4 * p)] = t0 + t2;
+                        y[q + s * (4 * p + 1)] = mul(t1 + t3, directed<Inverse>(tw[p]));
+                        y[q + s * (4 * p + 2)] = mul(t0 - t2, directed<Inverse>(tw[m + p]));
+                        y[q + s * (4 * p + 3)] = mul(t1 - t3, directed<Inverse>(tw[2 * m + p]));
+                    });
+                    break;
+                default: {
+                    const std::size_t r = stage.radix;
+                    const complex_type* roots = _roots.data() + stage.roots;
+                    for_each_butterfly(stage, [=](std::size_t p, std::size_t q) {
+                        std::array<complex_type, fourier::__detail::max_direct_radix> a;
+                        for (std::size_t k = 0; k < r; ++k)
+                            a[k] = x[q + s * (p + k * m)];
+                        for (std::size_t j = 0; j < r; ++j) {
+                            complex_type sum = a[0];
+                            for (std::size_t k = 1; k < r; ++k)
+                                sum += mul(a[k], directed<Inverse>(roots[j * k % r]));
+                            y[q + s * (r * p + j)] = j == 0 ? sum : mul(sum, directed<Inverse>(tw[(j - 1) * m + p]));
+                        }
+                    });
+                }
+            }
+        }
+
+        template <bool Inverse>
+        void bluestein(std::span<const complex_type> in, std::span<complex_type> out) const {
+            using fourier::__detail::mul;
+            using fourier::__detail::directed;
+            const std::size_t padded = _chirp_spectrum.size();
+            auto& buffer = bluestein_scratch(padded);
+            const std::span<complex_type> work {buffer.data(), padded};
+
+            for (std::size_t j = 0; j < _size; ++j)
+                work[j] = mul(in[j], directed<Inverse>(_chirp[j]));
+            std::fill(work.begin() + static_cast<std::ptrdiff_t>(_size), work.end(), complex_type {});
+
+            // The convolution with the conjugated chirp, as a product of spectra. The spectrum
+            // of the conjugate of a sequence is the conjugate of its reversed spectrum
+            _convolution->template transform<false>(work, work);
+            for (std::size_t k = 0; k < padded; ++k)
+                work[k] = mul(work[k], Inverse ? std::conj(_chirp_spectrum[(padded - k) % padded]) : _chirp_spectrum[k]);
+            _convolution->template transform<true>(work, work);
+
+            for (std::size_t k = 0; k < _size; ++k)
+                out[k] = mul(work[k], directed<Inverse>(_chirp[k]));
+        }
+
+        void check_sizes(std::size_t in, std::size_t out) const {
+            if (in != _size || out != _size)
+                throw std::invalid_argument("FftPlan: the input and the output must have the size of the plan");
+        }
+
+    public:
+        /**
+         * Factorizes `size` and precomputes the twiddle factors of every stage
+         * @param size the number of points of the transform
+         */
+        explicit FftPlan(std::size_t size)
+            : _size {size}
+            , _stages {}
+            , _twiddles {}
+            , _roots {}
+            , _convolution {}
+            , _chirp {}
+            , _chirp_spectrum {}
+        {
+            const auto radices = fourier::__detail::factorize(size);
+            if (!radices.empty() && radices.back() > fourier::__detail::max_direct_radix) {
+                // X(k) = c(k) * sum(x(j) * c(j) * conj(c(k - j))), with the chirp c(k) = e^(-πik²/n)
+                const std::size_t padded = std::bit_ceil(2 * size - 1);
+                _convolution = std::make_unique<const FftPlan>(padded);
+                _chirp.resize(size);
+                std::size_t square = 0; // k² mod 2n, updated incrementally so it never overflows
+                for (std::size_t k = 0; k < size; ++k) {
+                    _chirp[k] = fourier::__detail::root_of_unity<T>(square, 2 * size);
+                    square = (square + 2 * k + 1) % (2 * size);
+                }
+
+                _chirp_spectrum.assign(padded, complex_type {});
+                _chirp_spectrum[0] = std::conj(_chirp[0]);
+                for (std::size_t k = 1; k < size; ++k)
+                    _chirp_spectrum[k] = _chirp_spectrum[padded - k] = std::conj(_chirp[k]);
+                _convolution->template transform<false>(_chirp_spectrum, _chirp_spectrum);
+                // Fold the normalization of the inverse convolution into the spectrum
+                const T scale = T {1} / static_cast<T>(padded);
+                for (auto& c : _chirp_spectrum)
+                    c *= scale;
+                return;
+            }
+
+            std::size_t n = size;
+            std::size_t stride = 1;
+            for (const std::size_t radix : radices) {
+                const std::size_t m = n / radix;
+                _stages.push_back({radix, m, stride, _twiddles.size(), _roots.size()});
+                for (std::size_t j = 1; j < radix; ++j)
+                    for (std::size_t p = 0; p < m; ++p)
+                        _twiddles.push_back(fourier::__detail::root_of_unity<T>(p * j, n));
+                if (radix != 2 && radix != 4)
+                    for (std::size_t k = 0; k < radix; ++k)
+                        _roots.push_back(fourier::__detail::root_of_unity<T>(k, radix));
+                n = m;
+                stride *= radix;
+            }
+        }
+
+        FftPlan(const FftPlan&) = delete;
+        FftPlan& operator=(const FftPlan&) = delete;
+        FftPlan(FftPlan&&) noexcept = default;
+        FftPlan& operator=(FftPlan&&) noexcept = default;
+
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+        /**
+         * The unnormalized transform, without checking the sizes of the spans. The input and the
+         * output can be the same span, but they can't partially overlap
+         */
+        template <bool Inverse>
+        void transform(std::span<const complex_type> in, std::span<complex_type> out) const {
+            if (_convolution) {
+                bluestein<Inverse>(in, out);
+                return;
+            }
+            if (_stages.empty()) {
+                std::copy_n(in.begin(), _size, out.begin());
+                return;
+            }
+
+            // The stages alternate between the output and the scratch, so the last one writes into the output
+            auto& scratch = stockham_scratch(_size);
+            bool to_output = _stages.size() % 2 == 1;
+            const complex_type* source = in.data();
+            if (to_output && source == out.data()) {
+                std::copy_n(source, _size, scratch.begin());
+                source = scratch.data();
+            }
+            for (const auto& stage : _stages) {
+                complex_type* destination = to_output ? out.data() : scratch.data();
+                run_stage<Inverse>(stage, source, destination);
+                source = destination;
+                to_output = !to_output;
+            }
+        }
+
+        /**
+         * The forward transform, X(k) = sum(x(j) * e^(-2πijk/N))
+         * @throws std::invalid_argument when the spans don't have the size of the plan
+         */
+        void forward(std::span<const complex_type> in, std::span<complex_type> out) const {
+            check_sizes(in.size(), out.size());
+            transform<false>(in, out);
+        }
+
+        /**
+         * The inverse transform, x(j) = sum(X(k) * e^(2πijk/N)) / N
+         * @throws std::invalid_argument when the spans don't have the size of the plan
+         */
+        void inverse(std::span<const complex_type> in, std::span<complex_type> out) const {
+            check_sizes(in.size(), out.size());
+            transform<true>(in, out);
+            const T scale = T {1} / static_cast<T>(_size);
+            for (auto& c : out)
+                c *= scale;
+        }
+    };
+
+    /**
+     * @brief A reusable Fast Fourier Transform of real signals of a fixed size
+     *
+     * The spectrum of a real signal is hermitian, X(N - k) = conj(X(k)), so only
+     * its first N / 2 + 1 bins are computed and accepted back by the inverse transform
+     */
+    template <std::floating_point T = double>
+    class RealFftPlan {
+    public:
+        using complex_type = std::complex<T>;
+
+    private:
+        std::size_t _size;
+        FftPlan<T> _complex;                    // Of the half of the size, or of the whole size when it's odd
+        std::vector<complex_type> _twiddles;    // e^(-2πik/N), for the split of the packed spectrum
+
+        [[nodiscard]] static std::vector<complex_type>& packing_scratch(std::size_t size) {
+            thread_local std::vector<complex_type> scratch;
+            if (scratch.size() < size)
+                scratch.resize(size);
+            return scratch;
+        }
+
+        /// The even sizes are packed into a complex signal of half their size, but the empty one, that has nothing to pack
+        [[nodiscard]] bool is_packed() const noexcept { return _size % 2 == 0 && _size != 0; }
+
+    public:
+        explicit RealFftPlan(std::size_t size)
+            : _size {size}
+            , _complex {size % 2 == 0 && size != 0 ? size / 2 : size}
+            , _twiddles {}
+        {
+            if (is_packed()) {
+                _twiddles.reserve(size / 2);
+                for (std::size_t k = 0; k < size / 2; ++k)
+                    _twiddles.push_back(fourier::__detail::root_of_unity<T>(k, size));
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+        /// @return the number of bins of the spectrum, N / 2 + 1, or none for an empty signal
+        [[nodiscard]] std::size_t spectrum_size() const noexcept { return _size == 0 ? 0 : _size / 2 + 1; }
+
+        /**
+         * The forward transform of `in`, writing the first N / 2 + 1 bins of its spectrum in `out`
+         * @throws std::invalid_argument when the spans don't have the sizes of the plan
+         */
+        void forward(std::span<const T> in, std::span<complex_type> out) const {
+            using fourier::__detail::mul;
+            if (in.size() != _size || out.size() != spectrum_size())
+                throw std::invalid_argument("RealFftPlan: the spans don't match the sizes of the plan");
+
+            if (!is_packed()) {
+                auto& buffer = packing_scratch(_size);
+                const std::span<complex_type> work {buffer.data(), _size};
+                for (std::size_t j = 0; j < _size; ++j)
+                    work[j] = {in[j], T {}};
+                _complex.template transform<false>(work, work);
+                std::copy_n(work.begin(), out.size(), out.begin());
+                return;
+            }
+
+            // Pack the even samples as the real parts and the odd ones as the imaginary parts, and
+            // split the spectrum of the packed signal into the spectra of the even and odd samples
+            const std::size_t half = _size / 2;
+            for (std::size_t k = 0; k < half; ++k)
+                out[k] = {in[2 * k], in[2 * k + 1]};
+            _complex.template transform<false>(out.first(half), out.first(half));
+
+            const complex_type z0 = out[0];
+            out[0] = {z0.real() + z0.imag(), T {}};
+            out[half] = {z0.real() - z0.imag(), T {}};
+            for (std::size_t k = 1; k <= half / 2; ++k) {
+                const complex_type zk = out[k];
+                const complex_type zm = std::conj(out[half - k]);
+                const complex_type even = (zk + zm) * T {0.5};
+                const complex_type odd = mul(fourier::__detail::rotate<false>(zk - zm) * T {0.5}, _twiddles[k]);
+                out[half - k] = std::conj(even - odd);
+                out[k] = even + odd;
+            }
+        }
+
+        /**
+         * The inverse transform of the N / 2 + 1 bins of the spectrum of a real signal,
+         * normalized by 1/N
+         * @throws std::invalid_argument when the spans don't have the sizes of the plan
+         */
+        void inverse(std::span<const complex_type> in, std::span<T> out) const {
+            using fourier::__detail::mul;
+            if (in.size() != spectrum_size() || out.size() != _size)
+                throw std::invalid_argument("RealFftPlan: the spans don't match the sizes of the plan");
+
+            if (!is_packed()) {
+                auto& buffer = packing_scratch(_size);
+                const std::span<complex_type> work {buffer.data(), _size};
+                for (std::size_t k = 0; k < in.size(); ++k) {
+                    work[k] = in[k];
+                    if (k != 0)
+                        work[_size - k] = std::conj(in[k]);
+                }
+                _complex.inverse(work, work);
+                for (std::size_t j = 0; j < _size; ++j)
+                    out[j] = work[j].real();
+                return;
+            }
+
+            // Merge back the spectra of the even and odd samples into the one of the packed signal
+            const std::size_t half = _size / 2;
+            auto& buffer = packing_scratch(half);
+            const std::span<complex_type> work {buffer.data(), half};
+            for (std::size_t k = 0; k < half; ++k) {
+                const complex_type xk = in[k];
+                const complex_type xm = std::conj(in[half - k]);
+                const complex_type even = (xk + xm) * T {0.5};
+                const complex_type odd = mul((xk - xm) * T {0.5}, std::conj(_twiddles[k]));
+                work[k] = even + fourier::__detail::rotate<true>(odd);
+            }
+            _complex.inverse(work, work);
+            for (std::size_t k = 0; k < half; ++k) {
+                out[2 * k] = work[k].real();
+                out[2 * k + 1] = work[k].imag();
+            }
+        }
+    };
+}
@@ -0,0 +1,10 @@
+/**
+ * The root of the `fft` math library
+ *
+ * Fast Fourier Transforms of complex and real signals, of any size, with
+ * reusable plans and batched multithreaded transforms
+ */
+export module math.fft;
+
+export import :plan;
+export import :transforms;
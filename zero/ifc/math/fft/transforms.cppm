@@ -0,0 +1,162 @@
+/**
+ * @brief The Fast Fourier Transform functions
+ *
+ * Free functions over spans, backed by a process wide cache of plans keyed by their size,
+ * so only the first transform of every size pays for the construction of its plan.
+ * The cache is guarded by a mutex, while the transforms themselves run without locks.
+ *
+ * The batched transforms compute many signals of the same size, stored one after the
+ * other, splitting them between several threads.
+ */
+
+export module math.fft:transforms;
+
+import std;
+import :plan;
+
+namespace fourier::__detail {
+    template <typename Plan>
+    class PlanCache {
+    private:
+        std::mutex _mutex {};
+        std::unordered_map<std::size_t, std::shared_ptr<const Plan>> _plans {};
+
+    public:
+        [[nodiscard]] std::shared_ptr<const Plan> get(std::size_t size) {
+            {
+                const std::lock_guard lock {_mutex};
+                if (const auto it = _plans.find(size); it != _plans.end())
+                    return it->second;
+            }
+            // Built without holding the lock, so big plans don't block the lookups of other sizes
+            auto plan = std::make_shared<const Plan>(size);
+            const std::lock_guard lock {_mutex};
+            return _plans.try_emplace(size, std::move(plan)).first->second;
+        }
+
+        void clear() {
+            const std::lock_guard lock {_mutex};
+            _plans.clear();
+        }
+    };
+
+    template <typename Plan>
+    [[nodiscard]] PlanCache<Plan>& plan_cache() {
+        static PlanCache<Plan> cache;
+        return cache;
+    }
+
+    /// Below this number of points per thread, spawning the threads costs more than the transforms
+    constexpr std::size_t min_points_per_thread = std::size_t {1} << 15;
+
+    /// Calls `task(first, last)` over the range of signals [0, count), split between up to `threads` threads
+    template <typename F>
+    void parallel_batches(std::size_t count, std::size_t size, std::size_t threads, F task) {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = std::min({threads, count, std::max<std::size_t>(1, count * size / min_points_per_thread)});
+        if (threads <= 1) {
+            task(std::size_t {0}, count);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        const std::size_t chunk = count / threads;
+        const std::size_t remainder = count % threads;
+        std::size_t first = 0;
+        for (std::size_t t = 0; t < threads; ++t) {
+            const std::size_t last = first + chunk + (t < remainder ? 1 : 0);
+            if (t + 1 == threads)
+                task(first, last); // The calling thread takes the last chunk
+            else
+                workers.emplace_back(task, first, last);
+            first = last;
+        }
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    template <bool Inverse, typename T>
+    void batch(std::span<const std::complex<T>> in, std::span<std::complex<T>> out, std::size_t size, std::size_t threads) {
+        if (size == 0 || in.size() % size != 0 || in.size() != out.size())
+            throw std::invalid_argument("fft_batch: the spans must hold the same whole number of signals");
+        const auto plan = plan_cache<zero::math::FftPlan<T>>().get(size);
+        parallel_batches(in.size() / size, size, threads, [&plan, in, out, size](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                if constexpr (Inverse)
+                    plan->inverse(in.subspan(i * size, size), out.subspan(i * size, size));
+                else
+                    plan->forward(in.subspan(i * size, size), out.subspan(i * size, size));
+            }
+        });
+    }
+}
+
+export namespace zero::math {
+    /// @return the cached complex plan of `size` points, building it on its first use
+    template <std::floating_point T = double>
+    [[nodiscard]] std::shared_ptr<const FftPlan<T>> fft_plan(std::size_t size) {
+        return fourier::__detail::plan_cache<FftPlan<T>>().get(size);
+    }
+
+    /// @return the cached real plan of `size` points, building it on its first use
+    template <std::floating_point T = double>
+    [[nodiscard]] std::shared_ptr<const RealFftPlan<T>> real_fft_plan(std::size_t size) {
+        return fourier::__detail::plan_cache<RealFftPlan<T>>().get(size);
+    }
+
+    /// Releases every cached plan. The plans that are still referenced stay alive until released
+    template <std::floating_point T = double>
+    void clear_fft_plans() {
+        fourier::__detail::plan_cache<FftPlan<T>>().clear();
+        fourier::__detail::plan_cache<RealFftPlan<T>>().clear();
+    }
+
+    /**
+     * The forward complex transform of `in` into `out`, that must have the same size.
+     * Both can be the same span
+     */
+    template <std::floating_point T = double>
+    void fft(std::span<const std::complex<std::type_identity_t<T>>> in, std::span<std::complex<std::type_identity_t<T>>> out) {
+        fft_plan<T>(in.size())->forward(in, out);
+    }
+
+    /// The inverse complex transform of `in` into `out`, normalized by 1/N
+    template <std::floating_point T = double>
+    void ifft(std::span<const std::complex<std::type_identity_t<T>>> in, std::span<std::complex<std::type_identity_t<T>>> out) {
+        fft_plan<T>(in.size())->inverse(in, out);
+    }
+
+    /// The forward transform of the real signal `in`, writing its N / 2 + 1 non-redundant bins in `out`
+    template <std::floating_point T = double>
+    void rfft(std::span<const std::type_identity_t<T>> in, std::span<std::complex<std::type_identity_t<T>>> out) {
+        real_fft_plan<T>(in.size())->forward(in, out);
+    }
+
+    /// The inverse of {@link rfft}, recovering the real signal `out` from its N / 2 + 1 bins
+    template <std::floating_point T = double>
+    void irfft(std::span<const std::complex<std::type_identity_t<T>>> in, std::span<std::type_identity_t<T>> out) {
+        real_fft_plan<T>(out.size())->inverse(in, out);
+    }
+
+    /**
+     * The forward complex transforms of the consecutive signals of `size` points stored in `in`
+     * @param threads the maximum number of threads used, all the hardware ones when zero
+     * @throws std::invalid_argument when the spans don't hold the same whole number of signals
+     */
+    template <std::floating_point T = double>
+    void fft_batch(std::span<const std::complex<std::type_identity_t<T>>> in,
+                   std::span<std::complex<std::type_identity_t<T>>> out,
+                   std::size_t size, std::size_t threads = 0) {
+        fourier::__detail::batch<false, T>(in, out, size, threads);
+    }
+
+    /// The batched version of {@link ifft}. See {@link fft_batch}
+    template <std::floating_point T = double>
+    void ifft_batch(std::span<const std::complex<std::type_identity_t<T>>> in,
+                    std::span<std::complex<std::type_identity_t<T>>> out,
+                    std::size_t size, std::size_t threads = 0) {
+        fourier::__detail::batch<true, T>(in, out, size, threads);
+    }
+}
@@ -9,4 +9,8 @@ export module math;
 
 export import math.ops;
 export import math.symbols;
-export import math.linear_algebra;
\ No newline at end of file
+export import math.linear_algebra;
+export import math.numbers;
+export import math.statistics;
+export import math.random;
+export import math.fft;
\ No newline at end of file
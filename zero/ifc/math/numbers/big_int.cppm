@@ -0,0 +1,590 @@
+/**
+ * @brief Arbitrary-precision signed integers
+ *
+ * `BigInt` stores its magnitude as a little-endian sequence of 64-bit limbs
+ * with a sign flag on the side. Small values (up to `inline_limbs` limbs) live
+ * directly inside the object, so the common case of numbers that barely
+ * overflow the built-in types never touches the heap.
+ *
+ * Multiplication uses the schoolbook algorithm for small operands and switches
+ * to Karatsuba once both operands exceed `karatsuba_threshold` limbs. Division
+ * is Knuth's algorithm D, with a fast path for single limb divisors, which is
+ * also what powers the base-10 conversions.
+ */
+
+export module math.numbers:big_int;
+
+import std;
+
+__extension__ typedef unsigned __int128 uint128;
+
+namespace big_int::__detail {
+    using limb = std::uint64_t;
+
+    /// The biggest power of ten that fits in a limb, used as the radix for the decimal conversions
+    constexpr limb decimal_radix = 10'000'000'000'000'000'000ULL;
+    constexpr std::size_t decimal_radix_digits = 19;
+
+    /// Returns the number of significant limbs, discarding the leading zeroes
+    [[nodiscard]] constexpr std::size_t normalized_size(const limb* a, std::size_t n) noexcept {
+        while (n > 0 && a[n - 1] == 0)
+            --n;
+        return n;
+    }
+
+    /// Three way comparison of two normalized magnitudes
+    [[nodiscard]] constexpr int compare(const limb* a, std::size_t n, const limb* b, std::size_t m) noexcept {
+        if (n != m)
+            return n < m ? -1 : 1;
+        for (std::size_t i = n; i-- > 0;)
+            if (a[i] != b[i])
+                return a[i] < b[i] ? -1 : 1;
+        return 0;
+    }
+
+    /// out[0..n] = a[0..n) + b[0..m), with n >= m. Returns the final carry, also stored at out[n]
+    constexpr limb add(const limb* a, std::size_t n, const limb* b, std::size_t m, limb* out) noexcept {
+        limb carry = 0;
+        for (std::size_t i = 0; i < m; ++i) {
+            const uint128 sum = static_cast<uint128>(a[i]) + b[i] + carry;
+            out[i] = static_cast<limb>(sum);
+            carry = static_cast<limb>(sum >> 64);
+        }
+        for (std::size_t i = m; i < n; ++i) {
+            const uint128 sum = static_cast<uint128>(a[i]) + carry;
+            out[i] = static_cast<limb>(sum);
+            carry = static_cast<limb>(sum >> 64);
+        }
+        out[n] = carry;
+        return carry;
+    }
+
+    /// out[0..n) = a[0..n) - b[0..m), with a >= b
+    constexpr void sub(const limb* a, std::size_t n, const limb* b, std::size_t m, limb* out) noexcept {
+        limb borrow = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const limb rhs = i < m ? b[i] : 0;
+            const limb diff = a[i] - rhs - borrow;
+            borrow = (a[i] < rhs || (a[i] == rhs && borrow)) ? 1 : 0;
+            out[i] = diff;
+        }
+    }
+
+    /// acc[0..) += a[0..n). The caller guarantees that acc has room for the carry propagation
+    constexpr void add_in_place(limb* acc, const limb* a, std::size_t n) noexcept {
+        limb carry = 0;
+        std::size_t i = 0;
+        for (; i < n; ++i) {
+            const uint128 sum = static_cast<uint128>(acc[i]) + a[i] + carry;
+            acc[i] = static_cast<limb>(sum);
+            carry = static_cast<limb>(sum >> 64);
+        }
+        for (; carry != 0; ++i) {
+            acc[i] += carry;
+            carry = acc[i] == 0 ? 1 : 0;
+        }
+    }
+
+    /// acc[0..n) -= a[0..m), with acc >= a
+    constexpr void sub_in_place(limb* acc, std::size_t n, const limb* a, std::size_t m) noexcept {
+        sub(acc, n, a, m, acc);
+    }
+
+    /// out[0..n+m) = a[0..n) * b[0..m), the classic O(n*m) algorithm. `out` must be zeroed
+    constexpr void mul_schoolbook(const limb* a, std::size_t n, const limb* b, std::size_t m, limb* out) noexcept {
+        for (std::size_t i = 0; i < n; ++i) {
+            limb carry = 0;
+            for (std::size_t j = 0; j < m; ++j) {
+                const uint128 product = static_cast<uint128>(a[i]) * b[j] + out[i + j] + carry;
+                out[i + j] = static_cast<limb>(product);
+                carry = static_cast<limb>(product >> 64);
+            }
+            out[i + m] = carry;
+        }
+    }
+
+    /// Multiplies a[0..n) by a single limb and adds `carry`, in place. Returns the carry out
+    constexpr limb mul_small(limb* a, std::size_t n, limb factor, limb carry) noexcept {
+        for (std::size_t i = 0; i < n; ++i) {
+            const uint128 product = static_cast<uint128>(a[i]) * factor + carry;
+            a[i] = static_cast<limb>(product);
+            carry = static_cast<limb>(product >> 64);
+        }
+        return carry;
+    }
+
+    /// Divides a[0..n) by a single limb, in place. Returns the remainder
+    constexpr limb div_small(limb* a, std::size_t n, limb divisor) noexcept {
+        uint128 remainder = 0;
+        for (std::size_t i = n; i-- > 0;) {
+            const uint128 current = (remainder << 64) | a[i];
+            a[i] = static_cast<limb>(current / divisor);
+            remainder = current % divisor;
+        }
+        return static_cast<limb>(remainder);
+    }
+
+    /// Operand size (in limbs) from which the Karatsuba multiplication beats the schoolbook one
+    constexpr std::size_t karatsuba_threshold = 32;
+
+    /// out[0..n+m) = a[0..n) * b[0..m). `out` must be zeroed
+    void mul(const limb* a, std::size_t n, const limb* b, std::size_t m, limb* out) {
+        if (n < m) {
+            std::swap(a, b);
+            std::swap(n, m);
+        }
+        if (m == 0)
+            return;
+        if (m < karatsuba_threshold) {
+            mul_schoolbook(a, n, b, m, out);
+            return;
+        }
+
+        // Unbalanced operands: slice the longest one in chunks of the size of the shortest one
+        if (n >= 2 * m) {
+            std::vector<limb> partial(2 * m);
+            for (std::size_t offset = 0; offset < n; offset += m) {
+                const std::size_t chunk = std::min(m, n - offset);
+                std::fill(partial.begin(), partial.end(), 0);
+                mul(a + offset, chunk, b, m, partial.data());
+                add_in_place(out + offset, partial.data(), chunk + m);
+            }
+            return;
+        }
+
+        // Karatsuba: a = a1*B^k + a0, b = b1*B^k + b0
+        // a*b = z2*B^2k + (z1 - z2 - z0)*B^k + z0, with z1 = (a0 + a1)*(b0 + b1)
+        const std::size_t k = n / 2;
+        const std::size_t a1_size = n - k;
+        const std::size_t b1_size = m - k;
+
+        std::vector<limb> z0(2 * k, 0);
+        mul(a, k, b, k, z0.data());
+        std::vector<limb> z2(a1_size + b1_size, 0);
+        mul(a + k, a1_size, b + k, b1_size, z2.data());
+
+        std::vector<limb> a_sum(a1_size + 1);
+        add(a + k, a1_size, a, k, a_sum.data());
+        const std::size_t b_sum_size = std::max(k, b1_size) + 1;
+        std::vector<limb> b_sum(b_sum_size);
+        if (b1_size >= k)
+            add(b + k, b1_size, b, k, b_sum.data());
+        else
+            add(b, k, b + k, b1_size, b_sum.data());
+
+        std::vector<limb> z1(a_sum.size() + b_sum.size(), 0);
+        mul(a_sum.data(), normalized_size(a_sum.data(), a_sum.size()),
+            b_sum.data(), normalized_size(b_sum.data(), b_sum.size()), z1.data());
+        sub_in_place(z1.data(), z1.size(), z0.data(), z0.size());
+        sub_in_place(z1.data(), z1.size(), z2.data(), z2.size());
+
+        std::copy(z0.begin(), z0.end(), out);
+        std::copy(z2.begin(), z2.end(), out + 2 * k);
+        add_in_place(out + k, z1.data(), normalized_size(z1.data(), z1.size()));
+    }
+
+    /**
+     * Knuth's algorithm D (TAOCP vol. 2, 4.3.1) for m-limbs by n-limbs division, with n >= 2.
+     * The quotient is written in q[0..m-n], and the remainder replaces u[0..n)
+     */
+    void div_knuth(std::vector<limb>& u, std::vector<limb>& v, limb* q) {
+        const std::size_t n = v.size();
+        const std::size_t m = u.size();
+
+        // D1. Normalize so the most significant limb of the divisor has its high bit set. The
+        // dividend grows an extra limb to hold the bits shifted out of its top
+        const int shift = std::countl_zero(v[n - 1]);
+        u.push_back(0);
+        if (shift != 0) {
+            for (std::size_t i = n; i-- > 1;)
+                v[i] = (v[i] << shift) | (v[i - 1] >> (64 - shift));
+            v[0] <<= shift;
+            for (std::size_t i = m + 1; i-- > 1;)
+                u[i] = (u[i] << shift) | (u[i - 1] >> (64 - shift));
+            u[0] <<= shift;
+        }
+
+        const limb v_high = v[n - 1];
+        const limb v_next = v[n - 2];
+
+        for (std::size_t j = m - n + 1; j-- > 0;) {
+            // D3. Estimate the quotient limb
+            const uint128 numerator = (static_cast<uint128>(u[j + n]) << 64) | u[j + n - 1];
+            uint128 q_hat = numerator / v_high;
+            uint128 r_hat = numerator % v_high;
+            while (q_hat >> 64 != 0 ||
+                   q_hat * v_next > ((r_hat << 64) | u[j + n - 2])) {
+                --q_hat;
+                r_hat += v_high;
+                if (r_hat >> 64 != 0)
+                    break;
+            }
+
+            // D4. Multiply and subtract
+            limb borrow = 0;
+            limb carry = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const uint128 product = q_hat * v[i] + carry;
+                carry = static_cast<limb>(product >> 64);
+                const limb low = static_cast<limb>(product);
+                const limb diff = u[i + j] - low - borrow;
+                borrow = (u[i + j] < low || (u[i + j] == low && borrow)) ? 1 : 0;
+                u[i + j] = diff;
+            }
+            const limb top = u[j + n];
+            u[j + n] = top - carry - borrow;
+            const bool negative = top < carry || (top == carry && borrow);
+
+            // D5/D6. Add back if we subtracted too much, which is rare
+            if (negative) {
+                --q_hat;
+                limb add_carry = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const uint128 sum = static_cast<uint128>(u[i + j]) + v[i] + add_carry;
+                    u[i + j] = static_cast<limb>(sum);
+                    add_carry = static_cast<limb>(sum >> 64);
+                }
+                u[j + n] += add_carry;
+            }
+            q[j] = static_cast<limb>(q_hat);
+        }
+
+        // D8. Unnormalize the remainder
+        u.resize(n);
+        if (shift != 0) {
+            for (std::size_t i = 0; i + 1 < n; ++i)
+                u[i] = (u[i] >> shift) | (u[i + 1] << (64 - shift));
+            u[n - 1] >>= shift;
+        }
+    }
+}
+
+export namespace zero::math {
+    /**
+     * @brief An arbitrary-precision signed integer
+     *
+     * Behaves as a regular integral type, supporting the arithmetic operators, the
+     * comparisons and the conversions from and to its decimal representation.
+     * Division truncates towards zero, and the remainder takes the sign of the
+     * dividend, exactly as for the built-in integers.
+     */
+    class BigInt {
+    public:
+        using limb = std::uint64_t;
+
+        /// Number of limbs that are stored inline, without allocating
+        static constexpr std::size_t inline_limbs = 2;
+
+    private:
+        std::size_t _size = 0;
+        std::size_t _capacity = inline_limbs;
+        bool _negative = false;
+        std::array<limb, inline_limbs> _small {};
+        std::unique_ptr<limb[]> _large {};
+
+        [[nodiscard]] limb* data() noexcept { return _large ? _large.get() : _small.data(); }
+        [[nodiscard]] const limb* data() const noexcept { return _large ? _large.get() : _small.data(); }
+
+        /// Makes room for `limbs` limbs, zeroing them. The previous value is discarded
+        void reset(std::size_t limbs) {
+            if (limbs > _capacity) {
+                _large = std::make_unique<limb[]>(limbs);
+                _capacity = limbs;
+            } else {
+                std::fill_n(data(), limbs, limb {0});
+            }
+            _size = limbs;
+        }
+
+        /// Drops the leading zero limbs and the sign of the zero
+        void normalize() noexcept {
+            _size = big_int::__detail::normalized_size(data(), _size);
+            if (_size == 0)
+                _negative = false;
+        }
+
+        void assign(const limb* limbs, std::size_t n, bool negative) {
+            reset(n);
+            std::copy_n(limbs, n, data());
+            _negative = negative;
+            normalize();
+        }
+
+        /// Sum or subtraction of the magnitudes, resolving the sign of the result
+        [[nodiscard]] static BigInt add_signed(const BigInt& lhs, const BigInt& rhs, bool rhs_negative) {
+            BigInt result;
+            const limb* a = lhs.data();
+            const limb* b = rhs.data();
+            std::size_t n = lhs._size;
+            std::size_t m = rhs._size;
+
+            if (lhs._negative == rhs_negative) {
+                if (n < m) {
+                    std::swap(a, b);
+                    std::swap(n, m);
+                }
+                result.reset(n + 1);
+                big_int::__detail::add(a, n, b, m, result.data());
+                result._negative = lhs._negative;
+            } else if (big_int::__detail::compare(a, n, b, m) >= 0) {
+                result.reset(n);
+                big_int::__detail::sub(a, n, b, m, result.data());
+                result._negative = lhs._negative;
+            } else {
+                result.reset(m);
+                big_int::__detail::sub(b, m, a, n, result.data());
+                result._negative = rhs_negative;
+            }
+            result.normalize();
+            return result;
+        }
+
+    public:
+        BigInt() noexcept = default;
+
+        template <std::integral T>
+        BigInt(T value) {  // NOLINT: implicit by design, like the built-in promotions
+            using U = std::make_unsigned_t<T>;
+            U magnitude = static_cast<U>(value);
+            if constexpr (std::is_signed_v<T>) {
+                if (value < 0) {
+                    _negative = true;
+                    magnitude = static_cast<U>(U {0} - magnitude);
+                }
+            }
+            _small[0] = static_cast<limb>(magnitude);
+            _size = magnitude == 0 ? 0 : 1;
+        }
+
+        /**
+         * Parses a base-10 number, with an optional leading sign
+         * @throws std::invalid_argument if `decimal` isn't a well-formed number
+         */
+        explicit BigInt(std::string_view decimal) {
+            bool negative = false;
+            if (!decimal.empty() && (decimal.front() == '-' || decimal.front() == '+')) {
+                negative = decimal.front() == '-';
+                decimal.remove_prefix(1);
+            }
+            if (decimal.empty())
+                throw std::invalid_argument("BigInt: empty decimal string");
+
+            const std::size_t max_limbs = decimal.size() / big_int::__detail::decimal_radix_digits + 2;
+            reset(max_limbs);
+            _size = 0;
+
+            // Consume the digits in chunks of 19, so every step is a single limb multiply-add
+            std::size_t first_chunk = decimal.size() % big_int::__detail::decimal_radix_digits;
+            if (first_chunk == 0)
+                first_chunk = big_int::__detail::decimal_radix_digits;
+            for (std::size_t pos = 0; pos < decimal.size();) {
+                const std::size_t len = pos == 0 ? first_chunk : big_int::__detail::decimal_radix_digits;
+                limb chunk = 0;
+                limb scale = 1;
+                for (std::size_t i = pos; i < pos + len; ++i) {
+                    const char c = decimal[i];
+                    if (c < '0' || c > '9')
+                        throw std::invalid_argument("BigInt: invalid decimal digit");
+                    chunk = chunk * 10 + static_cast<limb>(c - '0');
+                    scale *= 10;
+                }
+                const limb carry = big_int::__detail::mul_small(data(), _size, scale, chunk);
+                if (carry != 0)
+                    data()[_size++] = carry;
+                pos += len;
+            }
+            _negative = negative;
+            normalize();
+        }
+
+        BigInt(const BigInt& other) { assign(other.data(), other._size, other._negative); }
+        BigInt(BigInt&& other) noexcept
+            : _size {other._size}
+            , _capacity {other._capacity}
+            , _negative {other._negative}
+            , _small {other._small}
+            , _large {std::move(other._large)}
+        {
+            other._size = 0;
+            other._capacity = inline_limbs;
+            other._negative = false;
+        }
+
+        BigInt& operator=(const BigInt& other) {
+            if (this != &other)
+                assign(other.data(), other._size, other._negative);
+            return *this;
+        }
+        BigInt& operator=(BigInt&& other) noexcept {
+            if (this != &other) {
+                _size = std::exchange(other._size, 0);
+                _capacity = std::exchange(other._capacity, inline_limbs);
+                _negative = std::exchange(other._negative, false);
+                _small = other._small;
+                _large = std::move(other._large);
+            }
+            return *this;
+        }
+
+        ~BigInt() = default;
+
+        [[nodiscard]] bool is_zero() const noexcept { return _size == 0; }
+        [[nodiscard]] bool is_negative() const noexcept { return _negative; }
+
+        /// @return -1, 0 or 1 depending on the sign of the number
+        [[nodiscard]] int sign() const noexcept { return _size == 0 ? 0 : (_negative ? -1 : 1); }
+
+        /// @return the number of significant limbs of the magnitude
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+        /// @return the number of bits needed to represent the magnitude
+        [[nodiscard]] std::size_t bit_width() const noexcept {
+            return _size == 0 ? 0 : (_size - 1) * 64 + static_cast<std::size_t>(std::bit_width(data()[_size - 1]));
+        }
+
+        /// @return a read-only view of the little-endian limbs of the magnitude
+        [[nodiscard]] std::span<const limb> limbs() const noexcept { return {data(), _size}; }
+
+        [[nodiscard]] BigInt abs() const {
+            BigInt result {*this};
+            result._negative = false;
+            return result;
+        }
+
+        /**
+         * Computes the quotient and the remainder in a single pass
+         * @throws std::domain_error when the divisor is zero
+         */
+        [[nodiscard]] static std::pair<BigInt, BigInt> div_mod(const BigInt& dividend, const BigInt& divisor) {
+            if (divisor.is_zero())
+                throw std::domain_error("BigInt: division by zero");
+
+            BigInt quotient;
+            BigInt remainder;
+            if (big_int::__detail::compare(dividend.data(), dividend._size, divisor.data(), divisor._size) < 0) {
+                remainder = dividend;
+                return {std::move(quotient), std::move(remainder)};
+            }
+
+            if (divisor._size == 1) {
+                quotient.assign(dividend.data(), dividend._size, false);
+                const limb r = big_int::__detail::div_small(quotient.data(), quotient._size, divisor.data()[0]);
+                remainder = BigInt {r};
+            } else {
+                std::vector<limb> u(dividend.data(), dividend.data() + dividend._size);
+                std::vector<limb> v(divisor.data(), divisor.data() + divisor._size);
+                quotient.reset(dividend._size - divisor._size + 1);
+                big_int::__detail::div_knuth(u, v, quotient.data());
+                remainder.assign(u.data(), u.size(), false);
+            }
+
+            quotient._negative = dividend._negative != divisor._negative;
+            quotient.normalize();
+            remainder._negative = dividend._negative;
+            remainder.normalize();
+            return {std::move(quotient), std::move(remainder)};
+        }
+
+        /// @return `base` raised to `exponent`, by repeated squaring
+        [[nodiscard]] static BigInt pow(BigInt base, unsigned exponent) {
+            BigInt result {1};
+            while (exponent != 0) {
+                if (exponent & 1U)
+                    result *= base;
+                exponent >>= 1U;
+                if (exponent != 0)
+                    base *= base;
+            }
+            return result;
+        }
+
+        /// @return the base-10 representation of the number
+        [[nodiscard]] std::string to_string() const {
+            if (_size == 0)
+                return "0";
+
+            // Peel off chunks of 19 digits, least significant first
+            std::vector<limb> magnitude(data(), data() + _size);
+            std::vector<limb> chunks;
+            chunks.reserve(_size * 20 / 19 + 1);
+            std::size_t n = _size;
+            while (n > 0) {
+                chunks.push_back(big_int::__detail::div_small(magnitude.data(), n, big_int::__detail::decimal_radix));
+                n = big_int::__detail::normalized_size(magnitude.data(), n);
+            }
+
+            std::string out;
+            out.reserve(chunks.size() * big_int::__detail::decimal_radix_digits + 1);
+            if (_negative)
+                out += '-';
+            std::array<char, big_int::__detail::decimal_radix_digits> buffer {};
+            const auto [ptr, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), chunks.back());
+            out.append(buffer.data(), ptr);
+            for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+                const auto [end, err] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), chunks[i]);
+                const auto digits = static_cast<std::size_t>(end - buffer.data());
+                out.append(big_int::__detail::decimal_radix_digits - digits, '0');
+                out.append(buffer.data(), end);
+            }
+            return out;
+        }
+
+        [[nodiscard]] BigInt operator-() const {
+            BigInt result {*this};
+            if (!result.is_zero())
+                result._negative = !result._negative;
+            return result;
+        }
+
+        [[nodiscard]] friend BigInt operator+(const BigInt& lhs, const BigInt& rhs) {
+            return add_signed(lhs, rhs, rhs._negative);
+        }
+
+        [[nodiscard]] friend BigInt operator-(const BigInt& lhs, const BigInt& rhs) {
+            return add_signed(lhs, rhs, !rhs._negative && !rhs.is_zero());
+        }
+
+        [[nodiscard]] friend BigInt operator*(const BigInt& lhs, const BigInt& rhs) {
+            BigInt result;
+            if (lhs.is_zero() || rhs.is_zero())
+                return result;
+            result.reset(lhs._size + rhs._size);
+            big_int::__detail::mul(lhs.data(), lhs._size, rhs.data(), rhs._size, result.data());
+            result._negative = lhs._negative != rhs._negative;
+            result.normalize();
+            return result;
+        }
+
+        [[nodiscard]] friend BigInt operator/(const BigInt& lhs, const BigInt& rhs) {
+            return div_mod(lhs, rhs).first;
+        }
+
+        [[nodiscard]] friend BigInt operator%(const BigInt& lhs, const BigInt& rhs) {
+            return div_mod(lhs, rhs).second;
+        }
+
+        BigInt& operator+=(const BigInt& rhs) { return *this = *this + rhs; }
+        BigInt& operator-=(const BigInt& rhs) { return *this = *this - rhs; }
+        BigInt& operator*=(const BigInt& rhs) { return *this = *this * rhs; }
+        BigInt& operator/=(const BigInt& rhs) { return *this = *this / rhs; }
+        BigInt& operator%=(const BigInt& rhs) { return *this = *this % rhs; }
+
+        [[nodiscard]] friend bool operator==(const BigInt& lhs, const BigInt& rhs) noexcept {
+            return lhs._negative == rhs._negative &&
+                big_int::__detail::compare(lhs.data(), lhs._size, rhs.data(), rhs._size) == 0;
+        }
+
+        [[nodiscard]] friend std::strong_ordering operator<=>(const BigInt& lhs, const BigInt& rhs) noexcept {
+            if (lhs._negative != rhs._negative)
+                return lhs._negative ? std::strong_ordering::less : std::strong_ordering::greater;
+            const int magnitude = big_int::__detail::compare(lhs.data(), lhs._size, rhs.data(), rhs._size);
+            const int ordering = lhs._negative ? -magnitude : magnitude;
+            return ordering < 0 ? std::strong_ordering::less
+                : (ordering > 0 ? std::strong_ordering::greater : std::strong_ordering::equal);
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const BigInt& value) {
+            return os << value.to_string();
+        }
+    };
+}
@@ -0,0 +1,264 @@
+/**
+ * @brief Decimal (or any rational) fixed-point numbers
+ *
+ * `fixed<Rep, Scale>` stores an integer count of `Scale` units, so i.e. a
+ * `fixed<std::int64_t, Rational<1, 1000>>` holds thousandths exactly. Every operation,
+ * including the changes of scale, is performed with integer arithmetic only: the
+ * intermediate results are computed in 128 bits and rounded half away from zero, so
+ * the results are bit-reproducible on every platform and don't need a floating point unit.
+ *
+ * A result that doesn't fit in `Rep` throws `std::overflow_error`, instead of wrapping
+ * around, so it's a compile time error in a constant expression, like the overflows of
+ * the {@link Rational} terms.
+ */
+
+export module math.numbers:fixed;
+
+import std;
+import :rational;
+
+namespace fixed_point::__detail {
+    using zero::math::rational_int;
+
+    [[noreturn]] inline void overflow() {
+        throw std::overflow_error("fixed: the result doesn't fit in the representation");
+    }
+
+    /// The product of two 128-bit integers, which throws when it overflows
+    [[nodiscard]] constexpr rational_int checked_mul(rational_int a, rational_int b) {
+        rational_int result = 0;
+        if (__builtin_mul_overflow(a, b, &result))
+            overflow();
+        return result;
+    }
+
+    /// Converts a 128-bit intermediate result to `Rep`, which throws when it doesn't fit
+    template <std::signed_integral Rep>
+    [[nodiscard]] constexpr Rep narrow(rational_int value) {
+        if (value < std::numeric_limits<Rep>::min() || value > std::numeric_limits<Rep>::max())
+            overflow();
+        return static_cast<Rep>(value);
+    }
+
+    /// The quotient n / d rounded half away from zero, for a positive `d`
+    [[nodiscard]] constexpr rational_int divide_rounded(rational_int n, rational_int d) noexcept {
+        return n >= 0 ? n / d + (n % d >= d - d / 2) : n / d - (-(n % d) >= d - d / 2);
+    }
+
+    /// Scales the integer `value` by the fraction R, rounding the result
+    template <typename R>
+    [[nodiscard]] constexpr rational_int rescale(rational_int value) {
+        if constexpr (R::den == 1)
+            return checked_mul(value, R::num);
+        else
+            return divide_rounded(checked_mul(value, R::num), R::den);
+    }
+}
+
+export namespace zero::math {
+    /**
+     * @brief A fixed-point number, an integer count of `Scale` units
+     * @tparam Rep the signed integer type that stores the count
+     * @tparam Scale a {@link Rational} with the value of the least significant unit
+     */
+    template <std::signed_integral Rep, IsRational Scale = Rational<1, 1000>>
+    struct fixed {
+        static_assert(Scale::num > 0, "The scale of a fixed-point number must be positive");
+
+        using rep = Rep;
+        using scale = Scale;
+
+        /// The number of `Scale` units
+        Rep raw = 0;
+
+        constexpr fixed() noexcept = default;
+
+        /**
+         * The integer `value`, i.e. a `fixed<int, Rational<1, 100>>(3)` holds 300 hundredths
+         * @throws std::overflow_error when it's out of the range of the fixed-point number
+         */
+        template <std::integral I>
+        constexpr explicit fixed(I value)
+            : raw {fixed_point::__detail::narrow<Rep>(
+                fixed_point::__detail::rescale<rational_divide<Rational<1>, Scale>>(static_cast<rational_int>(value))
+            )} {}
+
+        /**
+         * The closest fixed-point number to `value`
+         * @throws std::overflow_error when it's out of the range of the fixed-point number, or not a number
+         */
+        template <std::floating_point F>
+        constexpr explicit fixed(F value) : raw {} {
+            const F units = value * static_cast<F>(Scale::den) / static_cast<F>(Scale::num);
+            const F rounded = units >= 0 ? units + F {0.5} : units - F {0.5};
+            // The powers of two are exact, so the bounds of `Rep` are too
+            constexpr F bound = -static_cast<F>(std::numeric_limits<Rep>::min());
+            if (!(rounded >= -bound && rounded < bound))
+                fixed_point::__detail::overflow();
+            raw = static_cast<Rep>(rounded);
+        }
+
+        /**
+         * The same number expressed with another representation and scale, rounding when the scale is coarser
+         * @throws std::overflow_error when it's out of the range of this representation
+         */
+        template <std::signed_integral Rep2, IsRational Scale2>
+        constexpr explicit fixed(const fixed<Rep2, Scale2>& other)
+            : raw {fixed_point::__detail::narrow<Rep>(fixed_point::__detail::rescale<rational_divide<Scale2, Scale>>(other.raw))} {}
+
+        /// The fixed-point number that holds `units` units of `Scale`
+        [[nodiscard]] static constexpr fixed from_raw(Rep units) noexcept {
+            fixed value;
+            value.raw = units;
+            return value;
+        }
+
+        template <std::floating_point F>
+        [[nodiscard]] constexpr explicit operator F() const noexcept {
+            return static_cast<F>(raw) * static_cast<F>(Scale::value);
+        }
+
+        /// @return this number scaled by the fraction R, i.e. a change of unit, rounding the result
+        template <IsRational R>
+        [[nodiscard]] constexpr fixed scaled() const {
+            return from_raw(fixed_point::__detail::narrow<Rep>(fixed_point::__detail::rescale<R>(raw)));
+        }
+
+        /**
+         * @return this number scaled by the fraction `num / den` known only at runtime, rounding the result like
+         * {@link scaled}. `den` must be positive
+         */
+        [[nodiscard]] constexpr fixed scaled(rational_int num, rational_int den) const {
+            return from_raw(fixed_point::__detail::narrow<Rep>(
+                fixed_point::__detail::divide_rounded(fixed_point::__detail::checked_mul(raw, num), den)
+            ));
+        }
+
+        /// The arithmetic operators throw `std::overflow_error` when their result is out of the range of `Rep`
+        constexpr fixed& operator+=(const fixed& rhs) {
+            if (__builtin_add_overflow(raw, rhs.raw, &raw))
+                fixed_point::__detail::overflow();
+            return *this;
+        }
+
+        constexpr fixed& operator-=(const fixed& rhs) {
+            if (__builtin_sub_overflow(raw, rhs.raw, &raw))
+                fixed_point::__detail::overflow();
+            return *this;
+        }
+
+        constexpr fixed& operator*=(const fixed& rhs) {
+            raw = fixed_point::__detail::narrow<Rep>(fixed_point::__detail::rescale<Scale>(static_cast<rational_int>(raw) * rhs.raw));
+            return *this;
+        }
+
+        constexpr fixed& operator/=(const fixed& rhs) {
+            const rational_int sign = rhs.raw < 0 ? -1 : 1;
+            raw = fixed_point::__detail::narrow<Rep>(fixed_point::__detail::divide_rounded(
+                fixed_point::__detail::checked_mul(sign * raw, Scale::den),
+                fixed_point::__detail::checked_mul(sign * rhs.raw, Scale::num)
+            ));
+            return *this;
+        }
+
+        /// Multiplies by an integer, which is exact, without the rounding of a change of scale
+        template <std::integral I>
+        constexpr fixed& operator*=(I factor) {
+            raw = fixed_point::__detail::narrow<Rep>(fixed_point::__detail::checked_mul(raw, static_cast<rational_int>(factor)));
+            return *this;
+        }
+
+        /// Divides by an integer, rounding half away from zero
+        template <std::integral I>
+        constexpr fixed& operator/=(I divisor) {
+            const rational_int sign = std::cmp_less(divisor, 0) ? -1 : 1;
+            raw = fixed_point::__detail::narrow<Rep>(fixed_point::__detail::divide_rounded(sign * raw, sign * static_cast<rational_int>(divisor)));
+            return *this;
+        }
+
+        [[nodiscard]] constexpr fixed operator-() const { return from_raw(fixed_point::__detail::narrow<Rep>(-static_cast<rational_int>(raw))); }
+
+        [[nodiscard]] friend constexpr fixed operator+(fixed lhs, const fixed& rhs) { return lhs += rhs; }
+        [[nodiscard]] friend constexpr fixed operator-(fixed lhs, const fixed& rhs) { return lhs -= rhs; }
+        [[nodiscard]] friend constexpr fixed operator*(fixed lhs, const fixed& rhs) { return lhs *= rhs; }
+        [[nodiscard]] friend constexpr fixed operator/(fixed lhs, const fixed& rhs) { return lhs /= rhs; }
+
+        // The integers are converted exactly, so they can be mixed with the fixed-point numbers
+        template <std::integral I>
+        [[nodiscard]] friend constexpr fixed operator+(fixed lhs, I rhs) { return lhs += fixed(rhs); }
+        template <std::integral I>
+        [[nodiscard]] friend constexpr fixed operator+(I lhs, const fixed& rhs) { return fixed(lhs) += rhs; }
+        template <std::integral I>
+        [[nodiscard]] friend constexpr fixed operator-(fixed lhs, I rhs) { return lhs -= fixed(rhs); }
+        template <std::integral I>
+        [[nodiscard]] friend constexpr fixed operator-(I lhs, const fixed& rhs) { return fixed(lhs) -= rhs; }
+        template <std::integral I>
+        [[nodiscard]] friend constexpr fixed operator*(fixed lhs, I rhs) { return lhs *= rhs; }
+        template <std::integral I>
+        [[nodiscard]] friend constexpr fixed operator*(I lhs, fixed rhs) { return rhs *= lhs; }
+        template <std::integral I>
+        [[nodiscard]] friend constexpr fixed operator/(fixed lhs, I rhs) { return lhs /= rhs; }
+        template <std::integral I>
+        [[nodiscard]] friend constexpr fixed operator/(I lhs, const fixed& rhs) { return fixed(lhs) /= rhs; }
+
+        [[nodiscard]] friend constexpr bool operator==(const fixed&, const fixed&) noexcept = default;
+        [[nodiscard]] friend constexpr auto operator<=>(const fixed&, const fixed&) noexcept = default;
+    };
+
+    template <typename T>
+    concept FixedPoint = std::is_same_v<T, fixed<typename T::rep, typename T::scale>>;
+
+    /**
+     * Writes `value` into [first, last). The decimal scales (the inverse of a power of ten)
+     * are written exactly, with all their fractional digits, and any other one as a double
+     */
+    template <std::signed_integral Rep, IsRational Scale>
+    std::to_chars_result to_chars(char* first, char* last, const fixed<Rep, Scale>& value) noexcept {
+        constexpr auto decimals = [] {
+            int digits = 0;
+            rational_int den = Scale::den;
+            while (den % 10 == 0) {
+                den /= 10;
+                ++digits;
+            }
+            return den == 1 && Scale::num == 1 && digits <= 18 ? digits : -1;
+        }();
+
+        if constexpr (decimals < 0)
+            return std::to_chars(first, last, static_cast<double>(value));
+        else if constexpr (decimals == 0)
+            return std::to_chars(first, last, static_cast<long long>(value.raw));
+        else {
+            constexpr auto divisor = static_cast<unsigned long long>(Scale::den);
+            const bool negative = value.raw < 0;
+            const auto magnitude = negative
+                ? 0ull - static_cast<unsigned long long>(value.raw)
+                : static_cast<unsigned long long>(value.raw);
+
+            if (negative) {
+                if (first == last)
+                    return {last, std::errc::value_too_large};
+                *first++ = '-';
+            }
+            const auto integer = std::to_chars(first, last, magnitude / divisor);
+            if (integer.ec != std::errc {} || last - integer.ptr < decimals + 1)
+                return {last, std::errc::value_too_large};
+
+            char* out = integer.ptr;
+            *out++ = '.';
+            auto fraction = magnitude % divisor;
+            for (int digit = decimals - 1; digit >= 0; --digit) {
+                out[digit] = static_cast<char>('0' + fraction % 10);
+                fraction /= 10;
+            }
+            return {out + decimals, std::errc {}};
+        }
+    }
+
+    template <std::signed_integral Rep, IsRational Scale>
+    std::ostream& operator<<(std::ostream& os, const fixed<Rep, Scale>& value) {
+        std::array<char, 64> buffer;
+        const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        return os << std::string_view {buffer.data(), result.ptr};
+    }
+}
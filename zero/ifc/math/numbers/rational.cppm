@@ -0,0 +1,234 @@
+/**
+ * @brief Exact compile-time rational numbers
+ *
+ * `Rational<Num, Den>` represents the fraction Num/Den as a type, always kept in its
+ * canonical form: reduced by their greatest common divisor and with a positive
+ * denominator. Both terms are 128-bit signed integers, so the whole range of
+ * the `SI` prefixes (from 10^-24 to 10^24) and their products can be represented
+ * without any loss of precision.
+ *
+ * The arithmetic is performed at the type level, through the `rational_multiply`,
+ * `rational_divide` and `rational_power` aliases, so every chain of operations is
+ * folded by the compiler into a single reduced constant. An operation that
+ * overflows the 128-bit terms is a compile time error.
+ */
+
+export module math.numbers:rational;
+
+import std;
+
+__extension__ typedef __int128 int128;
+__extension__ typedef unsigned __int128 uint128;
+
+namespace rational::__detail {
+    [[nodiscard]] constexpr int128 abs(int128 value) noexcept {
+        return value < 0 ? -value : value;
+    }
+
+    [[nodiscard]] constexpr int128 gcd(int128 a, int128 b) noexcept {
+        a = abs(a);
+        b = abs(b);
+        while (b != 0) {
+            const int128 t = b;
+            b = a % b;
+            a = t;
+        }
+        return a;
+    }
+
+    /// Multiplication that refuses to compile when the result doesn't fit in 128 bits
+    [[nodiscard]] constexpr int128 checked_mul(int128 a, int128 b) {
+        int128 result = 0;
+        if (__builtin_mul_overflow(a, b, &result))
+            throw std::overflow_error("Rational: the product overflows the 128-bit terms");
+        return result;
+    }
+
+    /**
+     * The quotient `a * b / c` truncated, computed with a 192-bit intermediate product, so it's exact
+     * for every 64-bit `a` and 127-bit `b` and `c`. It's the slow path for the products that
+     * overflow 128 bits, so a plain binary long division is enough
+     */
+    [[nodiscard]] constexpr uint128 wide_mul_div(std::uint64_t a, uint128 b, uint128 c) noexcept {
+        constexpr uint128 low = std::numeric_limits<std::uint64_t>::max();
+        const uint128 lower = static_cast<uint128>(a) * (b & low);
+        const uint128 upper = static_cast<uint128>(a) * (b >> 64);
+        const uint128 middle = (lower >> 64) + (upper & low);
+        const std::array<std::uint64_t, 3> limbs {
+            static_cast<std::uint64_t>((upper >> 64) + (middle >> 64)),
+            static_cast<std::uint64_t>(middle),
+            static_cast<std::uint64_t>(lower)
+        };
+
+        // The remainder is always smaller than `c`, so shifting it doesn't overflow
+        uint128 quotient = 0;
+        uint128 remainder = 0;
+        for (const std::uint64_t limb : limbs)
+            for (int bit = 63; bit >= 0; --bit) {
+                remainder = remainder << 1 | (limb >> bit & 1);
+                quotient <<= 1;
+                if (remainder >= c) {
+                    remainder -= c;
+                    quotient |= 1;
+                }
+            }
+        return quotient;
+    }
+
+    /// The integral `amount * num / den` truncated towards zero, without overflowing the intermediate product
+    template <typename T>
+    [[nodiscard]] constexpr T mul_div(T amount, int128 num, int128 den) noexcept {
+        int128 product = 0;
+        if (!__builtin_mul_overflow(static_cast<int128>(amount), num, &product))
+            return static_cast<T>(product / den);
+
+        const bool negative_amount = std::cmp_less(amount, 0);
+        const auto magnitude = negative_amount
+            ? 0 - static_cast<std::uint64_t>(amount)
+            : static_cast<std::uint64_t>(amount);
+        const uint128 quotient = wide_mul_div(
+            magnitude, num < 0 ? 0 - static_cast<uint128>(num) : static_cast<uint128>(num), static_cast<uint128>(den)
+        );
+        // The unsigned negation wraps into the two's complement of the result, that fits in T
+        return static_cast<T>(negative_amount != (num < 0) ? 0 - quotient : quotient);
+    }
+}
+
+export namespace zero::math {
+    /// The integer type used for the numerator and the denominator of a {@link Rational}
+    using rational_int = int128;
+
+    /**
+     * @brief An exact fraction Num/Den, reduced to its canonical form
+     * @tparam Num the numerator
+     * @tparam Den the denominator, which can't be zero
+     */
+    template <rational_int Num, rational_int Den = 1>
+    struct Rational {
+        static_assert(Den != 0, "The denominator of a Rational can't be zero");
+
+        static constexpr rational_int num = (Den < 0 ? -Num : Num) / rational::__detail::gcd(Num, Den);
+        static constexpr rational_int den = rational::__detail::abs(Den) / rational::__detail::gcd(Num, Den);
+
+        /// The canonical type of this fraction
+        using type = Rational<num, den>;
+
+        /// The closest double to the fraction, with a single rounding step per term
+        static constexpr double value = static_cast<double>(num) / static_cast<double>(den);
+
+        /**
+         * Scales `amount` by the fraction. Integral amounts are computed with integer
+         * arithmetic only, being a single multiplication or division whenever one of
+         * the terms is the unity. Floating point amounts take a single multiplication.
+         *
+         * When the product of an integral amount by the numerator overflows `T`, it's computed
+         * in 128 bits, or in 192 bits when it overflows those too, so the result is truncated
+         * towards zero and it's exact whenever it fits in `T`
+         */
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        [[nodiscard]] static constexpr T apply(T amount) noexcept {
+            if constexpr (std::is_floating_point_v<T>)
+                return amount * static_cast<T>(value);
+            else {
+                static_assert(sizeof(T) <= sizeof(std::uint64_t), "The integral amounts can't be wider than 64 bits");
+                constexpr auto max = static_cast<rational_int>(std::numeric_limits<T>::max());
+                if constexpr (num <= max && den <= max) {
+                    T product {};
+                    if constexpr (num == 1)
+                        return static_cast<T>(amount / static_cast<T>(den));
+                    else if (!__builtin_mul_overflow(amount, static_cast<T>(num), &product))
+                        return den == 1 ? product : static_cast<T>(product / static_cast<T>(den));
+                }
+                return rational::__detail::mul_div(amount, num, den);
+            }
+        }
+
+        /// Scales an amount that knows how to apply an exact factor to itself, i.e. a {@link fixed}
+        template <typename T>
+            requires (!std::is_arithmetic_v<T>) && requires (const T& amount) {
+                { amount.template scaled<type>() } -> std::same_as<T>;
+            }
+        [[nodiscard]] static constexpr T apply(const T& amount) noexcept(noexcept(amount.template scaled<type>())) {
+            return amount.template scaled<type>();
+        }
+    };
+
+    /**
+     * Scales an integral `amount` by the fraction `num / den` known only at runtime, i.e. the factor between
+     * two units selected at runtime, with the exact arithmetic of {@link Rational::apply}. `den` must be positive
+     */
+    template <std::integral T>
+    [[nodiscard]] constexpr T apply_fraction(T amount, rational_int num, rational_int den) noexcept {
+        static_assert(sizeof(T) <= sizeof(std::uint64_t), "The integral amounts can't be wider than 64 bits");
+        return rational::__detail::mul_div(amount, num, den);
+    }
+
+    template <typename T>
+    concept IsRational = requires {
+        T::num;
+        T::den;
+        requires std::is_same_v<T, Rational<T::num, T::den>>;
+    };
+
+    template <IsRational R1, IsRational R2>
+    struct rational_multiply_impl {
+    private:
+        // Cross reduce before multiplying, so the intermediate terms stay as small as possible
+        static constexpr rational_int g1 = rational::__detail::gcd(R1::num, R2::den);
+        static constexpr rational_int g2 = rational::__detail::gcd(R2::num, R1::den);
+    public:
+        using type = typename Rational<
+            rational::__detail::checked_mul(R1::num / g1, R2::num / g2),
+            rational::__detail::checked_mul(R1::den / g2, R2::den / g1)
+        >::type;
+    };
+
+    /// The exact product of two {@link Rational}
+    template <IsRational R1, IsRational R2>
+    using rational_multiply = typename rational_multiply_impl<R1, R2>::type;
+
+    /// The exact quotient of two {@link Rational}
+    template <IsRational R1, IsRational R2>
+        requires (R2::num != 0)
+    using rational_divide = rational_multiply<R1, typename Rational<R2::den, R2::num>::type>;
+
+    template <IsRational... Rs>
+    struct rational_product_impl {
+        using type = Rational<1>;
+    };
+
+    template <IsRational R, IsRational... Rs>
+    struct rational_product_impl<R, Rs...> {
+        using type = rational_multiply<R, typename rational_product_impl<Rs...>::type>;
+    };
+
+    /// The exact product of any number of {@link Rational}
+    template <IsRational... Rs>
+    using rational_product = typename rational_product_impl<Rs...>::type;
+
+    template <IsRational R, int Exponent>
+    struct rational_power_impl {
+        // Square the half power, so no intermediate term is bigger than the result
+        using half = typename rational_power_impl<R, Exponent / 2>::type;
+        using type = rational_multiply<
+            rational_multiply<half, half>,
+            std::conditional_t<(Exponent % 2 != 0), R, Rational<1>>
+        >;
+    };
+
+    template <IsRational R, int Exponent>
+        requires (Exponent < 0)
+    struct rational_power_impl<R, Exponent> {
+        using type = typename rational_power_impl<typename Rational<R::den, R::num>::type, -Exponent>::type;
+    };
+
+    template <IsRational R>
+    struct rational_power_impl<R, 0> {
+        using type = Rational<1>;
+    };
+
+    /// {@link Rational} R raised to an integral exponent, by repeated squaring
+    template <IsRational R, int Exponent>
+    using rational_power = typename rational_power_impl<R, Exponent>::type;
+}
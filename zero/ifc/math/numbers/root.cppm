@@ -0,0 +1,8 @@
+/**
+ * The root of the `numbers` math library
+ */
+export module math.numbers;
+
+export import :big_int;
+export import :rational;
+export import :fixed;
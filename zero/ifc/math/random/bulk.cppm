@@ -0,0 +1,155 @@
+/**
+ * @brief Bulk generation of random numbers
+ *
+ * Free functions that fill contiguous ranges (spans, or the containers of the
+ * collections library) with random bits or with uniform doubles in [0, 1).
+ *
+ * Any engine can be used, but `Xoshiro256StarStarSimd` is the one designed for this
+ * purpose. It runs several independent xoshiro256** streams in lockstep, with their
+ * states stored as structures of arrays. Every step is the same sequence of shifts,
+ * xors and additions applied to all the lanes, which the compiler lowers into SIMD
+ * instructions (four lanes per AVX2 register, eight with AVX-512).
+ */
+
+export module math.random:bulk;
+
+import std;
+import collections;
+import :engines;
+
+namespace rng::__detail {
+    /// Maps the 53 high bits of a random word into a uniform double in [0, 1)
+    [[nodiscard]] constexpr double to_uniform_double(std::uint64_t bits) noexcept {
+        return static_cast<double>(bits >> 11) * 0x1.0p-53;
+    }
+}
+
+export namespace zero::math {
+    /**
+     * @brief Several xoshiro256** streams that are advanced together
+     *
+     * The lanes are seeded from a single {@link Xoshiro256StarStar}, jumping it between
+     * every lane, so they are guaranteed to never overlap. Models the
+     * `std::uniform_random_bit_generator` concept, serving the values of a block one at a time
+     *
+     * @tparam Lanes the number of parallel streams, a multiple of the SIMD width works best
+     */
+    template <std::size_t Lanes = 8>
+    class Xoshiro256StarStarSimd {
+    private:
+        alignas(64) std::array<std::uint64_t, Lanes> _s0 {};
+        alignas(64) std::array<std::uint64_t, Lanes> _s1 {};
+        alignas(64) std::array<std::uint64_t, Lanes> _s2 {};
+        alignas(64) std::array<std::uint64_t, Lanes> _s3 {};
+        alignas(64) std::array<std::uint64_t, Lanes> _block {};
+        std::size_t _next = Lanes;
+
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr std::size_t lanes = Lanes;
+
+        explicit Xoshiro256StarStarSimd(std::uint64_t seed = 0) noexcept
+            : Xoshiro256StarStarSimd(Xoshiro256StarStar {seed}) {}
+
+        explicit Xoshiro256StarStarSimd(Xoshiro256StarStar source) noexcept {
+            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                const auto& state = source.state();
+                _s0[lane] = state[0];
+                _s1[lane] = state[1];
+                _s2[lane] = state[2];
+                _s3[lane] = state[3];
+                source.jump();
+            }
+        }
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        /// Writes the next value of every lane into `out`, that must have room for `Lanes` values
+        void next_block(std::uint64_t* out) noexcept {
+            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                const std::uint64_t s1 = _s1[lane];
+                const std::uint64_t x = s1 + (s1 << 2);         // s1 * 5
+                const std::uint64_t r = (x << 7) | (x >> 57);   // rotl(x, 7)
+                out[lane] = r + (r << 3);                       // r * 9
+
+                const std::uint64_t t = s1 << 17;
+                _s2[lane] ^= _s0[lane];
+                _s3[lane] ^= s1;
+                _s1[lane] = s1 ^ _s2[lane];
+                _s0[lane] ^= _s3[lane];
+                _s2[lane] ^= t;
+                _s3[lane] = (_s3[lane] << 45) | (_s3[lane] >> 19);
+            }
+        }
+
+        result_type operator()() noexcept {
+            if (_next == Lanes) {
+                next_block(_block.data());
+                _next = 0;
+            }
+            return _block[_next++];
+        }
+
+        /// Fills `out` with random bits, a whole block per step
+        void fill(std::span<std::uint64_t> out) noexcept {
+            const std::size_t whole_blocks = out.size() - out.size() % Lanes;
+            std::size_t i = 0;
+            for (; i < whole_blocks; i += Lanes)
+                next_block(out.data() + i);
+            for (; i < out.size(); ++i)
+                out[i] = (*this)();
+        }
+
+        /// Fills `out` with uniform doubles in [0, 1)
+        void fill_uniform(std::span<double> out) noexcept {
+            alignas(64) std::array<std::uint64_t, Lanes> bits {};
+            const std::size_t whole_blocks = out.size() - out.size() % Lanes;
+            std::size_t i = 0;
+            for (; i < whole_blocks; i += Lanes) {
+                next_block(bits.data());
+                for (std::size_t lane = 0; lane < Lanes; ++lane)
+                    out[i + lane] = rng::__detail::to_uniform_double(bits[lane]);
+            }
+            for (; i < out.size(); ++i)
+                out[i] = rng::__detail::to_uniform_double((*this)());
+        }
+    };
+
+    /// Fills `out` with the random bits produced by any 64-bit engine
+    template <std::uniform_random_bit_generator G>
+        requires std::is_same_v<typename G::result_type, std::uint64_t>
+    void fill(G& engine, std::span<std::uint64_t> out) {
+        if constexpr (requires { engine.fill(out); })
+            engine.fill(out);
+        else
+            for (auto& value : out)
+                value = engine();
+    }
+
+    /// Fills `out` with uniform doubles in [0, 1), using the 53 high bits of the values of any 64-bit engine
+    template <std::uniform_random_bit_generator G>
+        requires std::is_same_v<typename G::result_type, std::uint64_t>
+    void fill_uniform(G& engine, std::span<double> out) {
+        if constexpr (requires { engine.fill_uniform(out); })
+            engine.fill_uniform(out);
+        else
+            for (auto& value : out)
+                value = rng::__detail::to_uniform_double(engine());
+    }
+
+    /// {@link fill} overload for the fixed-size {@link zero::collections::Array}
+    template <std::uniform_random_bit_generator G, std::size_t N>
+    void fill(G& engine, zero::collections::Array<std::uint64_t, N>& out) {
+        fill(engine, std::span<std::uint64_t> {out.array});
+    }
+
+    /// {@link fill_uniform} overload for the fixed-size {@link zero::collections::Array}
+    template <std::uniform_random_bit_generator G, std::size_t N>
+    void fill_uniform(G& engine, zero::collections::Array<double, N>& out) {
+        fill_uniform(engine, std::span<double> {out.array});
+    }
+}
+
+static_assert(std::uniform_random_bit_generator<zero::math::Xoshiro256StarStarSimd<>>);
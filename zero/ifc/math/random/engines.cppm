@@ -0,0 +1,177 @@
+/**
+ * @brief Fast pseudo-random number engines
+ *
+ * Small and fast alternatives to `std::mt19937`, that model the
+ * `std::uniform_random_bit_generator` concept, so they can be used with
+ * every standard distribution.
+ *
+ * - `SplitMix64` - A single 64-bit word of state. Mostly used to expand a seed into
+ * the bigger states of the other engines
+ * - `Xoshiro256StarStar` - The general purpose engine, from Blackman and Vigna. 256 bits of
+ * state and jump functions for splitting its period into non-overlapping streams
+ * - `Pcg64` - The PCG XSL-RR 128/64 engine, from O'Neill. Supports multiple streams selected
+ * on construction and jumping ahead an arbitrary number of steps in logarithmic time
+ */
+
+export module math.random:engines;
+
+import std;
+
+__extension__ typedef unsigned __int128 uint128;
+
+export namespace zero::math {
+    class SplitMix64 {
+    private:
+        std::uint64_t _state;
+
+    public:
+        using result_type = std::uint64_t;
+
+        constexpr explicit SplitMix64(std::uint64_t seed = 0) noexcept : _state {seed} {}
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        constexpr result_type operator()() noexcept {
+            std::uint64_t z = (_state += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+    };
+
+    class Xoshiro256StarStar {
+    private:
+        std::array<std::uint64_t, 4> _state;
+
+        /// Advances the state as many steps as the polynomial encoded in `jump_poly`
+        constexpr void jump_by(const std::array<std::uint64_t, 4>& jump_poly) noexcept {
+            std::array<std::uint64_t, 4> accumulated {};
+            for (const std::uint64_t word : jump_poly) {
+                for (int b = 0; b < 64; ++b) {
+                    if (word & (std::uint64_t {1} << b))
+                        for (std::size_t i = 0; i < 4; ++i)
+                            accumulated[i] ^= _state[i];
+                    (*this)();
+                }
+            }
+            _state = accumulated;
+        }
+
+    public:
+        using result_type = std::uint64_t;
+
+        /// Seeds the whole state from a single word, expanded through a {@link SplitMix64}
+        constexpr explicit Xoshiro256StarStar(std::uint64_t seed = 0) noexcept : _state {} {
+            SplitMix64 expander {seed};
+            for (auto& word : _state)
+                word = expander();
+        }
+
+        /// Seeds from an explicit state, which can't be all zeroes
+        constexpr explicit Xoshiro256StarStar(const std::array<std::uint64_t, 4>& state) noexcept : _state {state} {}
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        [[nodiscard]] constexpr const std::array<std::uint64_t, 4>& state() const noexcept { return _state; }
+
+        constexpr result_type operator()() noexcept {
+            const std::uint64_t result = std::rotl(_state[1] * 5, 7) * 9;
+            const std::uint64_t t = _state[1] << 17;
+            _state[2] ^= _state[0];
+            _state[3] ^= _state[1];
+            _state[1] ^= _state[2];
+            _state[0] ^= _state[3];
+            _state[2] ^= t;
+            _state[3] = std::rotl(_state[3], 45);
+            return result;
+        }
+
+        /// Equivalent to 2^128 calls to the engine. Generates 2^128 non-overlapping streams
+        constexpr void jump() noexcept {
+            jump_by({0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL});
+        }
+
+        /// Equivalent to 2^192 calls to the engine. Generates 2^64 starting points, each one able to `jump()` 2^64 times
+        constexpr void long_jump() noexcept {
+            jump_by({0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL});
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const Xoshiro256StarStar&, const Xoshiro256StarStar&) = default;
+    };
+
+    class Pcg64 {
+    private:
+        static constexpr uint128 multiplier =
+            (static_cast<uint128>(0x2360ed051fc65da4ULL) << 64) | 0x4385df649fccf645ULL;
+        static constexpr uint128 default_increment =
+            (static_cast<uint128>(0x5851f42d4c957f2dULL) << 64) | 0x14057b7ef767814fULL;
+
+        uint128 _state;
+        uint128 _increment;
+
+        constexpr void step() noexcept { _state = _state * multiplier + _increment; }
+
+    public:
+        using result_type = std::uint64_t;
+
+        /// Seeds the default stream
+        constexpr explicit Pcg64(std::uint64_t seed = 0) noexcept
+            : _state {0}, _increment {default_increment}
+        {
+            step();
+            _state += seed;
+            step();
+        }
+
+        /// Seeds one of the 2^127 streams of the engine, which never overlap between them
+        constexpr Pcg64(std::uint64_t seed, std::uint64_t stream) noexcept
+            : _state {0}, _increment {(static_cast<uint128>(stream) << 1) | 1}
+        {
+            step();
+            _state += seed;
+            step();
+        }
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        constexpr result_type operator()() noexcept {
+            step();
+            const auto rotation = static_cast<int>(_state >> 122);
+            const auto xored = static_cast<std::uint64_t>(_state >> 64) ^ static_cast<std::uint64_t>(_state);
+            return std::rotr(xored, rotation);
+        }
+
+        /// Advances the engine `delta` steps in O(log(delta)), as if it were called `delta` times
+        constexpr void advance(uint128 delta) noexcept {
+            uint128 acc_mult = 1;
+            uint128 acc_plus = 0;
+            uint128 cur_mult = multiplier;
+            uint128 cur_plus = _increment;
+            while (delta > 0) {
+                if (delta & 1) {
+                    acc_mult *= cur_mult;
+                    acc_plus = acc_plus * cur_mult + cur_plus;
+                }
+                cur_plus = (cur_mult + 1) * cur_plus;
+                cur_mult *= cur_mult;
+                delta >>= 1;
+            }
+            _state = acc_mult * _state + acc_plus;
+        }
+
+        /// Equivalent to 2^64 calls to the engine
+        constexpr void jump() noexcept { advance(static_cast<uint128>(1) << 64); }
+
+        /// Equivalent to 2^96 calls to the engine
+        constexpr void long_jump() noexcept { advance(static_cast<uint128>(1) << 96); }
+
+        [[nodiscard]] friend constexpr bool operator==(const Pcg64&, const Pcg64&) = default;
+    };
+}
+
+static_assert(std::uniform_random_bit_generator<zero::math::SplitMix64>);
+static_assert(std::uniform_random_bit_generator<zero::math::Xoshiro256StarStar>);
+static_assert(std::uniform_random_bit_generator<zero::math::Pcg64>);
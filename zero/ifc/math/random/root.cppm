@@ -0,0 +1,10 @@
+/**
+ * The root of the `random` math library
+ *
+ * Fast pseudo-random number engines, compatible with the standard distributions,
+ * and routines that fill whole buffers of random values at once
+ */
+export module math.random;
+
+export import :engines;
+export import :bulk;
@@ -0,0 +1,213 @@
+/**
+ * @brief High Dynamic Range histograms
+ *
+ * `HdrHistogram` follows the design of Gil Tene's HdrHistogram. It records integral values
+ * (typically latencies in nanoseconds) over a wide range while keeping a fixed number of
+ * significant decimal digits of precision. Values are placed in log-linear buckets, so
+ * the memory used only depends on the trackable range and the precision, never on the
+ * number of recorded values.
+ *
+ * Recording is a single relaxed atomic increment, so any number of threads can record
+ * into the same histogram without locks. For the hottest paths, every thread can also own
+ * its histogram and merge them into a global one afterwards.
+ */
+
+export module math.statistics:hdr_histogram;
+
+import std;
+
+export namespace zero::math {
+    class HdrHistogram {
+    private:
+        std::uint64_t _highest_trackable_value;
+        int _significant_digits;
+        int _sub_bucket_half_count_magnitude;
+        std::uint64_t _sub_bucket_half_count;
+        std::uint64_t _sub_bucket_mask;
+        std::size_t _counts_length;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> _counts;
+        std::atomic<std::uint64_t> _total_count {0};
+        std::atomic<std::uint64_t> _min {std::numeric_limits<std::uint64_t>::max()};
+        std::atomic<std::uint64_t> _max {0};
+
+        [[nodiscard]] std::size_t bucket_index(std::uint64_t value) const noexcept {
+            // The position of the highest set bit, relative to the linear part of the first bucket
+            return static_cast<std::size_t>(
+                63 - _sub_bucket_half_count_magnitude - std::countl_zero(value | _sub_bucket_mask)
+            );
+        }
+
+        [[nodiscard]] std::size_t counts_index(std::uint64_t value) const noexcept {
+            const std::size_t bucket = bucket_index(value);
+            const std::uint64_t sub_bucket = value >> bucket;
+            return ((bucket + 1) << _sub_bucket_half_count_magnitude)
+                + static_cast<std::size_t>(sub_bucket - _sub_bucket_half_count);
+        }
+
+        /// @return the lowest value that is stored in the slot `index` of the counts
+        [[nodiscard]] std::uint64_t value_from_index(std::size_t index) const noexcept {
+            auto bucket = static_cast<std::ptrdiff_t>(index >> _sub_bucket_half_count_magnitude) - 1;
+            std::uint64_t sub_bucket = (index & (_sub_bucket_half_count - 1)) + _sub_bucket_half_count;
+            if (bucket < 0) {
+                sub_bucket -= _sub_bucket_half_count;
+                bucket = 0;
+            }
+            return sub_bucket << bucket;
+        }
+
+        /// @return the highest value that is considered equivalent (same slot) to `value`
+        [[nodiscard]] std::uint64_t highest_equivalent_value(std::uint64_t value) const noexcept {
+            const std::size_t bucket = bucket_index(value);
+            const std::uint64_t lowest = (value >> bucket) << bucket;
+            return lowest + (std::uint64_t {1} << bucket) - 1;
+        }
+
+        static void update_min(std::atomic<std::uint64_t>& target, std::uint64_t value) noexcept {
+            std::uint64_t current = target.load(std::memory_order_relaxed);
+            while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+        static void update_max(std::atomic<std::uint64_t>& target, std::uint64_t value) noexcept {
+            std::uint64_t current = target.load(std::memory_order_relaxed);
+            while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+    public:
+        /**
+         * @param highest_trackable_value the biggest value that can be recorded
+         * @param significant_digits the number of significant decimal digits that are kept
+         * for every recorded value, between 1 and 5
+         * @throws std::invalid_argument when the precision is out of range
+         */
+        explicit HdrHistogram(std::uint64_t highest_trackable_value, int significant_digits = 3)
+            : _highest_trackable_value {std::max<std::uint64_t>(highest_trackable_value, 2)}
+            , _significant_digits {significant_digits}
+            , _sub_bucket_half_count_magnitude {0}
+            , _sub_bucket_half_count {0}
+            , _sub_bucket_mask {0}
+            , _counts_length {0}
+            , _counts {}
+        {
+            if (significant_digits < 1 || significant_digits > 5)
+                throw std::invalid_argument("HdrHistogram: the significant digits must be between 1 and 5");
+
+            // Every bucket needs enough linear slots to tell apart 2 * 10^digits values
+            std::uint64_t single_unit_resolution = 2;
+            for (int i = 0; i < significant_digits; ++i)
+                single_unit_resolution *= 10;
+            const auto sub_bucket_count_magnitude = static_cast<int>(std::bit_width(single_unit_resolution - 1));
+            _sub_bucket_half_count_magnitude = sub_bucket_count_magnitude - 1;
+            const std::uint64_t sub_bucket_count = std::uint64_t {1} << sub_bucket_count_magnitude;
+            _sub_bucket_half_count = sub_bucket_count / 2;
+            _sub_bucket_mask = sub_bucket_count - 1;
+
+            // Every extra bucket doubles the covered range
+            std::size_t buckets = 1;
+            for (std::uint64_t smallest_untrackable = sub_bucket_count;
+                 smallest_untrackable <= _highest_trackable_value; ++buckets) {
+                if (smallest_untrackable > std::numeric_limits<std::uint64_t>::max() / 2) {
+                    ++buckets;
+                    break;
+                }
+                smallest_untrackable <<= 1;
+            }
+            _counts_length = (buckets + 1) * static_cast<std::size_t>(_sub_bucket_half_count);
+            _counts = std::make_unique<std::atomic<std::uint64_t>[]>(_counts_length);
+        }
+
+        HdrHistogram(const HdrHistogram&) = delete;
+        HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+        /**
+         * Records `count` occurrences of `value`. Safe to be called concurrently
+         * @return false if the value is bigger than the highest trackable value, and wasn't recorded
+         */
+        bool record(std::uint64_t value, std::uint64_t count = 1) noexcept {
+            if (value > _highest_trackable_value)
+                return false;
+            _counts[counts_index(value)].fetch_add(count, std::memory_order_relaxed);
+            _total_count.fetch_add(count, std::memory_order_relaxed);
+            update_min(_min, value);
+            update_max(_max, value);
+            return true;
+        }
+
+        /**
+         * Adds the values recorded in `other`, which must have been created with the same
+         * trackable range and precision
+         * @throws std::invalid_argument when the layouts of the histograms don't match
+         */
+        void merge(const HdrHistogram& other) {
+            if (other._counts_length != _counts_length || other._sub_bucket_mask != _sub_bucket_mask)
+                throw std::invalid_argument("HdrHistogram: merging histograms with different layouts");
+            for (std::size_t i = 0; i < _counts_length; ++i) {
+                const std::uint64_t count = other._counts[i].load(std::memory_order_relaxed);
+                if (count != 0)
+                    _counts[i].fetch_add(count, std::memory_order_relaxed);
+            }
+            _total_count.fetch_add(other._total_count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            update_min(_min, other._min.load(std::memory_order_relaxed));
+            update_max(_max, other._max.load(std::memory_order_relaxed));
+        }
+
+        void reset() noexcept {
+            for (std::size_t i = 0; i < _counts_length; ++i)
+                _counts[i].store(0, std::memory_order_relaxed);
+            _total_count.store(0, std::memory_order_relaxed);
+            _min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+            _max.store(0, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::uint64_t total_count() const noexcept { return _total_count.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::uint64_t min() const noexcept { return total_count() == 0 ? 0 : _min.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::uint64_t max() const noexcept { return _max.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::uint64_t highest_trackable_value() const noexcept { return _highest_trackable_value; }
+        [[nodiscard]] int significant_digits() const noexcept { return _significant_digits; }
+
+        /// @return the number of recorded values that are equivalent to `value`
+        [[nodiscard]] std::uint64_t count_at(std::uint64_t value) const noexcept {
+            if (value > _highest_trackable_value)
+                return 0;
+            return _counts[counts_index(value)].load(std::memory_order_relaxed);
+        }
+
+        /// @return the mean of the recorded values, taking the middle of every slot as its value
+        [[nodiscard]] double mean() const noexcept {
+            const std::uint64_t total = total_count();
+            if (total == 0)
+                return 0;
+            double sum = 0;
+            for (std::size_t i = 0; i < _counts_length; ++i) {
+                const std::uint64_t count = _counts[i].load(std::memory_order_relaxed);
+                if (count == 0)
+                    continue;
+                const std::uint64_t lowest = value_from_index(i);
+                const std::uint64_t highest = highest_equivalent_value(lowest);
+                sum += static_cast<double>(count) * (static_cast<double>(lowest) + static_cast<double>(highest - lowest) / 2);
+            }
+            return sum / static_cast<double>(total);
+        }
+
+        /**
+         * @return the value below which a fraction `q` (in [0, 1]) of the recorded values falls.
+         * The result is exact up to the configured significant digits
+         */
+        [[nodiscard]] std::uint64_t value_at_quantile(double q) const noexcept {
+            const std::uint64_t total = total_count();
+            if (total == 0)
+                return 0;
+            const double clamped = std::clamp(q, 0.0, 1.0);
+            const std::uint64_t target = std::max<std::uint64_t>(
+                1, static_cast<std::uint64_t>(std::ceil(clamped * static_cast<double>(total)))
+            );
+
+            std::uint64_t cumulative = 0;
+            for (std::size_t i = 0; i < _counts_length; ++i) {
+                cumulative += _counts[i].load(std::memory_order_relaxed);
+                if (cumulative >= target)
+                    return std::min(highest_equivalent_value(value_from_index(i)), max());
+            }
+            return max();
+        }
+    };
+}
@@ -0,0 +1,79 @@
+/**
+ * @brief Streaming mean, variance and extrema
+ *
+ * `Moments` accumulates the first moments of a stream of samples in constant
+ * memory, by using the Welford's online algorithm, which remains numerically
+ * stable even for long streams with a big mean and a tiny variance. Two accumulators
+ * can be merged with the Chan et al. parallel formula, so every thread can keep
+ * its own and combine them at the end.
+ */
+
+export module math.statistics:moments;
+
+import std;
+
+export namespace zero::math {
+    /**
+     * @brief Online accumulator for the count, mean, variance, min and max of a stream of samples
+     * @tparam T the floating point type used for the accumulated values
+     */
+    template <std::floating_point T = double>
+    class Moments {
+    private:
+        std::uint64_t _count = 0;
+        T _mean = 0;
+        T _m2 = 0;
+        T _min = std::numeric_limits<T>::infinity();
+        T _max = -std::numeric_limits<T>::infinity();
+
+    public:
+        /// Accumulates a new sample
+        constexpr void push(T sample) noexcept {
+            ++_count;
+            const T delta = sample - _mean;
+            _mean += delta / static_cast<T>(_count);
+            _m2 += delta * (sample - _mean);
+            _min = std::min(_min, sample);
+            _max = std::max(_max, sample);
+        }
+
+        /// Combines the samples accumulated by another instance into this one
+        constexpr void merge(const Moments& other) noexcept {
+            if (other._count == 0)
+                return;
+            if (_count == 0) {
+                *this = other;
+                return;
+            }
+            const auto n1 = static_cast<T>(_count);
+            const auto n2 = static_cast<T>(other._count);
+            const T total = n1 + n2;
+            const T delta = other._mean - _mean;
+            _mean += delta * n2 / total;
+            _m2 += other._m2 + delta * delta * n1 * n2 / total;
+            _count += other._count;
+            _min = std::min(_min, other._min);
+            _max = std::max(_max, other._max);
+        }
+
+        constexpr void reset() noexcept { *this = Moments {}; }
+
+        [[nodiscard]] constexpr std::uint64_t count() const noexcept { return _count; }
+        [[nodiscard]] constexpr T mean() const noexcept { return _mean; }
+        [[nodiscard]] constexpr T min() const noexcept { return _min; }
+        [[nodiscard]] constexpr T max() const noexcept { return _max; }
+
+        /// @return the population variance of the samples, or zero if there are none
+        [[nodiscard]] constexpr T variance() const noexcept {
+            return _count == 0 ? T {0} : _m2 / static_cast<T>(_count);
+        }
+
+        /// @return the unbiased (sample) variance, or zero if there are less than two samples
+        [[nodiscard]] constexpr T sample_variance() const noexcept {
+            return _count < 2 ? T {0} : _m2 / static_cast<T>(_count - 1);
+        }
+
+        /// @return the population standard deviation of the samples
+        [[nodiscard]] T stddev() const noexcept { return std::sqrt(variance()); }
+    };
+}
@@ -0,0 +1,11 @@
+/**
+ * The root of the `statistics` math library
+ *
+ * Online accumulators that summarize a stream of samples in constant memory,
+ * without the need of storing them
+ */
+export module math.statistics;
+
+export import :moments;
+export import :tdigest;
+export import :hdr_histogram;
@@ -0,0 +1,183 @@
+/**
+ * @brief Streaming quantile estimation
+ *
+ * `TDigest` is the merging variant of the t-digest sketch, from Ted Dunning. It summarizes
+ * a stream of samples as a bounded set of centroids (a mean and a weight), that are
+ * kept small near the tails of the distribution and bigger near the median, so
+ * the extreme quantiles (p99, p99.9...) are estimated with a very small relative error.
+ *
+ * Incoming samples are appended to a fixed size buffer, which is merged into the
+ * centroids when full, so the memory used doesn't depend on the number of samples
+ * and the amortized cost of an insertion is a few nanoseconds. Two digests can be
+ * merged, so they can be computed in parallel and combined later.
+ */
+
+export module math.statistics:tdigest;
+
+import std;
+
+export namespace zero::math {
+    class TDigest {
+    public:
+        struct Centroid {
+            double mean;
+            double weight;
+        };
+
+    private:
+        double _compression;
+        std::size_t _buffer_limit;
+        mutable std::vector<Centroid> _centroids {};
+        mutable std::vector<Centroid> _buffer {};
+        mutable double _total_weight = 0;
+        double _min = std::numeric_limits<double>::infinity();
+        double _max = -std::numeric_limits<double>::infinity();
+
+        /**
+         * The k2 scale function, that maps a quantile into the centroid index space. A centroid
+         * can't span more than a unit of k, and since its derivative grows as 1/q(1-q), the
+         * centroids near the tails are tiny, which bounds the relative error of the extreme quantiles
+         */
+        [[nodiscard]] double scale(double q, double normalizer) const noexcept {
+            return normalizer * std::log(q / (1 - q));
+        }
+
+        [[nodiscard]] double inverse_scale(double k, double normalizer) const noexcept {
+            return 1 / (1 + std::exp(-k / normalizer));
+        }
+
+        /// @return the upper bound of the cumulative weight for a centroid that starts at `weight_so_far`
+        [[nodiscard]] double weight_limit(double weight_so_far, double total, double normalizer) const noexcept {
+            if (weight_so_far <= 0)
+                return 0;
+            return inverse_scale(scale(weight_so_far / total, normalizer) + 1, normalizer) * total;
+        }
+
+        /// Merges the buffered samples into the centroids
+        void compress() const {
+            if (_buffer.empty())
+                return;
+
+            _buffer.insert(_buffer.end(), _centroids.begin(), _centroids.end());
+            std::sort(_buffer.begin(), _buffer.end(), [](const Centroid& a, const Centroid& b) {
+                return a.mean < b.mean;
+            });
+
+            double total = 0;
+            for (const auto& c : _buffer)
+                total += c.weight;
+
+            _centroids.clear();
+            Centroid current = _buffer.front();
+            const double normalizer = _compression / (4 * std::log(std::max(total / _compression, 1.0)) + 24);
+            double weight_so_far = 0;
+            double q_limit = weight_limit(weight_so_far, total, normalizer);
+
+            for (std::size_t i = 1; i < _buffer.size(); ++i) {
+                const Centroid& next = _buffer[i];
+                if (weight_so_far + current.weight + next.weight <= q_limit) {
+                    current.weight += next.weight;
+                    current.mean += (next.mean - current.mean) * next.weight / current.weight;
+                } else {
+                    weight_so_far += current.weight;
+                    _centroids.push_back(current);
+                    q_limit = weight_limit(weight_so_far, total, normalizer);
+                    current = next;
+                }
+            }
+            _centroids.push_back(current);
+            _total_weight = total;
+            _buffer.clear();
+        }
+
+    public:
+        /**
+         * @param compression bounds the number of centroids kept, trading memory for accuracy.
+         * A hundred keeps the relative error of the p99.9 under a 1%
+         */
+        explicit TDigest(double compression = 100)
+            : _compression {compression}
+            , _buffer_limit {static_cast<std::size_t>(10 * compression)}
+        {
+            // The centroids are appended to the buffer while compressing, so make room for both
+            _centroids.reserve(static_cast<std::size_t>(2 * compression));
+            _buffer.reserve(_buffer_limit + _centroids.capacity());
+        }
+
+        /// Accumulates a new sample, with an optional weight
+        void push(double sample, double weight = 1) {
+            if (_buffer.size() >= _buffer_limit)
+                compress();
+            _buffer.push_back({sample, weight});
+            _min = std::min(_min, sample);
+            _max = std::max(_max, sample);
+        }
+
+        /// Combines the samples summarized by another digest into this one
+        void merge(const TDigest& other) {
+            if (&other == this) {
+                const TDigest copy {*this};
+                merge(copy);
+                return;
+            }
+            other.compress();
+            for (const auto& c : other._centroids) {
+                if (_buffer.size() >= _buffer_limit)
+                    compress();
+                _buffer.push_back(c);
+            }
+            _min = std::min(_min, other._min);
+            _max = std::max(_max, other._max);
+        }
+
+        /// @return the total weight of the accumulated samples
+        [[nodiscard]] double count() const {
+            compress();
+            return _total_weight;
+        }
+
+        [[nodiscard]] double min() const noexcept { return _min; }
+        [[nodiscard]] double max() const noexcept { return _max; }
+
+        /// @return the centroids that currently summarize the distribution, sorted by their mean
+        [[nodiscard]] std::span<const Centroid> centroids() const {
+            compress();
+            return _centroids;
+        }
+
+        /**
+         * @return an estimation of the value below which a fraction `q` of the samples falls,
+         * or a quiet NaN when the digest is empty
+         */
+        [[nodiscard]] double quantile(double q) const {
+            compress();
+            if (_centroids.empty())
+                return std::numeric_limits<double>::quiet_NaN();
+            if (q <= 0)
+                return _min;
+            if (q >= 1)
+                return _max;
+
+            const double index = q * _total_weight;
+            const auto& first = _centroids.front();
+            const auto& last = _centroids.back();
+
+            // Every centroid is centered at the middle of its weight. Interpolate linearly between them
+            if (index < first.weight / 2)
+                return _min + (first.mean - _min) * index / (first.weight / 2);
+
+            double cumulative = first.weight / 2;
+            for (std::size_t i = 0; i + 1 < _centroids.size(); ++i) {
+                const double gap = (_centroids[i].weight + _centroids[i + 1].weight) / 2;
+                if (cumulative + gap > index) {
+                    const double t = (index - cumulative) / gap;
+                    return _centroids[i].mean + t * (_centroids[i + 1].mean - _centroids[i].mean);
+                }
+                cumulative += gap;
+            }
+
+            const double t = std::min((index - cumulative) / (last.weight / 2), 1.0);
+            return last.mean + t * (_max - last.mean);
+        }
+    };
+}
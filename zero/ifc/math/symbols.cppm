@@ -1,6 +1,13 @@
+/**
+ * The mathematical symbols, as the Unicode code points of the variants of {@link MathSymbol}
+ */
+
 export module math.symbols;
 
-enum class MathSymbol {
+import std;
+import utf8;
+
+export enum class MathSymbol {
     // Basic Math Operators
     Plus = 0x002B,                  // +
     Minus = 0x2212,                 // -
@@ -143,3 +150,17 @@ enum class MathSymbol {
     Psi = 0x03A8,                   // Ψ
     Omega = 0x03A9,                 // Ω
 };
+
+/// @return the UTF-8 encoding of `symbol`, computed at compile time when it's a constant
+export [[nodiscard]] constexpr zero::utf8::encoded to_utf8(MathSymbol symbol) noexcept {
+    return zero::utf8::encode(static_cast<char32_t>(symbol));
+}
+
+namespace symbols::__detail {
+    template <MathSymbol Symbol>
+    inline constexpr zero::utf8::encoded encoded_symbol = to_utf8(Symbol);
+}
+
+/// The UTF-8 text of `Symbol`, stored as static read-only data
+export template <MathSymbol Symbol>
+inline constexpr std::string_view symbol_v = symbols::__detail::encoded_symbol<Symbol>.view();
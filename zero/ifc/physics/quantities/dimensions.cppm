@@ -16,6 +16,35 @@ import :units.symbols;
 export namespace zero::physics {
     /* Base dimensions */
 
+    /**
+     * The identifiers of the base dimensions of the `SI`, which are also their positions
+     * in a {@link dimension_exponents} vector
+     */
+    enum class base_dimension_id : std::size_t {
+        mass,
+        length,
+        time,
+        temperature,
+        electric_current,
+        amount_of_substance,
+        luminous_intensity,
+        dimensionless
+    };
+
+    constexpr std::size_t base_dimensions_count = 8;
+
+    /// The names of the base dimensions, indexed by {@link base_dimension_id}
+    constexpr std::array<std::string_view, base_dimensions_count> base_dimension_names {
+        "mass", "length", "time", "temperature", "electric_current",
+        "amount_of_substance", "luminous_intensity", "dimensionless"
+    };
+
+    /**
+     * The exponents of every base dimension of a physical quantity, indexed by
+     * {@link base_dimension_id}. i.e: a force is `M¹ * L¹ * T⁻²`, so it's `{1, 1, -2, 0, 0, 0, 0, 0}`
+     */
+    using dimension_exponents = std::array<short, base_dimensions_count>;
+
     /**
      * CRTP base "tag" for declaring a base dimension. By being a CRTP base class, we can
      * declare the `dimension` alias inside this type, so we can access it from the tags
@@ -23,26 +52,55 @@ export namespace zero::physics {
      * dimension of the template parameter itself, and avoid pollute the public API with
      * using declarations when they can be automatically set up from the base tag
      */
-    template <typename Dimension, short DimensionExponent = 1>
+    template <typename Dimension, base_dimension_id Id, short DimensionExponent = 1>
     struct base_dimension {
         using dimension = Dimension;
+        static constexpr base_dimension_id dimension_id = Id;
         static constexpr short dimension_exp = DimensionExponent;
     };
 
     template<typename T>
-    concept BaseDimension = std::is_base_of_v<base_dimension<T, T::dimension_exp>, T> &&
-        requires { typename T::dimension; T::dimension_exp; };
+    concept BaseDimension = std::is_base_of_v<base_dimension<T, T::dimension_id, T::dimension_exp>, T> &&
+        requires { typename T::dimension; T::dimension_id; T::dimension_exp; };
+
+    /**
+     * The canonical representation of a dimension, its vector of exponents as a non-type template
+     * parameter. Two dimensions are the same one if and only if they have the same canonical type,
+     * no matter the order or the grouping in which their base dimensions were declared
+     */
+    template <dimension_exponents Exponents>
+    struct canonical_dimension {
+        static constexpr dimension_exponents exponents = Exponents;
+    };
 
     /* Compound dimensions */
     template<typename... Dimensions>
     struct derived_dimension {
         using dimensions = std::tuple<Dimensions...>;
-        static constexpr auto total_dimensions = std::tuple_size<dimensions>::value;
+        static constexpr auto total_dimensions = sizeof...(Dimensions);
+
+        /// The exponent of every declared base dimension, in their declaration order
+        static constexpr std::array<short, sizeof...(Dimensions)> declared_exponents {Dimensions::dimension_exp...};
+
+        /**
+         * The exponents of the dimension, indexed by {@link base_dimension_id}. A dimensionless
+         * factor doesn't change a dimension, so i.e. a frequency is the inverse of a time
+         */
+        static constexpr dimension_exponents exponents = [] {
+            dimension_exponents result {};
+            ((result[static_cast<std::size_t>(Dimensions::dimension_id)] += Dimensions::dimension_exp), ...);
+            result[static_cast<std::size_t>(base_dimension_id::dimensionless)] = 0;
+            return result;
+        }();
+
+        using canonical = canonical_dimension<exponents>;
     };
 
-    template<typename T, std::size_t... Is>
+    template<typename T>
     concept DerivedDimension = requires {
         typename T::dimensions;
+        typename T::canonical;
         T::total_dimensions;
-    } && (std::is_base_of_v<derived_dimension<T, std::tuple_element_t<Is, typename T::dimensions>>, T> && ...);
+        requires std::is_same_v<std::remove_cv_t<decltype(T::exponents)>, dimension_exponents>;
+    };
 }
@@ -3,28 +3,79 @@
  * details that won't contribute to the external API of the
  * units module.
  *
- * Due to the recursive function template for
- * formatting the `derived magnitude symbols`, we can't use
- * this as an internal partition, due to the linker is not able
- * to resolve the template in order to link it at call site
+ * Its templates are used by the exported templates of the
+ * other partitions, so it can't be an internal partition, due
+ * to the linker is not able to resolve them in order to link
+ * them at call site
  */
 
 export module physics.quantities:quantities.detail;
 
 import std;
 
-import type_info;
-import str_manip;
+import math;
 
 export namespace quantities::__detail {
-    template<typename T>
-    struct dimensions_exponents;
+    template<typename DerivedDimension, typename Units, typename = std::make_index_sequence<std::tuple_size_v<Units>>>
+    struct units_scale;
+
+    /**
+     * The exact factor of a derived unit relative to the coherent one, being the product
+     * of the scales of its base units raised to the exponent of their dimension
+     */
+    template<typename DerivedDimension, typename... BaseUnits, std::size_t... Is>
+    struct units_scale<DerivedDimension, std::tuple<BaseUnits...>, std::index_sequence<Is...>> {
+        using type = zero::math::rational_product<
+            zero::math::rational_power<typename BaseUnits::ratio::scale, DerivedDimension::declared_exponents[Is]>...
+        >;
+    };
+
+    /// The exact scale of a magnitude relative to the coherent unit of its dimension
+    template<typename M>
+    struct magnitude_scale {
+        using type = typename M::ratio::scale;
+    };
 
-    template<typename... BaseDimensions>
-    struct dimensions_exponents<std::tuple<BaseDimensions...>> {
-        static constexpr auto value = std::array<short, sizeof...(BaseDimensions)> {BaseDimensions::base_dimension::dimension::dimension_exp...};
+    template<typename M>
+        requires requires { typename M::scale; }
+    struct magnitude_scale<M> {
+        using type = typename M::scale;
     };
 
+    /// The exact factor that converts an amount expressed in `From` into an amount expressed in `To`
+    template<typename From, typename To>
+    using conversion_factor = zero::math::rational_divide<
+        typename magnitude_scale<From>::type, typename magnitude_scale<To>::type
+    >;
+
+    /**
+     * Converts an amount computed in floating point into `result`, rounded to the nearest value when
+     * `T` is integral. It fails, leaving `result` untouched, when the amount is out of the range of `T`
+     */
+    template<typename T>
+    [[nodiscard]] std::errc to_amount(double amount, T& result) noexcept {
+        if constexpr (std::is_integral_v<T>) {
+            const double rounded = std::round(amount);
+            // The bounds are powers of two, or zero, so they're exact as doubles
+            constexpr double lower = static_cast<double>(std::numeric_limits<T>::min());
+            constexpr double upper = 2. * static_cast<double>(std::numeric_limits<T>::max() / 2 + 1);
+            if (!(rounded >= lower && rounded < upper))
+                return std::errc::result_out_of_range;
+            result = static_cast<T>(rounded);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (std::abs(amount) > static_cast<double>(std::numeric_limits<T>::max()))
+                return std::errc::result_out_of_range;
+            result = static_cast<T>(amount);
+        } else {
+            try {
+                result = T(amount);
+            } catch (const std::overflow_error&) {
+                return std::errc::result_out_of_range;
+            }
+        }
+        return std::errc {};
+    }
+
     template<typename T>
     struct ratios_detail;
 
@@ -40,27 +91,4 @@ export namespace quantities::__detail {
     struct ratios_product_calculator<std::tuple<BaseUnitsRatios...>> {
         static constexpr auto value = (1 * ... * BaseUnitsRatios::value);
     };
-
-    template<typename M, int N = 1>
-    void derived_magnitude_symbols(std::string& out) {
-        if constexpr (N == 1)
-            out += " ";
-
-        using type = typename std::tuple_element<N - 1, typename M::units>::type;
-        const auto total_elements = std::tuple_size<typename M::units>::value;
-        const int dim_exp = std::tuple_element<N - 1, typename M::derived_dimension::dimensions>::type::dimension_exp;
-
-        auto splitted = zero::split_str(zero::types::type_name<type>(), "::").back();
-        auto s_symbol = splitted.substr(0, splitted.length() - 1);
-
-        out += s_symbol;
-
-        if constexpr (dim_exp != 1)
-            out += std::to_string(dim_exp);
-        if constexpr (total_elements > N)
-            out += "*";
-
-        if constexpr (N - 1 < total_elements - 1)
-            derived_magnitude_symbols<M, N + 1>(out);
-    }
 }
\ No newline at end of file
@@ -0,0 +1,395 @@
+/**
+ * @brief Parsing of physical quantities from text, i.e. `12.5 km/h` or `3e3 kg`
+ *
+ * The amount is read with `std::from_chars`, or with `std::strtod` when the standard library has
+ * no floating point `from_chars` (i.e. libc++ before its 20th version), and every unit symbol of the expression is
+ * looked up in a perfect hash table built at compile time from the symbols of
+ * {@link units.symbols}. The unit expression is reduced to the exponents of its base
+ * dimensions and its scale, checked against the requested magnitude and folded into a
+ * single factor, so the result is already expressed in the target unit.
+ *
+ * Nothing is allocated: the parsers work over character ranges, and the streaming one
+ * reuses the factor of the previous record when its unit is spelled the same, which is
+ * the usual case in logs and CSVs of measurements.
+ */
+
+module;
+
+#include <version>
+
+export module physics.quantities:parser;
+
+import std;
+import type_info;
+
+import :ratios;
+import :dimensions;
+import :units.symbols;
+import :quantity;
+import :quantities.detail;
+
+using namespace quantities::__detail;
+
+namespace quantities::__detail {
+    /// A unit symbol, with the base dimension that it measures and its scale relative to the coherent unit
+    struct unit_entry {
+        std::string_view symbol;
+        zero::physics::base_dimension_id dimension;
+        double scale;
+    };
+
+    template <zero::physics::Symbol S, zero::physics::Ratio R, zero::physics::base_dimension_id Id>
+    consteval unit_entry entry_of() {
+        return {symbol_text<S>(), Id, R::scale::value};
+    }
+
+    using id = zero::physics::base_dimension_id;
+
+    /// Every symbol that can appear in a textual quantity
+    constexpr std::array known_units {
+        entry_of<zero::physics::kg, zero::physics::kilo, id::mass>(),
+        entry_of<zero::physics::hg, zero::physics::hecto, id::mass>(),
+        entry_of<zero::physics::dag, zero::physics::deca, id::mass>(),
+        entry_of<zero::physics::g, zero::physics::root, id::mass>(),
+        entry_of<zero::physics::dg, zero::physics::deci, id::mass>(),
+        entry_of<zero::physics::cg, zero::physics::centi, id::mass>(),
+        entry_of<zero::physics::mg, zero::physics::milli, id::mass>(),
+        entry_of<zero::physics::ng, zero::physics::nano, id::mass>(),
+        entry_of<zero::physics::pg, zero::physics::pico, id::mass>(),
+        entry_of<zero::physics::km, zero::physics::kilo, id::length>(),
+        entry_of<zero::physics::hm, zero::physics::hecto, id::length>(),
+        entry_of<zero::physics::dam, zero::physics::deca, id::length>(),
+        entry_of<zero::physics::m, zero::physics::root, id::length>(),
+        entry_of<zero::physics::dm, zero::physics::deci, id::length>(),
+        entry_of<zero::physics::cm, zero::physics::centi, id::length>(),
+        entry_of<zero::physics::mm, zero::physics::milli, id::length>(),
+        entry_of<zero::physics::d, zero::physics::day, id::time>(),
+        entry_of<zero::physics::h, zero::physics::hour, id::time>(),
+        entry_of<zero::physics::min, zero::physics::minute, id::time>(),
+        entry_of<zero::physics::s, zero::physics::second, id::time>(),
+        entry_of<zero::physics::ms, zero::physics::milli, id::time>(),
+        entry_of<zero::physics::A, zero::physics::root, id::electric_current>()
+    };
+
+    /// The longest symbol that fits in the key of the hash table
+    constexpr std::size_t max_symbol_length = 4;
+
+    /// Packs the characters of a symbol of up to `max_symbol_length` characters into an integer
+    [[nodiscard]] constexpr std::uint32_t pack_symbol(std::string_view symbol) noexcept {
+        std::uint32_t key = 0;
+        for (const char c : symbol)
+            key = (key << 8) | static_cast<unsigned char>(c);
+        return key;
+    }
+
+    /**
+     * An open addressing table without collisions: the multiplier of the hash is searched at
+     * compile time until every known symbol lands in its own slot, so a lookup is a
+     * multiplication, a shift and a single comparison
+     */
+    struct symbol_table {
+        static constexpr std::size_t slots = 64;
+        static constexpr std::uint32_t shift = 26; // 32 - log2(slots)
+        static constexpr std::uint8_t empty = std::numeric_limits<std::uint8_t>::max();
+
+        std::array<std::uint32_t, slots> keys {};
+        std::array<std::uint8_t, slots> entries {};
+        std::uint32_t multiplier = 1;
+
+        [[nodiscard]] constexpr std::size_t slot(std::uint32_t key) const noexcept {
+            return static_cast<std::size_t>((key * multiplier) >> shift);
+        }
+
+        [[nodiscard]] constexpr const unit_entry* find(std::string_view symbol) const noexcept {
+            if (symbol.empty() || symbol.size() > max_symbol_length)
+                return nullptr;
+            const std::uint32_t key = pack_symbol(symbol);
+            const std::size_t index = slot(key);
+            return keys[index] == key ? &known_units[entries[index]] : nullptr;
+        }
+    };
+
+    consteval symbol_table build_symbol_table() {
+        static_assert(known_units.size() < symbol_table::empty);
+        for (std::uint32_t multiplier = 0x9E3779B1u;; multiplier += 2) {
+            symbol_table table {};
+            table.multiplier = multiplier;
+            table.entries.fill(symbol_table::empty);
+            bool collision = false;
+            for (std::size_t i = 0; i < known_units.size() && !collision; ++i) {
+                if (known_units[i].symbol.size() > max_symbol_length)
+                    throw std::length_error("The unit symbol is too long for the lookup table");
+                const std::uint32_t key = pack_symbol(known_units[i].symbol);
+                const std::size_t index = table.slot(key);
+                collision = table.entries[index] != symbol_table::empty;
+                table.keys[index] = key;
+                table.entries[index] = static_cast<std::uint8_t>(i);
+            }
+            if (!collision)
+                return table;
+        }
+    }
+
+    constexpr symbol_table symbol_lookup = build_symbol_table();
+
+    /// The exponents of the base dimensions of a unit expression, and its scale relative to the coherent unit
+    struct unit_expression {
+        zero::physics::dimension_exponents exponents {};
+        double scale = 1.;
+    };
+
+    [[nodiscard]] constexpr bool is_letter(char c) noexcept {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    [[nodiscard]] constexpr bool is_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+    [[nodiscard]] constexpr bool is_blank(char c) noexcept { return c == ' ' || c == '\t'; }
+
+    [[nodiscard]] constexpr bool is_separator(char c) noexcept {
+        return c == '\n' || c == '\r' || c == ',' || c == ';';
+    }
+
+    [[nodiscard]] constexpr const char* skip_blanks(const char* first, const char* last) noexcept {
+        while (first != last && is_blank(*first))
+            ++first;
+        return first;
+    }
+
+    /// The longest number that {@link scan_decimal} reads, in characters
+    constexpr std::size_t max_number_size = 63;
+
+    /**
+     * Reads a decimal floating point number, `[-]digits[.digits][(e|E)[+|-]digits]`, in the manner of
+     * `std::from_chars`. The number is converted with `std::strtod`, so the decimal point is the one
+     * of the current C locale, which is `.` unless the program changes it. The numbers longer than
+     * {@link max_number_size} characters are rejected with `std::errc::invalid_argument`
+     */
+    [[nodiscard]] inline std::from_chars_result scan_decimal(const char* first, const char* last, double& value) noexcept {
+        const char* end = first;
+        if (end != last && *end == '-')
+            ++end;
+        const char* const integral = end;
+        while (end != last && is_digit(*end))
+            ++end;
+        std::size_t digits = static_cast<std::size_t>(end - integral);
+        if (end != last && *end == '.') {
+            const char* const fraction = ++end;
+            while (end != last && is_digit(*end))
+                ++end;
+            digits += static_cast<std::size_t>(end - fraction);
+        }
+        if (digits == 0)
+            return {first, std::errc::invalid_argument};
+        if (end != last && (*end == 'e' || *end == 'E')) {
+            const char* exponent = end + 1;
+            if (exponent != last && (*exponent == '+' || *exponent == '-'))
+                ++exponent;
+            if (exponent != last && is_digit(*exponent)) {
+                end = exponent;
+                while (end != last && is_digit(*end))
+                    ++end;
+            }
+        }
+
+        // strtod needs a null terminated copy. It's kept on the stack, so the longer numbers are rejected
+        const auto size = static_cast<std::size_t>(end - first);
+        std::array<char, max_number_size + 1> copy;
+        if (size > max_number_size)
+            return {first, std::errc::invalid_argument};
+        std::copy(first, end, copy.data());
+        copy[size] = '\0';
+        const double parsed = std::strtod(copy.data(), nullptr);
+        if (std::isinf(parsed))
+            return {end, std::errc::result_out_of_range};
+        value = parsed;
+        return {end, std::errc {}};
+    }
+
+    /**
+     * Reads a floating point number with `std::from_chars`, when the standard library implements it. The
+     * numbers longer than {@link max_number_size} are rejected with both, so the same texts are accepted
+     */
+    [[nodiscard]] inline std::from_chars_result parse_number(const char* first, const char* last, double& value) noexcept {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        double parsed = 0.;
+        const auto result = std::from_chars(first, last, parsed);
+        if (result.ec == std::errc {} && static_cast<std::size_t>(result.ptr - first) > max_number_size)
+            return {first, std::errc::invalid_argument};
+        if (result.ec == std::errc {})
+            value = parsed;
+        return result;
+#else
+        return scan_decimal(first, last, value);
+#endif
+    }
+
+    /**
+     * Parses a unit expression, a sequence of symbols optionally raised to an integer exponent
+     * and joined by `*`, `.` or `/`, i.e. `km/h`, `m*s-2`, `m/s^2` or `kg.m2`. An empty
+     * expression is a dimensionless unit
+     */
+    [[nodiscard]] constexpr std::from_chars_result parse_unit(const char* first, const char* last, unit_expression& unit) noexcept {
+        unit = unit_expression {};
+        if (first == last || !is_letter(*first))
+            return {first, std::errc {}};
+
+        bool divide = false;
+        while (true) {
+            const char* symbol_end = first;
+            while (symbol_end != last && is_letter(*symbol_end))
+                ++symbol_end;
+            const unit_entry* entry = symbol_lookup.find({first, static_cast<std::size_t>(symbol_end - first)});
+            if (entry == nullptr)
+                return {first, std::errc::invalid_argument};
+            first = symbol_end;
+
+            int exponent = 1;
+            const bool caret = first != last && *first == '^';
+            if (caret)
+                ++first;
+            const bool negative = first != last && *first == '-';
+            if (negative)
+                ++first;
+            if (first != last && is_digit(*first)) {
+                exponent = 0;
+                while (first != last && is_digit(*first) && exponent < 100)
+                    exponent = exponent * 10 + (*first++ - '0');
+            } else if (negative || caret) // A `^` or a `-` must be followed by the exponent
+                return {first, std::errc::invalid_argument};
+            if (negative != divide)
+                exponent = -exponent;
+
+            auto& dimension = unit.exponents[static_cast<std::size_t>(entry->dimension)];
+            dimension = static_cast<short>(dimension + exponent);
+            for (int i = 0; i < exponent; ++i)
+                unit.scale *= entry->scale;
+            for (int i = 0; i > exponent; --i)
+                unit.scale /= entry->scale;
+
+            if (first == last || (*first != '*' && *first != '.' && *first != '/'))
+                return {first, std::errc {}};
+            divide = *first++ == '/';
+        }
+    }
+
+    /// The unit of the last parsed record, with its factor into the target unit
+    struct unit_cache {
+        std::string_view spelling {};
+        double factor = 0.;
+    };
+
+    template <typename Target>
+    [[nodiscard]] constexpr std::from_chars_result parse_unit_factor(const char* first, const char* last, double& factor) noexcept {
+        unit_expression unit;
+        const auto result = parse_unit(first, last, unit);
+        if (result.ec != std::errc {})
+            return result;
+        if (unit.exponents != zero::physics::exponents_of<Target>)
+            return {first, std::errc::invalid_argument};
+        factor = unit.scale / magnitude_scale<Target>::type::value;
+        return result;
+    }
+
+    /// Parses a number followed by a unit expression, writing the amount already expressed in `Target`
+    template <typename Target>
+    [[nodiscard]] std::from_chars_result parse_amount(const char* first, const char* last, double& amount, unit_cache& cache) noexcept {
+        first = skip_blanks(first, last);
+        const auto number = parse_number(first, last, amount);
+        if (number.ec != std::errc {})
+            return number;
+        const char* unit_first = skip_blanks(number.ptr, last);
+
+        const std::size_t cached = cache.spelling.size();
+        if (cached != 0 && static_cast<std::size_t>(last - unit_first) >= cached
+            && std::string_view {unit_first, cached} == cache.spelling
+            && (unit_first + cached == last || is_blank(unit_first[cached]) || is_separator(unit_first[cached])))
+        {
+            amount *= cache.factor;
+            return {unit_first + cached, std::errc {}};
+        }
+
+        double factor = 1.;
+        const auto unit = parse_unit_factor<Target>(unit_first, last, factor);
+        if (unit.ec != std::errc {})
+            return unit;
+        cache = {{unit_first, static_cast<std::size_t>(unit.ptr - unit_first)}, factor};
+        amount *= factor;
+        return unit;
+    }
+}
+
+export namespace zero::physics {
+    /**
+     * Parses a quantity at the beginning of [first, last), in the manner of `std::from_chars`,
+     * converting it into the magnitude `Target`. Leading blanks are skipped, and the number
+     * can be followed by blanks before its unit
+     *
+     * @return the position after the unit, or the one of the error: `std::errc::invalid_argument`
+     * when the text isn't a number, has an unknown symbol or a unit of another dimension, and
+     * `std::errc::result_out_of_range` when the amount doesn't fit in a double, or in `T` once converted.
+     * The numbers are at most 63 characters long
+     */
+    template <Magnitude Target, ValidAmountType T>
+    std::from_chars_result from_chars(const char* first, const char* last, quantity<Target, T>& value) noexcept {
+        double amount = 0.;
+        unit_cache cache;
+        const auto result = parse_amount<Target>(first, last, amount, cache);
+        if (result.ec != std::errc {})
+            return result;
+        T converted {};
+        if (const auto error = to_amount(amount, converted); error != std::errc {})
+            return {result.ptr, error};
+        value = quantity<Target, T>(converted);
+        return result;
+    }
+
+    /**
+     * Parses the whole `text` as a quantity expressed in the magnitude `Target`
+     * @throws std::invalid_argument when `text` isn't a quantity of the dimension of `Target`, or its amount
+     * is out of the range of `T`
+     */
+    template <Magnitude Target, ValidAmountType T = double>
+    [[nodiscard]] quantity<Target, T> parse_quantity(std::string_view text) {
+        quantity<Target, T> value {};
+        const char* last = text.data() + text.size();
+        const auto [end, error] = from_chars(text.data(), last, value);
+        if (error != std::errc {} || skip_blanks(end, last) != last)
+            throw std::invalid_argument("parse_quantity: the text isn't a quantity of the requested dimension");
+        return value;
+    }
+
+    /**
+     * Parses every quantity of `text`, separated by newlines, commas or semicolons, passing them
+     * to `sink` in order. Empty records are skipped, so it accepts a column of a CSV or a log
+     * with one measurement per line
+     *
+     * @return the end of `text`, or the position and the cause of the first malformed record,
+     * after the previous ones have been passed to the sink
+     */
+    template <Magnitude Target, ValidAmountType T = double, typename F>
+        requires std::invocable<F&, quantity<Target, T>>
+    std::from_chars_result parse_quantities(std::string_view text, F&& sink) {
+        const char* first = text.data();
+        const char* const last = first + text.size();
+        unit_cache cache;
+        while (true) {
+            while (first != last && (is_blank(*first) || is_separator(*first)))
+                ++first;
+            if (first == last)
+                return {last, std::errc {}};
+
+            double amount = 0.;
+            const auto result = parse_amount<Target>(first, last, amount, cache);
+            if (result.ec != std::errc {})
+                return result;
+            first = skip_blanks(result.ptr, last);
+            if (first != last && !is_separator(*first))
+                return {first, std::errc::invalid_argument};
+            T converted {};
+            if (const auto error = to_amount(amount, converted); error != std::errc {})
+                return {result.ptr, error};
+            sink(quantity<Target, T>(converted));
+        }
+    }
+}
@@ -4,7 +4,12 @@
 
 export module physics.quantities;
 
+import std;
+
 export import :quantity;
+export import :quantity_array;
+export import :parser;
+export import :registry;
 export import :dimensions;
 export import :units;
 export import :units.symbols;
@@ -15,31 +20,32 @@ export namespace zero::physics {
 
     /* ---------- Base Dimensions ---------- */
     template <short DimensionExponent = 1>
-    struct mass : public base_dimension<mass<DimensionExponent>, DimensionExponent> {};
+    struct mass : public base_dimension<mass<DimensionExponent>, base_dimension_id::mass, DimensionExponent> {};
 
     template <short DimensionExponent = 1>
-    struct length : public base_dimension<length<DimensionExponent>, DimensionExponent> {};
+    struct length : public base_dimension<length<DimensionExponent>, base_dimension_id::length, DimensionExponent> {};
 
     template <short DimensionExponent = 1>
-    struct time : public base_dimension<time<DimensionExponent>, DimensionExponent> {};
+    struct time : public base_dimension<time<DimensionExponent>, base_dimension_id::time, DimensionExponent> {};
 
     template <short DimensionExponent = 1>
-    struct temperature : public base_dimension<temperature<DimensionExponent>, DimensionExponent> {};
+    struct temperature : public base_dimension<temperature<DimensionExponent>, base_dimension_id::temperature, DimensionExponent> {};
 
     template <short DimensionExponent = 1>
-    struct electric_current : public base_dimension<electric_current<DimensionExponent>, DimensionExponent> {};
+    struct electric_current : public base_dimension<electric_current<DimensionExponent>, base_dimension_id::electric_current, DimensionExponent> {};
 
     template <short DimensionExponent = 1>
-    struct amount_of_substance : public base_dimension<amount_of_substance<DimensionExponent>, DimensionExponent> {};
+    struct amount_of_substance : public base_dimension<amount_of_substance<DimensionExponent>, base_dimension_id::amount_of_substance, DimensionExponent> {};
 
     template <short DimensionExponent = 1>
-    struct luminous_intensity : public base_dimension<luminous_intensity<DimensionExponent>, DimensionExponent> {};
+    struct luminous_intensity : public base_dimension<luminous_intensity<DimensionExponent>, base_dimension_id::luminous_intensity, DimensionExponent> {};
 
     template <short DimensionExponent = 1>
-    struct dimensionless : public base_dimension<dimensionless<DimensionExponent>, DimensionExponent> {};
+    struct dimensionless : public base_dimension<dimensionless<DimensionExponent>, base_dimension_id::dimensionless, DimensionExponent> {};
 
     /* ---------- Derived Dimensions ---------- */
     struct speed : public derived_dimension<length<>, time< -1 >> {};
+    struct acceleration : public derived_dimension<length<>, time< -2 >> {};
     struct frequency : public derived_dimension<dimensionless<>, time< -1 >> {};
     struct force : public derived_dimension<mass<>, length<>, time< -2 >> {};
     struct energy : public derived_dimension<mass<>, length<2>, time< -2 >> {};
@@ -86,6 +92,14 @@ export namespace zero::physics {
             base_unit<hour, h>
         > {};
 
+    /* Derived Units for the Acceleration dimension */
+    struct MetersPerSecondSquared :
+        public derived_unit<
+            acceleration,
+            base_unit<root, m>,
+            base_unit<second, s>
+        > {};
+
     /* Derived Units for the Frequency dimension */
     struct Hertz :
         public derived_unit<
@@ -139,6 +153,29 @@ export namespace zero::physics {
             base_unit<second, s>,
             base_unit<root, A>
         > {};
+
+
+    /* ----------------------------------- Runtime units ----------------------------------- */
+
+    /// Every unit declared above, so they can be selected at runtime by their {@link unit_id}
+    using units_registry = unit_registry<
+        Kilogram, Hectogram,
+        Meter,
+        Second, Minute, Hour, Day,
+        Ampere,
+        MetersPerSecond, KilometersPerHour,
+        MetersPerSecondSquared,
+        Hertz,
+        Newton,
+        Joule,
+        Watt,
+        Coulomb,
+        Volt
+    >;
+
+    /// A quantity of any of the units of the {@link units_registry}
+    template <ValidAmountType T = double>
+    using dynamic_quantity = basic_dynamic_quantity<units_registry, T>;
 }
 
 
@@ -154,6 +191,7 @@ static_assert(zero::physics::BaseDimension<zero::physics::dimensionless<>>);
 
 /* Testing our derived dimensions */
 static_assert(zero::physics::DerivedDimension<zero::physics::speed>);
+static_assert(zero::physics::DerivedDimension<zero::physics::acceleration>);
 static_assert(zero::physics::DerivedDimension<zero::physics::frequency>);
 static_assert(zero::physics::DerivedDimension<zero::physics::force>);
 static_assert(zero::physics::DerivedDimension<zero::physics::energy>);
@@ -161,6 +199,13 @@ static_assert(zero::physics::DerivedDimension<zero::physics::power>);
 static_assert(zero::physics::DerivedDimension<zero::physics::electric_charge>);
 static_assert(zero::physics::DerivedDimension<zero::physics::voltage>);
 
+/* Testing the canonical representation of the dimensions */
+static_assert(std::is_same_v<
+    zero::physics::force::canonical,
+    zero::physics::derived_dimension<zero::physics::time< -2 >, zero::physics::mass<>, zero::physics::length<>>::canonical
+>);
+static_assert(zero::physics::speed::exponents == zero::physics::dimension_exponents {0, 1, -1, 0, 0, 0, 0, 0});
+
 /* Testing our symbols */
 static_assert(zero::physics::Symbol<zero::physics::kg>);
 
@@ -7,6 +7,7 @@
 export module physics.quantities:quantity;
 
 import std;
+import math;
 import concepts;
 import type_info;
 import str_manip;
@@ -17,6 +18,188 @@ import :units;
 import :units.symbols;
 import :quantities.detail;
 
+using namespace quantities::__detail;
+
+namespace quantities::__detail {
+    template <typename M>
+    consteval zero::physics::dimension_exponents magnitude_exponents() {
+        if constexpr (requires { M::exponents; })
+            return M::exponents;
+        else if constexpr (requires { typename M::derived_dimension; })
+            return M::derived_dimension::exponents;
+        else {
+            // A base magnitude has a single exponent, so there's no derived dimension to instantiate
+            using dimension = typename M::dimension;
+            zero::physics::dimension_exponents result {};
+            if constexpr (dimension::dimension_id != zero::physics::base_dimension_id::dimensionless)
+                result[static_cast<std::size_t>(dimension::dimension_id)] = dimension::dimension_exp;
+            return result;
+        }
+    }
+
+    template <bool Subtract>
+    consteval zero::physics::dimension_exponents combine_exponents(
+        const zero::physics::dimension_exponents& lhs, const zero::physics::dimension_exponents& rhs
+    ) {
+        zero::physics::dimension_exponents result {};
+        for (std::size_t i = 0; i < result.size(); ++i)
+            result[i] = static_cast<short>(Subtract ? lhs[i] - rhs[i] : lhs[i] + rhs[i]);
+        return result;
+    }
+
+    /// The symbols of the coherent units of every base dimension, indexed by their {@link base_dimension_id}
+    constexpr std::array<std::string_view, zero::physics::base_dimensions_count> coherent_symbols {
+        "g", "m", "s", "K", "A", "mol", "cd", ""
+    };
+
+    /// A short string built at compile time, stored inline so it can be kept in a constexpr variable
+    struct symbol_buffer {
+        std::array<char, 64> chars {};
+        std::size_t size = 0;
+
+        constexpr void append(std::string_view text) {
+            if (text.size() > chars.size() - size)
+                throw std::length_error("The symbol of the unit is too long");
+            for (const char c : text)
+                chars[size++] = c;
+        }
+
+        constexpr void append(short value) {
+            std::array<char, 8> digits {};
+            std::size_t count = 0;
+            int remaining = value < 0 ? -value : value;
+            do {
+                digits[count++] = static_cast<char>('0' + remaining % 10);
+                remaining /= 10;
+            } while (remaining != 0);
+            if (value < 0)
+                append("-");
+            while (count > 0)
+                append(std::string_view {&digits[--count], 1});
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {chars.data(), size}; }
+    };
+
+    /// @return the name of a type without its enclosing namespaces, the last of its `::` separated tokens
+    [[nodiscard]] constexpr std::string_view unqualified_name(std::string_view name) noexcept {
+        std::string_view last = name;
+        for (const std::string_view token : zero::split(name, "::"))
+            last = token;
+        return last;
+    }
+
+    /// @return the symbol of the unit `S` as it's written: its text, or its name when it has none
+    template <typename S>
+    consteval std::string_view symbol_text() {
+        if constexpr (requires { S::text; }) {
+            if constexpr (!S::text.empty())
+                return S::text.view();
+        }
+        return unqualified_name(zero::types::type_name<S>());
+    }
+
+    /**
+     * Builds the symbol of a magnitude: the one of its unit for the base magnitudes, the ones of its
+     * units raised to their exponents for the derived ones, and the coherent units of every base
+     * dimension for the compound ones. i.e. `kg` or `kg*m*s-2`
+     */
+    template <typename M>
+    consteval symbol_buffer build_symbol() {
+        symbol_buffer symbol;
+        if constexpr (requires { M::exponents; }) {
+            for (std::size_t i = 0; i < M::exponents.size(); ++i) {
+                if (M::exponents[i] == 0 || coherent_symbols[i].empty())
+                    continue;
+                if (symbol.size != 0)
+                    symbol.append("*");
+                symbol.append(coherent_symbols[i]);
+                if (M::exponents[i] != 1)
+                    symbol.append(M::exponents[i]);
+            }
+        } else if constexpr (requires { typename M::units; }) {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((
+                    symbol.append(Is == 0 ? "" : "*"),
+                    symbol.append(symbol_text<typename std::tuple_element_t<Is, typename M::units>::symbol>()),
+                    M::derived_dimension::declared_exponents[Is] != 1
+                        ? symbol.append(M::derived_dimension::declared_exponents[Is])
+                        : void()
+                ), ...);
+            }(std::make_index_sequence<std::tuple_size_v<typename M::units>> {});
+        } else
+            symbol.append(symbol_text<typename M::symbol>());
+        return symbol;
+    }
+
+    template <typename M>
+    constexpr symbol_buffer symbol_storage = build_symbol<M>();
+
+    /// The names of the base dimensions of a magnitude, in the order in which they were declared
+    template <typename M>
+    consteval auto build_dimension_names() {
+        if constexpr (requires { typename M::derived_dimension; })
+            return []<typename... Ds>(std::type_identity<std::tuple<Ds...>>) {
+                return std::array<std::string_view, sizeof...(Ds)> {
+                    zero::physics::base_dimension_names[static_cast<std::size_t>(Ds::dimension_id)]...
+                };
+            }(std::type_identity<typename M::derived_dimension::dimensions> {});
+        else if constexpr (requires { M::exponents; }) {
+            constexpr auto count = static_cast<std::size_t>(std::ranges::count_if(
+                M::exponents.begin(), M::exponents.end() - 1, [](short exponent) { return exponent != 0; }
+            ));
+            std::array<std::string_view, count> names {};
+            for (std::size_t i = 0, name = 0; name < count; ++i)
+                if (M::exponents[i] != 0)
+                    names[name++] = zero::physics::base_dimension_names[i];
+            return names;
+        } else
+            return std::array<std::string_view, 1> {
+                zero::physics::base_dimension_names[static_cast<std::size_t>(M::dimension_id)]
+            };
+    }
+
+    /// The symbols of the units of a magnitude, one per base dimension, in the order in which they were declared
+    template <typename M>
+    consteval auto build_unit_symbols() {
+        if constexpr (requires { typename M::units; })
+            return []<typename... Us>(std::type_identity<std::tuple<Us...>>) {
+                return std::array<std::string_view, sizeof...(Us)> {
+                    symbol_text<typename Us::symbol>()...
+                };
+            }(std::type_identity<typename M::units> {});
+        else if constexpr (requires { M::exponents; }) {
+            constexpr auto count = build_dimension_names<M>().size();
+            std::array<std::string_view, count> symbols {};
+            for (std::size_t i = 0, symbol = 0; symbol < count; ++i)
+                if (M::exponents[i] != 0)
+                    symbols[symbol++] = coherent_symbols[i];
+            return symbols;
+        } else
+            return std::array<std::string_view, 1> {symbol_text<typename M::symbol>()};
+    }
+
+    /// Only called with a braced argument, which is copy-list-initialized, so a narrowing conversion isn't viable
+    template <typename T>
+    void accept_without_narrowing(T (&&)[1]) noexcept;
+
+    /**
+     * Whether an amount of type `T` expressed in the magnitude `From` is converted into `To` without
+     * being truncated: the floating point amounts always are, and the integral and fixed-point ones
+     * only when they are scaled by a whole factor
+     */
+    template <typename From, typename To, typename T>
+    concept ExactConversion = std::is_floating_point_v<T> || conversion_factor<From, To>::den == 1;
+
+    /**
+     * Whether an amount of type `T2` expressed in the magnitude `From` keeps its value when it's
+     * converted into an amount of type `T` expressed in `To`: it's not a narrowing conversion, and
+     * the conversion is exact
+     */
+    template <typename From, typename T2, typename To, typename T>
+    concept ValuePreservingConversion = requires (T2 amount) { accept_without_narrowing<T>({amount}); }
+        && ExactConversion<From, To, T>;
+}
 
 export namespace zero::physics {
     template <typename T>
@@ -39,7 +222,7 @@ export namespace zero::physics {
     };
 
     template <typename T>
-    concept Magnitude = is_base_magnitude<T>::value || DerivedMagnitude<T>;
+    concept Magnitude = is_base_magnitude<T>::value || DerivedMagnitude<T> || CompoundUnit<T>;
 
     template <typename T, typename R>
     concept SameDimension = requires {
@@ -59,9 +242,60 @@ export namespace zero::physics {
         >;
     };
 
+    /// The exponents of the base dimensions of the magnitude `M`
+    template <Magnitude M>
+    constexpr dimension_exponents exponents_of = magnitude_exponents<M>();
+
+    /**
+     * The names of the base dimensions of the magnitude `M`, computed once at compile time, in the
+     * order in which they were declared. i.e. `{"mass", "length", "time"}` for a `Newton`
+     */
+    template <Magnitude M>
+    constexpr auto dimension_names_of = build_dimension_names<M>();
+
+    /// The symbols of the units of every base dimension of `M`, i.e. `{"kg", "m", "s"}` for a `Newton`
+    template <Magnitude M>
+    constexpr auto unit_symbols_of = build_unit_symbols<M>();
+
+    /**
+     * The name of the type of the magnitude `M` without its namespaces, i.e. `Newton`. The
+     * compound units have no name of their own, so they are named by their symbol
+     */
+    template <Magnitude M>
+    constexpr std::string_view magnitude_name_of = CompoundUnit<M>
+        ? symbol_storage<M>.view()
+        : unqualified_name(zero::types::type_name<M>());
+
+    /**
+     * Two magnitudes of the same physical dimension, that can be converted between them and
+     * combined in additions and subtractions. i.e. a `Newton` and the product of a `Kilogram`
+     * by a `MetersPerSecondSquared`
+     */
+    template <typename T, typename R>
+    concept CommonDimension = Magnitude<T> && Magnitude<R> && exponents_of<T> == exponents_of<R>;
+
+    /// A magnitude whose base dimensions all have a zero exponent, like the quotient of two speeds
     template <typename T>
-    concept ValidAmountType = (std::is_integral_v<T> || std::is_floating_point_v<T>)
-        && !std::is_same_v<T, char>;
+    concept DimensionlessMagnitude = Magnitude<T> && exponents_of<T> == dimension_exponents {};
+
+    /// The magnitude of the product of two magnitudes. Its exponents are the sum of theirs
+    template <Magnitude M1, Magnitude M2>
+    using magnitude_product = compound_unit<
+        combine_exponents<false>(exponents_of<M1>, exponents_of<M2>),
+        zero::math::rational_multiply<typename magnitude_scale<M1>::type, typename magnitude_scale<M2>::type>
+    >;
+
+    /// The magnitude of the quotient of two magnitudes. Its exponents are the difference of theirs
+    template <Magnitude M1, Magnitude M2>
+    using magnitude_quotient = compound_unit<
+        combine_exponents<true>(exponents_of<M1>, exponents_of<M2>),
+        zero::math::rational_divide<typename magnitude_scale<M1>::type, typename magnitude_scale<M2>::type>
+    >;
+
+    /// The built-in arithmetic types, or a {@link zero::math::fixed} point number
+    template <typename T>
+    concept ValidAmountType = ((std::is_integral_v<T> || std::is_floating_point_v<T>)
+        && !std::is_same_v<T, char>) || zero::math::FixedPoint<T>;
 
     /**
      * A measurable property of a physical body, expressed in the terms of a scalar value with
@@ -71,229 +305,291 @@ export namespace zero::physics {
      */
     template <Magnitude M, ValidAmountType T = double>
     struct quantity {
+        using magnitude = M;
+        using amount_type = T;
+
         T amount;
         constexpr quantity<M, T>() noexcept = default;
         constexpr explicit quantity<M, T>(T val) noexcept : amount(val) {}
 
         /**
-         * Converts a quantity of a dimension to another one with the same dimension
+         * Conversion from a quantity of any other magnitude with the same dimension, so i.e. the
+         * product of a mass and an acceleration can be stored as a `quantity<Newton>`. It's only
+         * implicit when the amount keeps its value, so i.e. a `double` amount, or a number of grams
+         * converted into integral kilograms, has to be converted explicitly
          */
-        template <Magnitude Target>
-        constexpr auto to() const noexcept -> quantity<Target, T> {
-            if constexpr (is_base_magnitude<Target>::value)
-                return quantity<Target, T>(
-                    amount * M::ratio::value / Target::ratio::value *
-                        M::ratio::base_denominator / Target::ratio::base_denominator
-                );
-            else
-                return quantity<Target, T>((amount * M::dimensionality) / Target::dimensionality);
+        template <Magnitude M2, ValidAmountType T2>
+            requires (!std::is_same_v<quantity<M2, T2>, quantity<M, T>>) && CommonDimension<M, M2>
+        constexpr explicit(!ValuePreservingConversion<M2, T2, M, T>) quantity<M, T>(const quantity<M2, T2>& other)
+            noexcept(std::is_arithmetic_v<T> && std::is_arithmetic_v<T2>)
+            : amount(static_cast<T>(conversion_factor<M2, M>::apply(other.amount))) {}
+
+        /// The plain number of a dimensionless quantity, i.e. the quotient of two speeds
+        constexpr explicit operator T() const noexcept(std::is_arithmetic_v<T>) requires DimensionlessMagnitude<M> {
+            return magnitude_scale<M>::type::apply(amount);
         }
 
         /**
-         * @return an {@link std::vector} with the dimensions declared for the Magnitude M
-         * as {@link std::string}
+         * Converts a quantity of a dimension to another one with the same dimension.
+         *
+         * The exact factor between both units is folded at compile time, so the conversion is a
+         * single multiplication for floating point amounts, and integer arithmetic only for integral ones
          */
-        template <typename Dummy = void, typename = std::enable_if_t<DerivedMagnitude<M>, Dummy>>
-        std::vector<std::string> dimensions() const {
-            std::vector<std::string> stringified_dimensions;
-            std::apply([&](auto... dim) {
-                ((stringified_dimensions.emplace_back(zero::split_str(zero::types::type_name<decltype(dim)>()).back())), ...);
-            }, typename M::derived_dimension::dimensions{});
-            return stringified_dimensions;
+        template <Magnitude Target>
+            requires CommonDimension<M, Target>
+        constexpr auto to() const noexcept(std::is_arithmetic_v<T>) -> quantity<Target, T> {
+            return quantity<Target, T>(conversion_factor<M, Target>::apply(amount));
+        }
+
+        /// @return the names of the base dimensions of the magnitude `M`. See {@link dimension_names_of}
+        [[nodiscard]] static constexpr const auto& dimensions() noexcept {
+            return dimension_names_of<M>;
         }
 
         /**
-         * prints a formatted version of the dimensions that are declared for the Magnitude M
+         * Prints the name of the magnitude `M` followed by its dimensions, i.e.
+         * `Newton has dimensions of: [mass, length, time]`. Every piece is a precomputed
+         * constant, so nothing is allocated
          */
-        template <typename Dummy = void, typename = std::enable_if_t<DerivedMagnitude<M>, Dummy>>
-        void print_dimensions() const requires DerivedMagnitude<M> {
-            std::string dimension_names;
-            std::apply([&](auto... dim) {
-                ((dimension_names +=
-                    zero::split_str(zero::types::type_name<decltype(dim)>(), "::").back() + ", "
-                ), ...);
-            }, typename M::derived_dimension::dimensions{});
-            auto magnitude_str_t = zero::split_str(zero::types::type_name<M>(), "::").back();
-            std::cout << magnitude_str_t << " has dimensions of: ["
-                << dimension_names.substr(0, dimension_names.size() - 2) << "]\n";
+        static void print_dimensions(std::ostream& os = std::cout) {
+            os << magnitude_name_of<M> << " has dimensions of: [";
+            for (std::size_t i = 0; i < dimension_names_of<M>.size(); ++i)
+                os << (i == 0 ? "" : ", ") << dimension_names_of<M>[i];
+            os << "]\n";
         }
     };
 
     /**
-     * @brief Sum of two scalar values in a binary expression for the - operator
-     * @return the resultant scalar value of adding the amount of the two quantities, with
-     * the return type of the one that has the bigger ratio given their common dimension
+     * The type of the result of an arithmetic operation between two quantities of a common
+     * dimension, with the common type of both amounts, so i.e. an `int` amount added to a
+     * `double` one isn't truncated. Floating point results are expressed in the magnitude with
+     * the bigger scale of both, and the integral and fixed-point ones in the magnitude with the
+     * smaller scale, so both amounts are scaled by whole factors and nothing is truncated
      */
-    template<BaseMagnitude M1, BaseMagnitude M2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
-        requires SameDimension<M1, M2>
-    [[nodiscard]]
-    constexpr auto operator+(const quantity<M1, T1>& lhs, const quantity<M2, T2>& rhs)
-         -> quantity<std::conditional_t<(M1::ratio::value > M2::ratio::value), M1, M2>>
-    {
-        constexpr auto m1_ratio_v = M1::ratio::value;
-        constexpr auto m2_ratio_v = M2::ratio::value;
+    template <Magnitude M1, ValidAmountType T1, Magnitude M2, ValidAmountType T2>
+    using common_quantity = quantity<
+        std::conditional_t<
+            (std::is_floating_point_v<std::common_type_t<T1, T2>>
+                ? magnitude_scale<M1>::type::value > magnitude_scale<M2>::type::value
+                : magnitude_scale<M1>::type::value < magnitude_scale<M2>::type::value),
+            M1, M2
+        >,
+        std::common_type_t<T1, T2>
+    >;
 
-        if constexpr (m1_ratio_v > m2_ratio_v)
-            return quantity<M1, T1>(
-                (lhs.amount * m1_ratio_v + rhs.amount * m2_ratio_v) / m1_ratio_v
-            );
-        else
-            return quantity<M2, T2>(
-                (lhs.amount * m1_ratio_v + rhs.amount * m2_ratio_v) / m2_ratio_v
-            );
-    }
+    /**
+     * Whether two quantities can be added or subtracted exactly: they have a common dimension, and
+     * both amounts are converted exactly into the magnitude of their {@link common_quantity}. It
+     * rejects the integral amounts of two units whose scales aren't multiples, i.e. miles and kilometers
+     */
+    template <typename M1, typename T1, typename M2, typename T2>
+    concept ExactlyCombinable = CommonDimension<M1, M2>
+        && ExactConversion<M1, typename common_quantity<M1, T1, M2, T2>::magnitude, std::common_type_t<T1, T2>>
+        && ExactConversion<M2, typename common_quantity<M1, T1, M2, T2>::magnitude, std::common_type_t<T1, T2>>;
 
     /**
-     * @brief same as the operator+() overload for the {@link BaseMagnitude}, but for {@link DerivedMagnitude}
+     * @brief Sum of two scalar values in a binary expression for the + operator
+     * @return the resultant scalar value of adding the amount of the two quantities, expressed
+     * in their {@link common_quantity}. The conversion factors are folded at compile time, so it costs a single multiply-add for
+     * floating point amounts, and only integer arithmetic for the integral and fixed-point ones
      */
-    template<DerivedMagnitude DM1, DerivedMagnitude DM2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
-        requires SameDimensions<DM1, DM2>
+    template<Magnitude M1, Magnitude M2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
+        requires ExactlyCombinable<M1, T1, M2, T2>
     [[nodiscard]]
-    consteval auto operator+(const quantity<DM1, T1>& lhs, const quantity<DM2, T2>& rhs) {
-        constexpr double dm1_dimensionality = DM1::dimensionality;
-        constexpr double dm2_dimensionality = DM2::dimensionality;
-
-        if constexpr (dm1_dimensionality > dm2_dimensionality)
-            return quantity<DM1, T1>((lhs.amount * dm1_dimensionality) + (rhs.amount * dm2_dimensionality));
-        else
-            return quantity<DM2, T2>((lhs.amount * dm1_dimensionality) + (rhs.amount * dm2_dimensionality));
+    constexpr auto operator+(const quantity<M1, T1>& lhs, const quantity<M2, T2>& rhs) noexcept(std::is_arithmetic_v<std::common_type_t<T1, T2>>)
+        -> common_quantity<M1, T1, M2, T2>
+    {
+        using result = common_quantity<M1, T1, M2, T2>;
+        using R = typename result::magnitude;
+        using Amount = typename result::amount_type;
+        if constexpr (std::is_floating_point_v<Amount>) {
+            constexpr auto lhs_factor = static_cast<Amount>(conversion_factor<M1, R>::value);
+            constexpr auto rhs_factor = static_cast<Amount>(conversion_factor<M2, R>::value);
+            return result(static_cast<Amount>(lhs.amount) * lhs_factor + static_cast<Amount>(rhs.amount) * rhs_factor);
+        } else
+            // Integral and fixed-point amounts are scaled by whole factors, so no floating point is involved
+            return result(static_cast<Amount>(conversion_factor<M1, R>::apply(static_cast<Amount>(lhs.amount))
+                + conversion_factor<M2, R>::apply(static_cast<Amount>(rhs.amount))));
     }
 
     /**
      * @brief Subtraction of two scalar values in a binary expression for the - operator
-     * @return the resultant scalar value of subtracting the amount of the two quantities, with
-     * the return type of the one that has the bigger ratio given their common dimension
+     * @return the resultant scalar value of subtracting the amount of the two quantities, expressed
+     * in their {@link common_quantity}
      */
     template<Magnitude M1, Magnitude M2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
-        requires SameDimension<M1, M2>
+        requires ExactlyCombinable<M1, T1, M2, T2>
     [[nodiscard]]
-    constexpr auto operator-(const quantity<M1, T1>& lhs, const quantity<M2, T2>& rhs)
-        -> quantity<std::conditional_t<(M1::ratio::value > M2::ratio::value), M1, M2>>
+    constexpr auto operator-(const quantity<M1, T1>& lhs, const quantity<M2, T2>& rhs) noexcept(std::is_arithmetic_v<std::common_type_t<T1, T2>>)
+        -> common_quantity<M1, T1, M2, T2>
     {
-        constexpr auto m1_ratio_v = M1::ratio::value;
-        constexpr auto m2_ratio_v = M2::ratio::value;
-
-        if constexpr (m1_ratio_v > m2_ratio_v)
-            return quantity<M1, T1>(
-                (lhs.amount * m1_ratio_v - rhs.amount * m2_ratio_v) / m1_ratio_v
-            );
-        else
-            return quantity<M2, T2>(
-                (lhs.amount * m1_ratio_v - rhs.amount * m2_ratio_v) / m2_ratio_v
-            );
+        using result = common_quantity<M1, T1, M2, T2>;
+        using R = typename result::magnitude;
+        using Amount = typename result::amount_type;
+        if constexpr (std::is_floating_point_v<Amount>) {
+            constexpr auto lhs_factor = static_cast<Amount>(conversion_factor<M1, R>::value);
+            constexpr auto rhs_factor = static_cast<Amount>(conversion_factor<M2, R>::value);
+            return result(static_cast<Amount>(lhs.amount) * lhs_factor - static_cast<Amount>(rhs.amount) * rhs_factor);
+        } else
+            // Integral and fixed-point amounts are scaled by whole factors, so no floating point is involved
+            return result(static_cast<Amount>(conversion_factor<M1, R>::apply(static_cast<Amount>(lhs.amount))
+                - conversion_factor<M2, R>::apply(static_cast<Amount>(rhs.amount))));
     }
 
     /**
-     * @brief same as the operator-() overload for the {@link BaseMagnitude}, but for {@link DerivedMagnitude}
+     * @brief Multiplication of two quantities in a binary expression for the * operator
+     * @return a quantity whose dimension has the sum of the exponents of both dimensions, expressed
+     * in the {@link compound_unit} whose scale is the product of both scales, so no conversion is
+     * performed at runtime. i.e. a mass by an acceleration is a force, and it can be assigned
+     * to a `quantity<Newton>`
      */
-    template<DerivedMagnitude DM1, DerivedMagnitude DM2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
-        requires SameDimensions<DM1, DM2>
+    template<Magnitude M1, Magnitude M2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
     [[nodiscard]]
-    consteval auto operator-(const quantity<DM1, T1>& lhs, const quantity<DM2, T2>& rhs) {
-        constexpr double dm1_dimensionality = DM1::dimensionality;
-        constexpr double dm2_dimensionality = DM2::dimensionality;
-
-        if constexpr (dm1_dimensionality > dm2_dimensionality)
-            return quantity<DM1, T1>((lhs.amount * dm1_dimensionality) - (rhs.amount * dm2_dimensionality));
-        else
-            return quantity<DM2, T2>((lhs.amount * dm1_dimensionality) - (rhs.amount * dm2_dimensionality));
+    constexpr auto operator*(const quantity<M1, T1>& lhs, const quantity<M2, T2>& rhs) noexcept(std::is_arithmetic_v<std::common_type_t<T1, T2>>)
+        -> quantity<magnitude_product<M1, M2>, std::common_type_t<T1, T2>>
+    {
+        using T = std::common_type_t<T1, T2>;
+        return quantity<magnitude_product<M1, M2>, T>(static_cast<T>(lhs.amount) * static_cast<T>(rhs.amount));
     }
 
     /**
-     * @brief Multiplication of two scalar values in a binary expression for the - operator
-     * @return the resultant scalar value of multiply the amount of the two quantities, with
-     * the return type of the one that has the bigger ratio given their common dimension
+     * @brief Division of two quantities in a binary expression for the / operator
+     * @return a quantity whose dimension has the difference of the exponents of both dimensions,
+     * expressed in the {@link compound_unit} whose scale is the quotient of both scales
      */
     template<Magnitude M1, Magnitude M2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
-        requires SameDimension<M1, M2>
     [[nodiscard]]
-    constexpr auto operator*(const quantity<M1, T1>& lhs, const quantity<M2, T2>& rhs)
-        -> quantity<std::conditional_t<(M1::ratio::value > M2::ratio::value), M1, M2>>
+    constexpr auto operator/(const quantity<M1, T1>& lhs, const quantity<M2, T2>& rhs) noexcept(std::is_arithmetic_v<std::common_type_t<T1, T2>>)
+        -> quantity<magnitude_quotient<M1, M2>, std::common_type_t<T1, T2>>
     {
-        constexpr auto m1_ratio_v = M1::ratio::value;
-        constexpr auto m2_ratio_v = M2::ratio::value;
+        using T = std::common_type_t<T1, T2>;
+        return quantity<magnitude_quotient<M1, M2>, T>(static_cast<T>(lhs.amount) / static_cast<T>(rhs.amount));
+    }
 
-        if constexpr (m1_ratio_v > m2_ratio_v)
-            return quantity<M1, T1>(
-                (lhs.amount * m1_ratio_v * rhs.amount * m2_ratio_v) / m1_ratio_v
-            );
-        else
-            return quantity<M2, T2>(
-                (lhs.amount * m1_ratio_v * rhs.amount * m2_ratio_v) / m2_ratio_v
-            );
+    /// Scales a quantity by a dimensionless number
+    template<Magnitude M, ValidAmountType T>
+    [[nodiscard]]
+    constexpr quantity<M, T> operator*(const quantity<M, T>& lhs, std::type_identity_t<T> factor) noexcept(std::is_arithmetic_v<T>) {
+        return quantity<M, T>(lhs.amount * factor);
     }
 
-    /**
-     * @brief same as the operator*() overload for the {@link BaseMagnitude}, but for {@link DerivedMagnitude}
-     */
-    template<DerivedMagnitude DM1, DerivedMagnitude DM2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
-        requires SameDimensions<DM1, DM2>
+    template<Magnitude M, ValidAmountType T>
+    [[nodiscard]]
+    constexpr quantity<M, T> operator*(std::type_identity_t<T> factor, const quantity<M, T>& rhs) noexcept(std::is_arithmetic_v<T>) {
+        return quantity<M, T>(factor * rhs.amount);
+    }
+
+    template<Magnitude M, ValidAmountType T>
     [[nodiscard]]
-    consteval auto operator*(const quantity<DM1, T1>& lhs, const quantity<DM2, T2>& rhs) {
-        constexpr double dm1_dimensionality = DM1::dimensionality;
-        constexpr double dm2_dimensionality = DM2::dimensionality;
+    constexpr quantity<M, T> operator/(const quantity<M, T>& lhs, std::type_identity_t<T> factor) noexcept(std::is_arithmetic_v<T>) {
+        return quantity<M, T>(lhs.amount / factor);
+    }
 
-        if constexpr (dm1_dimensionality > dm2_dimensionality)
-            return quantity<DM1, T1>((lhs.amount * dm1_dimensionality) * (rhs.amount * dm2_dimensionality));
-        else
-            return quantity<DM2, T2>((lhs.amount * dm1_dimensionality) * (rhs.amount * dm2_dimensionality));
+    /// The inverse of a quantity scaled by a number, i.e. the frequency of a period
+    template<Magnitude M, ValidAmountType T>
+    [[nodiscard]]
+    constexpr auto operator/(std::type_identity_t<T> factor, const quantity<M, T>& rhs) noexcept(std::is_arithmetic_v<T>)
+        -> quantity<magnitude_quotient<coherent_unit<dimension_exponents {}>, M>, T>
+    {
+        return quantity<magnitude_quotient<coherent_unit<dimension_exponents {}>, M>, T>(factor / rhs.amount);
     }
 
     /**
-     * @brief Division of two scalar values in a binary expression for the - operator
-     * @return the resultant scalar value of divide the amount of the two quantities, with
-     * the return type of the one that has the bigger ratio given their common dimension
+     * Converts the amounts of `in`, expressed in `From`, into the same amounts expressed in `Target`,
+     * writing them in `out`. Both spans can be the same one.
+     *
+     * Every amount takes a single multiplication by the folded conversion factor, in a loop
+     * that the compiler vectorizes
+     * @throws std::invalid_argument when the spans have different sizes
      */
-    template<Magnitude M1, Magnitude M2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
-    requires SameDimension<M1, M2>
-        [[nodiscard]]
-    constexpr auto operator/(const quantity<M1, T1>& lhs, const quantity<M2, T2>& rhs)
-        -> quantity<std::conditional_t<(M1::ratio::value > M2::ratio::value), M1, M2>>
-    {
-        constexpr auto m1_ratio_v = M1::ratio::value;
-        constexpr auto m2_ratio_v = M2::ratio::value;
-
-        if constexpr (m1_ratio_v > m2_ratio_v)
-            return quantity<M1, T1>(
-                ((lhs.amount * m1_ratio_v) / (rhs.amount * m2_ratio_v)) / m1_ratio_v
-            );
-        else
-            return quantity<M2, T2>(
-                ((lhs.amount * m1_ratio_v) / (rhs.amount * m2_ratio_v)) / m2_ratio_v
-            );
+    template <Magnitude From, Magnitude Target, ValidAmountType T = double>
+        requires CommonDimension<From, Target>
+    constexpr void convert(std::span<const std::type_identity_t<T>> in, std::span<std::type_identity_t<T>> out) {
+        if (in.size() != out.size())
+            throw std::invalid_argument("convert: the input and the output must have the same size");
+        for (std::size_t i = 0; i < in.size(); ++i)
+            out[i] = conversion_factor<From, Target>::apply(in[i]);
     }
 
     /**
-    * @brief same as the operator/() overload for the {@link BaseMagnitude}, but for {@link DerivedMagnitude}
-    */
-    template<DerivedMagnitude DM1, DerivedMagnitude DM2, ValidAmountType T1 = double, ValidAmountType T2 = T1>
-        requires SameDimensions<DM1, DM2>
-    [[nodiscard]]
-    consteval auto operator/(const quantity<DM1, T1>& lhs, const quantity<DM2, T2>& rhs) {
-        constexpr double dm1_dimensionality = DM1::dimensionality;
-        constexpr double dm2_dimensionality = DM2::dimensionality;
+     * Converts a batch of quantities into `Target`, as a whole. See {@link convert} for the amounts
+     * @throws std::invalid_argument when the spans have different sizes
+     */
+    template <Magnitude Target, Magnitude M, ValidAmountType T>
+        requires CommonDimension<M, Target>
+    constexpr void convert(std::span<const quantity<M, T>> in, std::span<quantity<Target, T>> out) {
+        if (in.size() != out.size())
+            throw std::invalid_argument("convert: the input and the output must have the same size");
+        for (std::size_t i = 0; i < in.size(); ++i)
+            out[i].amount = conversion_factor<M, Target>::apply(in[i].amount);
+    }
 
-        if constexpr (dm1_dimensionality > dm2_dimensionality)
-            return quantity<DM1, T1>((lhs.amount * dm1_dimensionality) / (rhs.amount * dm2_dimensionality));
-        else
-            return quantity<DM2, T2>((lhs.amount * dm1_dimensionality) / (rhs.amount * dm2_dimensionality));
+    template <Magnitude Target, Magnitude M, ValidAmountType T>
+        requires CommonDimension<M, Target>
+    constexpr void convert(std::span<quantity<M, T>> in, std::span<quantity<Target, T>> out) {
+        convert<Target>(std::span<const quantity<M, T>> {in}, out);
     }
 
+    /**
+     * The symbol of the units of the magnitude `M`, computed at compile time. i.e. `kg` for a `Kilogram`
+     * or `kg*m*s-2` for a `Newton`. The compound units are expressed in the coherent units of
+     * every base dimension, and the dimensionless ones have an empty symbol
+     */
+    template <Magnitude M>
+    constexpr std::string_view symbol_of = symbol_storage<M>.view();
 
+    /**
+     * Writes the amount of `q`, followed by a space and the symbol of its units, into the character
+     * range [first, last), without allocating. The amount is written as `std::to_chars` does, with
+     * the shortest representation that round trips
+     * @return the end of the written characters, or `last` with `std::errc::value_too_large` when
+     * the range is too short
+     */
+    template <Magnitude M, ValidAmountType T>
+    std::to_chars_result to_chars(char* first, char* last, const quantity<M, T>& q) noexcept {
+        using std::to_chars; // Along with the overloads of the amount types found by ADL, i.e. for fixed-point numbers
+        std::to_chars_result result;
+        if constexpr (CompoundUnit<M>)
+            // Compound units have no symbols of their own, so they are printed in the coherent units
+            result = to_chars(first, last, magnitude_scale<M>::type::apply(q.amount));
+        else
+            result = to_chars(first, last, q.amount);
+        if (result.ec != std::errc {} || symbol_of<M>.empty())
+            return result;
+
+        if (static_cast<std::size_t>(last - result.ptr) < symbol_of<M>.size() + 1)
+            return {last, std::errc::value_too_large};
+        *result.ptr++ = ' ';
+        return {std::copy(symbol_of<M>.begin(), symbol_of<M>.end(), result.ptr), std::errc {}};
+    }
 
     /**
-     * Sends to an output stream a formatted version of some {@link quantity}
+     * Writes `q` as {@link to_chars} does into an output iterator, without allocating
+     * @return the iterator past the last written character, or `out` when the text is too long to be formatted
      */
-    template<typename M>
-    constexpr std::ostream& operator<<(std::ostream& os, const quantity<M>& q) {
-        if constexpr (is_base_magnitude<M>::value)
-            os << q.amount << " " << zero::split_str(zero::types::type_name<typename M::symbol>(), "::").back();
-        else {
-            std::string out;
-            derived_magnitude_symbols<M>(out);
-            os << q.amount << out;
-        }
+    template <std::output_iterator<char> Out, Magnitude M, ValidAmountType T>
+    Out format_to(Out out, const quantity<M, T>& q) {
+        // Enough for the longest shortest round trip representation of a double and any symbol
+        std::array<char, 128> buffer;
+        const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), q);
+        // On an error `ptr` is the end of the buffer, that hasn't been fully written, so nothing is copied
+        if (result.ec != std::errc {})
+            return out;
+        return std::copy(buffer.data(), result.ptr, out);
+    }
 
+    /**
+     * Sends to an output stream a formatted version of some {@link quantity}. The amount honors
+     * the formatting flags of the stream, and the symbol is a precomputed constant, so nothing is allocated
+     */
+    template<Magnitude M, ValidAmountType T>
+    std::ostream& operator<<(std::ostream& os, const quantity<M, T>& q) {
+        if constexpr (CompoundUnit<M>)
+            os << magnitude_scale<M>::type::apply(q.amount);
+        else
+            os << q.amount;
+        if constexpr (!symbol_of<M>.empty())
+            os << ' ' << symbol_of<M>;
         return os;
     }
 }
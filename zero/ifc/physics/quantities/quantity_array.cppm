@@ -0,0 +1,259 @@
+/**
+ * @brief Columnar storage for many quantities of the same magnitude
+ *
+ * A `quantity_array<M, T>` keeps the magnitude `M` as a type parameter and the amounts
+ * as a dense buffer of `T`, aligned to a cache line. The unit checks are the same that
+ * the ones of the operators of {@link quantity}, and they are all resolved at compile time,
+ * so the container is just a pointer and a size at runtime.
+ *
+ * Every operation is a plain loop over the raw amounts with the conversion factors
+ * folded into constants, so the compiler vectorizes them.
+ */
+export module physics.quantities:quantity_array;
+
+import std;
+import math;
+
+import :quantity;
+import :quantities.detail;
+
+using namespace quantities::__detail;
+
+namespace quantities::__detail {
+    /// The alignment of the buffers of the amounts, a cache line, which also fits any SIMD register
+    constexpr std::size_t amounts_alignment = 64;
+
+    template <typename T>
+    struct aligned_delete {
+        void operator()(T* ptr) const noexcept {
+            ::operator delete[](ptr, std::align_val_t {amounts_alignment});
+        }
+    };
+
+    template <typename T>
+    using aligned_buffer = std::unique_ptr<T[], aligned_delete<T>>;
+
+    template <typename T>
+    [[nodiscard]] aligned_buffer<T> allocate_amounts(std::size_t size) {
+        if (size == 0)
+            return aligned_buffer<T> {};
+        auto* raw = static_cast<T*>(::operator new[](size * sizeof(T), std::align_val_t {amounts_alignment}));
+        return aligned_buffer<T> {raw};
+    }
+}
+
+export namespace zero::physics {
+    /**
+     * A contiguous sequence of quantities of the magnitude `M`, stored as their raw amounts
+     * @tparam M a type that satisfies the {@link Magnitude} concept
+     * @tparam T the type of the amounts, constrained by the {@link ValidAmountType} concept
+     */
+    template <Magnitude M, ValidAmountType T = double>
+    class quantity_array {
+    private:
+        std::size_t _size;
+        aligned_buffer<T> _amounts;
+
+        void check_same_size(std::size_t other) const {
+            if (other != _size)
+                throw std::invalid_argument("quantity_array: the arrays must have the same size");
+        }
+
+    public:
+        using magnitude = M;
+        using amount_type = T;
+
+        quantity_array() noexcept : _size {0}, _amounts {} {}
+
+        /// An array of `size` quantities, all of them with the same `amount`
+        explicit quantity_array(std::size_t size, T amount = T {})
+            : _size {size}
+            , _amounts {allocate_amounts<T>(size)}
+        {
+            std::uninitialized_fill_n(_amounts.get(), _size, amount);
+        }
+
+        /// An array with a copy of the raw `amounts`, expressed in `M`
+        explicit quantity_array(std::span<const T> amounts)
+            : _size {amounts.size()}
+            , _amounts {allocate_amounts<T>(amounts.size())}
+        {
+            std::uninitialized_copy_n(amounts.data(), _size, _amounts.get());
+        }
+
+        quantity_array(std::initializer_list<T> amounts)
+            : quantity_array(std::span<const T> {amounts.begin(), amounts.size()}) {}
+
+        quantity_array(const quantity_array& other)
+            : quantity_array(std::span<const T> {other.amounts()}) {}
+
+        quantity_array(quantity_array&& other) noexcept
+            : _size {std::exchange(other._size, 0)}
+            , _amounts {std::move(other._amounts)} {}
+
+        quantity_array& operator=(quantity_array other) noexcept {
+            std::swap(_size, other._size);
+            std::swap(_amounts, other._amounts);
+            return *this;
+        }
+
+        ~quantity_array() = default;
+
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+        [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+
+        /// The raw amounts, expressed in the magnitude `M`
+        [[nodiscard]] std::span<T> amounts() noexcept { return {_amounts.get(), _size}; }
+        [[nodiscard]] std::span<const T> amounts() const noexcept { return {_amounts.get(), _size}; }
+
+        [[nodiscard]] quantity<M, T> operator[](std::size_t index) const noexcept {
+            return quantity<M, T>(_amounts[index]);
+        }
+
+        /**
+         * Stores `value` at `index`, converting it into `M` when it's expressed in another magnitude.
+         * The integral and fixed-point amounts must be converted exactly, by a whole factor
+         */
+        template <Magnitude M2>
+            requires CommonDimension<M, M2> && ExactConversion<M2, M, T>
+        void set(std::size_t index, const quantity<M2, T>& value) noexcept(std::is_arithmetic_v<T>) {
+            _amounts[index] = conversion_factor<M2, M>::apply(value.amount);
+        }
+
+        /// @return a new array with every quantity converted into `Target`
+        template <Magnitude Target>
+            requires CommonDimension<M, Target>
+        [[nodiscard]] quantity_array<Target, T> to() const {
+            quantity_array<Target, T> converted(_size);
+            convert<M, Target, T>(amounts(), converted.amounts());
+            return converted;
+        }
+
+        /// Adds element-wise the quantities of `other`, converted exactly into `M`
+        template <Magnitude M2>
+            requires CommonDimension<M, M2> && ExactConversion<M2, M, T>
+        quantity_array& operator+=(const quantity_array<M2, T>& other) {
+            check_same_size(other.size());
+            const auto rhs = other.amounts();
+            if constexpr (std::is_floating_point_v<T>) {
+                constexpr auto factor = static_cast<T>(conversion_factor<M2, M>::value);
+                for (std::size_t i = 0; i < _size; ++i)
+                    _amounts[i] += rhs[i] * factor;
+            } else
+                for (std::size_t i = 0; i < _size; ++i)
+                    _amounts[i] += conversion_factor<M2, M>::apply(rhs[i]);
+            return *this;
+        }
+
+        /// Subtracts element-wise the quantities of `other`, converted exactly into `M`
+        template <Magnitude M2>
+            requires CommonDimension<M, M2> && ExactConversion<M2, M, T>
+        quantity_array& operator-=(const quantity_array<M2, T>& other) {
+            check_same_size(other.size());
+            const auto rhs = other.amounts();
+            if constexpr (std::is_floating_point_v<T>) {
+                constexpr auto factor = static_cast<T>(conversion_factor<M2, M>::value);
+                for (std::size_t i = 0; i < _size; ++i)
+                    _amounts[i] -= rhs[i] * factor;
+            } else
+                for (std::size_t i = 0; i < _size; ++i)
+                    _amounts[i] -= conversion_factor<M2, M>::apply(rhs[i]);
+            return *this;
+        }
+
+        /// Scales every quantity by a dimensionless `factor`
+        quantity_array& operator*=(T factor) noexcept(std::is_arithmetic_v<T>) {
+            for (std::size_t i = 0; i < _size; ++i)
+                _amounts[i] *= factor;
+            return *this;
+        }
+
+        quantity_array& operator/=(T factor) noexcept(std::is_arithmetic_v<T>) {
+            for (std::size_t i = 0; i < _size; ++i)
+                _amounts[i] /= factor;
+            return *this;
+        }
+
+        /// @return the sum of all the quantities
+        [[nodiscard]] quantity<M, T> sum() const noexcept(std::is_arithmetic_v<T>) {
+            // Independent partial sums, so the additions don't depend on each other and can be vectorized
+            constexpr std::size_t lanes = 8;
+            std::array<T, lanes> partial {};
+            std::size_t i = 0;
+            for (; i + lanes <= _size; i += lanes)
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                    partial[lane] += _amounts[i + lane];
+            T total {};
+            for (; i < _size; ++i)
+                total += _amounts[i];
+            for (const T value : partial)
+                total += value;
+            return quantity<M, T>(total);
+        }
+
+        /// @return the arithmetic mean of the quantities, or zero when the array is empty
+        [[nodiscard]] quantity<M, T> mean() const noexcept(std::is_arithmetic_v<T>) {
+            if (_size == 0)
+                return quantity<M, T>(T {});
+            return quantity<M, T>(static_cast<T>(sum().amount / static_cast<T>(_size)));
+        }
+
+        /// @return the smallest quantity. The array can't be empty
+        [[nodiscard]] quantity<M, T> min() const noexcept {
+            return quantity<M, T>(*std::min_element(_amounts.get(), _amounts.get() + _size));
+        }
+
+        /// @return the biggest quantity. The array can't be empty
+        [[nodiscard]] quantity<M, T> max() const noexcept {
+            return quantity<M, T>(*std::max_element(_amounts.get(), _amounts.get() + _size));
+        }
+    };
+
+    /**
+     * Element-wise addition of two arrays of a common dimension, with the same semantics
+     * that the addition of two {@link quantity}
+     * @throws std::invalid_argument when the arrays have different sizes
+     */
+    template <Magnitude M1, Magnitude M2, ValidAmountType T>
+        requires ExactlyCombinable<M1, T, M2, T>
+    [[nodiscard]]
+    auto operator+(const quantity_array<M1, T>& lhs, const quantity_array<M2, T>& rhs) {
+        using R = typename common_quantity<M1, T, M2, T>::magnitude;
+        quantity_array<R, T> result = lhs.template to<R>();
+        result += rhs;
+        return result;
+    }
+
+    /**
+     * Element-wise subtraction of two arrays of a common dimension, with the same semantics
+     * that the subtraction of two {@link quantity}
+     * @throws std::invalid_argument when the arrays have different sizes
+     */
+    template <Magnitude M1, Magnitude M2, ValidAmountType T>
+        requires ExactlyCombinable<M1, T, M2, T>
+    [[nodiscard]]
+    auto operator-(const quantity_array<M1, T>& lhs, const quantity_array<M2, T>& rhs) {
+        using R = typename common_quantity<M1, T, M2, T>::magnitude;
+        quantity_array<R, T> result = lhs.template to<R>();
+        result -= rhs;
+        return result;
+    }
+
+    template <Magnitude M, ValidAmountType T>
+    [[nodiscard]] quantity_array<M, T> operator*(quantity_array<M, T> lhs, T factor) noexcept(std::is_arithmetic_v<T>) {
+        lhs *= factor;
+        return lhs;
+    }
+
+    template <Magnitude M, ValidAmountType T>
+    [[nodiscard]] quantity_array<M, T> operator*(T factor, quantity_array<M, T> rhs) noexcept(std::is_arithmetic_v<T>) {
+        rhs *= factor;
+        return rhs;
+    }
+
+    template <Magnitude M, ValidAmountType T>
+    [[nodiscard]] quantity_array<M, T> operator/(quantity_array<M, T> lhs, T factor) noexcept(std::is_arithmetic_v<T>) {
+        lhs /= factor;
+        return lhs;
+    }
+}
@@ -35,10 +35,15 @@ concept RatioV = (std::is_integral_v<T> || std::is_floating_point_v<T>)
  */
 template <int Base = 10, int Exponent = 0, int BaseDenominator = 1>
 struct ratio {
+    /// The exact value of the power Base^Exponent
+    using exact = zero::math::rational_power<zero::math::Rational<Base>, Exponent>;
+    /// The exact factor of the unit relative to the coherent one, Base^Exponent * BaseDenominator
+    using scale = zero::math::rational_multiply<exact, zero::math::Rational<BaseDenominator>>;
+
     static constexpr double base = static_cast<double>(Base);
     static constexpr double exponent = static_cast<double>(Exponent);
     static constexpr double base_denominator = static_cast<double>(BaseDenominator);
-    static constexpr double value = zero::math::power_of(base, exponent);
+    static constexpr double value = exact::value;
 };
 
 export namespace zero::physics {
@@ -76,5 +81,6 @@ export namespace zero::physics {
         T::base;
         T::exponent;
         T::value;
+        typename T::scale;
     };
 }
@@ -0,0 +1,306 @@
+/**
+ * @brief Units chosen at runtime
+ *
+ * A `unit_registry` enumerates a closed set of magnitudes, giving each of them a dense
+ * runtime {@link unit_id}. Everything the registry knows about its units (their symbols,
+ * dimensions, scales and the conversion factors between the units of the same dimension)
+ * is computed at compile time into flat tables, so resolving a runtime unit is an index
+ * into an array.
+ *
+ * The conversions are designed to be resolved once per column of values: the factor
+ * between two units is looked up a single time, and then applied to every amount with
+ * a plain multiplication. The integral and fixed-point amounts are converted with the
+ * exact fraction between both units instead, with the arithmetic of the static conversions.
+ */
+export module physics.quantities:registry;
+
+import std;
+import math;
+
+import :dimensions;
+import :quantity;
+import :quantities.detail;
+
+using namespace quantities::__detail;
+
+namespace dynamic_units::__detail {
+    /// Converts a floating point `amount` with the closest double to the factor between two units
+    template <typename T>
+    [[nodiscard]] constexpr T convert_amount(T amount, double factor) noexcept {
+        return static_cast<T>(static_cast<double>(amount) * factor);
+    }
+
+    /// Converts an integral or fixed-point `amount` with the exact fraction between two units
+    template <typename T, typename Fraction>
+    [[nodiscard]] constexpr T convert_amount(T amount, const Fraction& factor) noexcept(std::is_arithmetic_v<T>) {
+        if constexpr (std::is_integral_v<T>)
+            return zero::math::apply_fraction(amount, factor.num, factor.den);
+        else
+            return amount.scaled(factor.num, factor.den);
+    }
+}
+
+export namespace zero::physics {
+    /// The runtime identifier of a unit, its position in the list of units of a {@link unit_registry}
+    enum class unit_id : std::uint16_t {};
+
+    /**
+     * A closed set of units that can be selected at runtime
+     * @tparam Units the registered magnitudes, that can't be repeated
+     */
+    template <Magnitude... Units>
+    class unit_registry {
+    public:
+        static constexpr std::size_t size = sizeof...(Units);
+
+        /// The exact factor between two units, the fraction `num / den` with a positive `den`
+        struct exact_factor {
+            zero::math::rational_int num = 0;
+            zero::math::rational_int den = 1;
+        };
+
+        /// The symbol of every unit, indexed by its {@link unit_id}
+        static constexpr std::array<std::string_view, size> symbols {symbol_of<Units>...};
+        /// The exponents of the base dimensions of every unit, indexed by its {@link unit_id}
+        static constexpr std::array<dimension_exponents, size> exponents {exponents_of<Units>...};
+        /// The scale of every unit relative to the coherent unit of its dimension
+        static constexpr std::array<double, size> scales {magnitude_scale<Units>::type::value...};
+
+    private:
+        static_assert(size > 0 && size <= std::numeric_limits<std::uint16_t>::max());
+
+        /// The units grouped by their dimension: the index of the group of every unit and its position inside it
+        struct dimension_groups {
+            std::array<std::size_t, size> group {};
+            std::array<std::size_t, size> position {};
+            std::array<std::size_t, size> group_size {};
+            std::array<std::size_t, size> group_offset {};
+            std::size_t table_size = 0;
+        };
+
+        static consteval dimension_groups build_groups() {
+            dimension_groups groups {};
+            std::size_t count = 0;
+            for (std::size_t unit = 0; unit < size; ++unit) {
+                std::size_t group = 0;
+                while (group < count && exponents[unit] != exponents[groups.position[group]])
+                    ++group;
+                if (group == count)
+                    groups.position[count++] = unit; // Temporarily, the first unit of every group
+                groups.group[unit] = group;
+            }
+            for (std::size_t unit = 0; unit < size; ++unit)
+                groups.position[unit] = groups.group_size[groups.group[unit]]++;
+            for (std::size_t group = 0; group < count; ++group) {
+                groups.group_offset[group] = groups.table_size;
+                groups.table_size += groups.group_size[group] * groups.group_size[group];
+            }
+            return groups;
+        }
+
+        static constexpr dimension_groups groups = build_groups();
+
+        /**
+         * The factors between every pair of units of the same dimension, a dense square
+         * block per dimension stored one after the other
+         */
+        static consteval std::array<double, groups.table_size> build_factors() {
+            std::array<double, groups.table_size> factors {};
+            for (std::size_t from = 0; from < size; ++from)
+                for (std::size_t to = 0; to < size; ++to)
+                    if (groups.group[from] == groups.group[to])
+                        factors[factor_index(from, to)] = scales[from] / scales[to];
+            return factors;
+        }
+
+        [[nodiscard]] static constexpr std::size_t factor_index(std::size_t from, std::size_t to) noexcept {
+            const std::size_t group = groups.group[from];
+            return groups.group_offset[group] + groups.position[from] * groups.group_size[group] + groups.position[to];
+        }
+
+        static constexpr std::array<double, groups.table_size> factors = build_factors();
+
+        /// The exact factor between two units, the zero fraction when they have different dimensions
+        template <Magnitude From, Magnitude To>
+        static consteval exact_factor exact_factor_of() {
+            if constexpr (CommonDimension<From, To>)
+                return {conversion_factor<From, To>::num, conversion_factor<From, To>::den};
+            else
+                return {};
+        }
+
+        /// The exact factors that convert every registered unit into `Target`, indexed by their {@link unit_id}
+        template <Magnitude Target>
+        static constexpr std::array<exact_factor, size> exact_factors_into {exact_factor_of<Units, Target>()...};
+
+        /// The exact counterpart of {@link factors}, with the same layout
+        static consteval std::array<exact_factor, groups.table_size> build_exact_factors() {
+            const std::array<std::array<exact_factor, size>, size> columns {exact_factors_into<Units>...};
+            std::array<exact_factor, groups.table_size> exact {};
+            for (std::size_t from = 0; from < size; ++from)
+                for (std::size_t to = 0; to < size; ++to)
+                    if (groups.group[from] == groups.group[to])
+                        exact[factor_index(from, to)] = columns[to][from];
+            return exact;
+        }
+
+        static constexpr std::array<exact_factor, groups.table_size> exact_factors = build_exact_factors();
+
+        [[nodiscard]] static constexpr std::size_t index(unit_id unit) {
+            const auto value = static_cast<std::size_t>(unit);
+            if (value >= size)
+                throw std::out_of_range("unit_registry: the unit isn't registered");
+            return value;
+        }
+
+        template <Magnitude M, std::size_t... Is>
+        static consteval std::size_t index_of(std::index_sequence<Is...>) {
+            std::size_t found = size;
+            ((std::is_same_v<M, Units> ? (found = Is) : found), ...);
+            return found;
+        }
+
+    public:
+        /// The identifier of the registered magnitude `M`
+        template <Magnitude M>
+            requires (std::is_same_v<M, Units> || ...)
+        static constexpr unit_id id_of = static_cast<unit_id>(index_of<M>(std::index_sequence_for<Units...> {}));
+
+        /// @return the unit whose symbol is `symbol`, if it's registered
+        [[nodiscard]] static constexpr std::optional<unit_id> find(std::string_view symbol) noexcept {
+            for (std::size_t unit = 0; unit < size; ++unit)
+                if (symbols[unit] == symbol)
+                    return static_cast<unit_id>(unit);
+            return std::nullopt;
+        }
+
+        [[nodiscard]] static constexpr std::string_view symbol(unit_id unit) { return symbols[index(unit)]; }
+
+        /// @return true when both units measure the same dimension
+        [[nodiscard]] static constexpr bool convertible(unit_id from, unit_id to) {
+            return groups.group[index(from)] == groups.group[index(to)];
+        }
+
+        /**
+         * @return the factor that converts an amount expressed in `from` into an amount expressed in `to`
+         * @throws std::invalid_argument when the units have different dimensions
+         */
+        [[nodiscard]] static constexpr double factor(unit_id from, unit_id to) {
+            if (!convertible(from, to))
+                throw std::invalid_argument("unit_registry: the units have different dimensions");
+            return factors[factor_index(static_cast<std::size_t>(from), static_cast<std::size_t>(to))];
+        }
+
+        /**
+         * @return the factor that converts an amount expressed in `from` into an amount expressed in `Target`,
+         * that doesn't need to be registered
+         * @throws std::invalid_argument when `from` and `Target` have different dimensions
+         */
+        template <Magnitude Target>
+        [[nodiscard]] static constexpr double factor(unit_id from) {
+            const std::size_t unit = index(from);
+            if (exponents[unit] != exponents_of<Target>)
+                throw std::invalid_argument("unit_registry: the units have different dimensions");
+            return scales[unit] / magnitude_scale<Target>::type::value;
+        }
+
+        /**
+         * @return the exact fraction that converts an amount expressed in `from` into an amount expressed in `to`
+         * @throws std::invalid_argument when the units have different dimensions
+         */
+        [[nodiscard]] static constexpr exact_factor exact(unit_id from, unit_id to) {
+            if (!convertible(from, to))
+                throw std::invalid_argument("unit_registry: the units have different dimensions");
+            return exact_factors[factor_index(static_cast<std::size_t>(from), static_cast<std::size_t>(to))];
+        }
+
+        /**
+         * @return the exact fraction that converts an amount expressed in `from` into an amount expressed in `Target`
+         * @throws std::invalid_argument when `from` and `Target` have different dimensions
+         */
+        template <Magnitude Target>
+        [[nodiscard]] static constexpr exact_factor exact(unit_id from) {
+            const std::size_t unit = index(from);
+            if (exponents[unit] != exponents_of<Target>)
+                throw std::invalid_argument("unit_registry: the units have different dimensions");
+            return exact_factors_into<Target>[unit];
+        }
+
+        /// The factor that converts the amounts of type `T`: the closest double when it's floating point, and the exact fraction otherwise
+        template <ValidAmountType T>
+        [[nodiscard]] static constexpr auto factor_for(unit_id from, unit_id to) {
+            if constexpr (std::is_floating_point_v<T>)
+                return factor(from, to);
+            else
+                return exact(from, to);
+        }
+
+        /// The factor that converts the amounts of type `T` into `Target`, like {@link factor_for}
+        template <Magnitude Target, ValidAmountType T>
+        [[nodiscard]] static constexpr auto factor_for(unit_id from) {
+            if constexpr (std::is_floating_point_v<T>)
+                return factor<Target>(from);
+            else
+                return exact<Target>(from);
+        }
+
+        /**
+         * Converts a whole column of amounts expressed in `from` into `Target`, resolving the
+         * conversion factor once. The integral and fixed-point amounts are converted exactly, like {@link quantity::to}
+         * @throws std::invalid_argument when the units have different dimensions or the spans different sizes
+         */
+        template <Magnitude Target, ValidAmountType T>
+        static void convert(unit_id from, std::span<const T> in, std::span<quantity<Target, T>> out) {
+            if (in.size() != out.size())
+                throw std::invalid_argument("unit_registry: the spans must have the same size");
+            const auto conversion = factor_for<Target, T>(from);
+            for (std::size_t i = 0; i < in.size(); ++i)
+                out[i].amount = dynamic_units::__detail::convert_amount(in[i], conversion);
+        }
+    };
+
+    /**
+     * A quantity whose unit is only known at runtime, one of the units of `Registry`
+     * @tparam Registry a {@link unit_registry}
+     * @tparam T the type of the amount
+     */
+    template <typename Registry, ValidAmountType T = double>
+    struct basic_dynamic_quantity {
+        T amount;
+        unit_id unit;
+
+        using registry = Registry;
+        using amount_type = T;
+
+        /// A dynamic quantity from a static one, of a registered magnitude
+        template <Magnitude M>
+        [[nodiscard]] static constexpr basic_dynamic_quantity from(const quantity<M, T>& value) noexcept {
+            return {value.amount, Registry::template id_of<M>};
+        }
+
+        /**
+         * @return the quantity converted into the static magnitude `Target`, with a single multiplication, or
+         * exactly for the integral and fixed-point amounts
+         * @throws std::invalid_argument when `Target` has another dimension
+         */
+        template <Magnitude Target>
+        [[nodiscard]] quantity<Target, T> to() const {
+            return quantity<Target, T>(dynamic_units::__detail::convert_amount(amount, Registry::template factor_for<Target, T>(unit)));
+        }
+
+        /// @return the quantity converted into another registered unit, like {@link to}
+        [[nodiscard]] basic_dynamic_quantity to(unit_id target) const {
+            return {dynamic_units::__detail::convert_amount(amount, Registry::template factor_for<T>(unit, target)), target};
+        }
+
+        [[nodiscard]] std::string_view symbol() const { return Registry::symbol(unit); }
+    };
+
+    template <typename Registry, ValidAmountType T>
+    std::ostream& operator<<(std::ostream& os, const basic_dynamic_quantity<Registry, T>& value) {
+        os << value.amount;
+        if (const auto symbol = value.symbol(); !symbol.empty())
+            os << ' ' << symbol;
+        return os;
+    }
+}
@@ -41,12 +41,10 @@ export namespace zero::physics {
         using derived_dimension = DerivedDim;
         using units = std::tuple<BaseUnits...>;
 
-        static constexpr double dimensionality = []<std::size_t... Is>(std::index_sequence<Is...>) {
-            using dm_exp = dimensions_exponents<typename DerivedDim::dimensions>;
-            return (
-                1.0 * ... * power_of(BaseUnits::ratio::value, dm_exp::value[Is])
-            );
-        } (std::make_index_sequence<DerivedDim::total_dimensions>{});
+        /// The exact factor of the unit relative to the coherent one
+        using scale = typename units_scale<DerivedDim, units>::type;
+
+        static constexpr double dimensionality = scale::value;
     };
 
     template <typename T, std::size_t... Is>
@@ -55,4 +53,30 @@ export namespace zero::physics {
         typename T::derived_dimension;
         T::dimensionality;
     } && (std::is_base_of_v<derived_unit<typename T::derived_dimension, std::tuple_element_t<Is, typename T::units>>, T> && ...);
+
+    /* Compound units */
+
+    /**
+     * The unit of the product or the quotient of any other units, described by the exponents
+     * of its base dimensions and its exact scale relative to the coherent unit of that dimension.
+     * They are the result type of the multiplication and the division of quantities, and can
+     * be converted into any named unit of the same dimension
+     */
+    template <dimension_exponents Exponents, IsRational Scale>
+    struct compound_unit {
+        static constexpr dimension_exponents exponents = Exponents;
+        using scale = Scale;
+
+        static constexpr double dimensionality = scale::value;
+    };
+
+    template <typename T>
+    concept CompoundUnit = requires {
+        T::exponents;
+        typename T::scale;
+    } && std::is_same_v<T, compound_unit<T::exponents, typename T::scale>>;
+
+    /// The compound unit of a dimension whose scale is the unity, i.e. `g*m*s-2` for a force
+    template <dimension_exponents Exponents>
+    using coherent_unit = compound_unit<Exponents, Rational<1>>;
 }
@@ -4,10 +4,17 @@
 
 export module physics.quantities:units.symbols;
 
+import fixed_string;
+
 export namespace zero::physics {
-    template<typename T>
+    /**
+     * The base of the symbols of the units. `Text` is the symbol as it's written, stored as static data.
+     * When it's empty, the symbol is written as the name of `T`
+     */
+    template<typename T, zero::fixed_string Text = "">
     struct unit_symbol {
         using symbol = T;
+        static constexpr auto text = Text;
     };
 
     template<typename T>
@@ -21,32 +28,32 @@ export namespace zero::physics {
     struct unit_type: unit_symbol<unit_type> {};
 
     /* ----- Symbols related with the dimension of Mass ----- */
-    struct kg: unit_symbol<kg> {};
-    struct hg: unit_symbol<hg> {};
-    struct dag: unit_symbol<dag> {};
-    struct g: unit_symbol<g> {};
-    struct dg: unit_symbol<dg> {};
-    struct cg: unit_symbol<cg> {};
-    struct mg: unit_symbol<mg> {};
-    struct ng: unit_symbol<ng> {};
-    struct pg: unit_symbol<pg> {};
+    struct kg: unit_symbol<kg, "kg"> {};
+    struct hg: unit_symbol<hg, "hg"> {};
+    struct dag: unit_symbol<dag, "dag"> {};
+    struct g: unit_symbol<g, "g"> {};
+    struct dg: unit_symbol<dg, "dg"> {};
+    struct cg: unit_symbol<cg, "cg"> {};
+    struct mg: unit_symbol<mg, "mg"> {};
+    struct ng: unit_symbol<ng, "ng"> {};
+    struct pg: unit_symbol<pg, "pg"> {};
 
     /* ----- Symbols related with the dimension of Length ----- */
-    struct km: unit_symbol<km> {};
-    struct hm: unit_symbol<hm> {};
-    struct dam: unit_symbol<dam> {};
-    struct m: unit_symbol<m> {};
-    struct dm: unit_symbol<dm> {};
-    struct cm: unit_symbol<cm> {};
-    struct mm: unit_symbol<mm> {};
+    struct km: unit_symbol<km, "km"> {};
+    struct hm: unit_symbol<hm, "hm"> {};
+    struct dam: unit_symbol<dam, "dam"> {};
+    struct m: unit_symbol<m, "m"> {};
+    struct dm: unit_symbol<dm, "dm"> {};
+    struct cm: unit_symbol<cm, "cm"> {};
+    struct mm: unit_symbol<mm, "mm"> {};
 
     /* ----- Symbols related with the dimension of Length ----- */
-    struct d: unit_symbol<d> {};
-    struct h: unit_symbol<h> {};
-    struct min: unit_symbol<min> {};
-    struct s: unit_symbol<s> {};
-    struct ms: unit_symbol<ms> {};
+    struct d: unit_symbol<d, "d"> {};
+    struct h: unit_symbol<h, "h"> {};
+    struct min: unit_symbol<min, "min"> {};
+    struct s: unit_symbol<s, "s"> {};
+    struct ms: unit_symbol<ms, "ms"> {};
 
     /* ----- Symbols related with the dimension of Length ----- */
-    struct A: unit_symbol<A> {};
+    struct A: unit_symbol<A, "A"> {};
 }
@@ -0,0 +1,118 @@
+/**
+* Provides a string whose size is part of its type, built and combined at compile time
+*
+* A {@link fixed_string} is a structural type, so it can be a template parameter: the texts
+* known at compile time, like the symbols of the units or the names of the tests, are stored
+* as static read-only data of the program and never built at runtime.
+*/
+
+export module fixed_string;
+
+import std;
+
+export namespace zero {
+    /**
+     * A string of exactly `N` characters, followed by a null terminator. Its members are public,
+     * as the types of the template parameters require, but it's meant to be used through its functions
+     */
+    template <std::size_t N>
+    struct fixed_string {
+        std::array<char, N + 1> chars {};
+
+        constexpr fixed_string() noexcept = default;
+
+        /// Builds the string from a string literal. It's implicit, so a literal can be the argument of a template parameter
+        constexpr fixed_string(const char (&text)[N + 1]) noexcept {
+            std::copy_n(text, N, chars.begin());
+        }
+
+        /// @throws std::length_error when `text` doesn't have `N` characters, which is a compile time error in a constant expression
+        constexpr explicit fixed_string(std::string_view text) {
+            if (text.size() != N)
+                throw std::length_error("fixed_string: the text doesn't have the size of the string");
+            std::copy_n(text.begin(), N, chars.begin());
+        }
+
+        [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+        [[nodiscard]] static constexpr bool empty() noexcept { return N == 0; }
+
+        [[nodiscard]] constexpr const char* data() const noexcept { return chars.data(); }
+        [[nodiscard]] constexpr const char* c_str() const noexcept { return chars.data(); }
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {chars.data(), N}; }
+        constexpr operator std::string_view() const noexcept { return view(); }
+
+        [[nodiscard]] constexpr char operator[](std::size_t i) const noexcept { return chars[i]; }
+        [[nodiscard]] constexpr const char* begin() const noexcept { return chars.data(); }
+        [[nodiscard]] constexpr const char* end() const noexcept { return chars.data() + N; }
+
+        /// @return the `Count` characters starting at `Pos`, or all of them until the end
+        template <std::size_t Pos, std::size_t Count = std::string_view::npos>
+            requires (Pos <= N)
+        [[nodiscard]] constexpr auto substr() const noexcept {
+            constexpr std::size_t count = std::min(Count, N - Pos);
+            fixed_string<count> result;
+            std::copy_n(chars.begin() + Pos, count, result.chars.begin());
+            return result;
+        }
+
+        /// @return the first `Count` characters
+        template <std::size_t Count>
+            requires (Count <= N)
+        [[nodiscard]] constexpr fixed_string<Count> first() const noexcept { return substr<0, Count>(); }
+
+        /// @return the last `Count` characters
+        template <std::size_t Count>
+            requires (Count <= N)
+        [[nodiscard]] constexpr fixed_string<Count> last() const noexcept { return substr<N - Count>(); }
+
+        template <std::size_t M>
+        [[nodiscard]] friend constexpr fixed_string<N + M> operator+(const fixed_string& lhs, const fixed_string<M>& rhs) noexcept {
+            fixed_string<N + M> result;
+            std::copy_n(lhs.chars.begin(), N, result.chars.begin());
+            std::copy_n(rhs.chars.begin(), M, result.chars.begin() + N);
+            return result;
+        }
+
+        template <std::size_t M>
+        [[nodiscard]] friend constexpr fixed_string<N + M - 1> operator+(const fixed_string& lhs, const char (&rhs)[M]) noexcept {
+            return lhs + fixed_string<M - 1> {rhs};
+        }
+
+        template <std::size_t M>
+        [[nodiscard]] friend constexpr fixed_string<M - 1 + N> operator+(const char (&lhs)[M], const fixed_string& rhs) noexcept {
+            return fixed_string<M - 1> {lhs} + rhs;
+        }
+
+        template <std::size_t M>
+        [[nodiscard]] friend constexpr bool operator==(const fixed_string& lhs, const fixed_string<M>& rhs) noexcept {
+            return lhs.view() == rhs.view();
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const fixed_string& lhs, std::string_view rhs) noexcept {
+            return lhs.view() == rhs;
+        }
+
+        template <std::size_t M>
+        [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const fixed_string& lhs, const fixed_string<M>& rhs) noexcept {
+            return lhs.view() <=> rhs.view();
+        }
+
+        [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const fixed_string& lhs, std::string_view rhs) noexcept {
+            return lhs.view() <=> rhs;
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const fixed_string& text) {
+            return os << text.view();
+        }
+    };
+
+    template <std::size_t N>
+    fixed_string(const char (&)[N]) -> fixed_string<N - 1>;
+
+    /**
+     * The text of a string known at compile time, as a view of its single copy in the static data
+     * of the program, i.e. `text_v<"kg" + suffix>`
+     */
+    template <fixed_string Text>
+    constexpr std::string_view text_v = Text.view();
+}
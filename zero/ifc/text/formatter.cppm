@@ -1,48 +1,759 @@
 /**
 * Provides functions and enums for string formatting
+*
+* The format strings are parsed at compile time: a {@link format_string} splits its pattern
+* into the literal segments and the replacement fields, parses the format specification of
+* every field, and refuses to compile when the fields don't match the arguments. At runtime,
+* only the literals are copied and the arguments formatted, in a single pass.
+*
+* A replacement field is written as `{[index][:spec]}`, where the optional `index` selects
+* the argument (the fields are either all numbered or none of them) and `spec` follows the
+* `std::format` grammar: `[[fill]align][sign][#][0][width][.precision][type]`, with the
+* alignments `<`, `>` and `^`, the integer types `d`, `x`, `X`, `b`, `B`, `o` and `c`, and
+* the floating point types `e`, `E`, `f`, `F`, `g` and `G`.
+*
+* The arguments are formatted without allocating: the arithmetic types, and any type with a
+* `to_chars(char*, char*, const T&)` overload found by ADL, are written with `to_chars` into
+* small buffers on the stack, and the strings are copied as they are. Only the types that can
+* just be streamed into an `std::ostream` need a temporary string. The floating point numbers
+* without a precision are written in their shortest representation that round-trips.
+*
+* The width and the precision of a field are measured in the columns of a terminal, so the
+* text with wide or combining characters is aligned too, and it's never cut inside a character.
+*
+* A backslash escapes the next character, so `\{}` is written as `{}`.
 */
 
 export module formatter;
 
 import std;
+import utf8;
 
-template<typename T>
-std::string stringify(const T& t) {
-    std::ostringstream oss;
-    oss << t;
-    return oss.str();
+export namespace zero::fmt {
+    /// An invalid format string. For the patterns checked at compile time, it's a compile time error
+    class format_error : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+}
+
+namespace formatting::__detail {
+    using zero::fmt::format_error;
+
+    /// A run of literal text of the pattern, before a replacement field or the end of the pattern
+    struct format_literal {
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        /// The number of characters written for the run, once its escapes are removed
+        std::size_t written = 0;
+        /// Whether the run has backslash escapes, which must be removed when it's written
+        bool escaped = false;
+    };
+
+    /// The parsed format specification of a replacement field
+    struct format_spec {
+        char fill = ' ';
+        /// One of `<`, `>` or `^`, or zero for the default alignment of the argument
+        char align = 0;
+        /// One of `+` or ` `, or zero to only write the sign of the negative numbers
+        char sign = 0;
+        bool alternate = false;
+        bool zero_pad = false;
+        std::size_t width = 0;
+        /// The precision, or -1 when there isn't one
+        int precision = -1;
+        /// The presentation type, or zero for the default one
+        char type = 0;
+    };
+
+    struct replacement_field {
+        std::size_t argument = 0;
+        format_spec spec {};
+    };
+
+    /// The categories of arguments, that determine the format specifications they accept
+    enum class argument_kind : unsigned char { string, character, boolean, integer, floating, other };
+
+    template <typename T>
+    consteval argument_kind kind_of() {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            return argument_kind::string;
+        else if constexpr (std::is_same_v<T, char>)
+            return argument_kind::character;
+        else if constexpr (std::is_same_v<T, bool>)
+            return argument_kind::boolean;
+        else if constexpr (std::is_integral_v<T>)
+            return argument_kind::integer;
+        else if constexpr (std::is_floating_point_v<T>)
+            return argument_kind::floating;
+        else
+            return argument_kind::other;
+    }
+
+    template <typename... Args>
+    constexpr std::array<argument_kind, sizeof...(Args)> kinds_of {kind_of<Args>()...};
+
+    constexpr bool is_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+    constexpr bool is_align(char c) noexcept { return c == '<' || c == '>' || c == '^'; }
+
+    constexpr bool is_one_of(char c, std::string_view options) noexcept {
+        return c == 0 || options.find(c) != std::string_view::npos;
+    }
+
+    /// The biggest width or precision of a field, which keeps its padding and the buffer of a floating point number bounded
+    constexpr std::size_t max_width_or_precision = 65'535;
+
+    /**
+     * Parses the specification after the `:` of a replacement field, and checks that it's valid for
+     * an argument of the given kind
+     */
+    constexpr format_spec parse_spec(std::string_view text, argument_kind kind) {
+        format_spec spec;
+        std::size_t i = 0;
+        if (text.size() >= 2 && is_align(text[1])) {
+            spec.fill = text[0];
+            spec.align = text[1];
+            i = 2;
+        } else if (!text.empty() && is_align(text[0]))
+            spec.align = text[i++];
+        if (i < text.size() && (text[i] == '+' || text[i] == '-' || text[i] == ' '))
+            spec.sign = text[i++] == '-' ? char {0} : text[i - 1];
+        if (i < text.size() && text[i] == '#') {
+            spec.alternate = true;
+            ++i;
+        }
+        if (i < text.size() && text[i] == '0') {
+            spec.zero_pad = true;
+            ++i;
+        }
+        for (; i < text.size() && is_digit(text[i]); ++i)
+            if ((spec.width = spec.width * 10 + static_cast<std::size_t>(text[i] - '0')) > max_width_or_precision)
+                throw format_error("The width of a format specification is too big");
+        if (i < text.size() && text[i] == '.') {
+            if (++i == text.size() || !is_digit(text[i]))
+                throw format_error("Missing precision after the '.' of a format specification");
+            spec.precision = 0;
+            for (; i < text.size() && is_digit(text[i]); ++i)
+                if ((spec.precision = spec.precision * 10 + (text[i] - '0')) > static_cast<int>(max_width_or_precision))
+                    throw format_error("The precision of a format specification is too big");
+        }
+        if (i < text.size())
+            spec.type = text[i++];
+        if (i != text.size())
+            throw format_error("Invalid format specification");
+
+        bool numeric = false;
+        switch (kind) {
+            case argument_kind::integer:
+                if (!is_one_of(spec.type, "dxXbBoc"))
+                    throw format_error("Invalid presentation type for an integer");
+                numeric = spec.type != 'c';
+                break;
+            case argument_kind::character:
+                if (!is_one_of(spec.type, "cdxXbBo"))
+                    throw format_error("Invalid presentation type for a character");
+                numeric = spec.type != 0 && spec.type != 'c';
+                break;
+            case argument_kind::floating:
+                if (!is_one_of(spec.type, "eEfFgG"))
+                    throw format_error("Invalid presentation type for a floating point number");
+                if (spec.alternate)
+                    throw format_error("The alternate form is only valid for integers");
+                numeric = true;
+                break;
+            case argument_kind::string:
+            case argument_kind::boolean:
+                if (!is_one_of(spec.type, "s"))
+                    throw format_error("Invalid presentation type for a string");
+                break;
+            case argument_kind::other:
+                if (spec.type != 0)
+                    throw format_error("The argument doesn't accept a presentation type");
+                break;
+        }
+        if (spec.precision >= 0 && kind != argument_kind::floating && kind != argument_kind::string)
+            throw format_error("A precision is only valid for floating point numbers and strings");
+        if (!numeric && (spec.sign != 0 || spec.alternate || spec.zero_pad))
+            throw format_error("The sign, alternate form and zero padding are only valid for numbers");
+        return spec;
+    }
+
+    /**
+     * @return the position of the `}` that closes the replacement field opened at `pattern[open]`, or
+     * `npos` when the brace doesn't open a field: it must be followed by an optional index, and an optional
+     * `:` and a specification without braces
+     */
+    constexpr std::size_t field_end(std::string_view pattern, std::size_t open) noexcept {
+        std::size_t i = open + 1;
+        while (i < pattern.size() && is_digit(pattern[i]))
+            ++i;
+        if (i < pattern.size() && pattern[i] == '}')
+            return i;
+        if (i == pattern.size() || pattern[i] != ':')
+            return std::string_view::npos;
+        const std::size_t close = pattern.find_first_of("{}", i);
+        return close != std::string_view::npos && pattern[close] == '}' ? close : std::string_view::npos;
+    }
+
+    enum class indexing : unsigned char { none, automatic, manual };
+
+    /**
+     * Walks over `pattern`, calling `on_literal` with every run of literal text and `on_field` with every
+     * replacement field. It's shared by the patterns checked at compile time and the ones parsed at runtime
+     * @throws format_error when the fields don't match the arguments, whose kinds are `kinds`
+     */
+    template <std::size_t N, typename L, typename F>
+    constexpr void walk_pattern(std::string_view pattern, const std::array<argument_kind, N>& kinds, L&& on_literal, F&& on_field) {
+        std::array<bool, N> used {};
+        indexing mode = indexing::none;
+        std::size_t next = 0;
+        std::size_t begin = 0;
+        std::size_t escapes = 0;
+        for (std::size_t i = 0; i < pattern.size(); ++i) {
+            if (pattern[i] == '\\') {
+                ++escapes;
+                ++i; // The escaped character is part of the literal
+                continue;
+            }
+            if (pattern[i] != '{')
+                continue;
+            const std::size_t close = field_end(pattern, i);
+            if (close == std::string_view::npos)
+                continue; // An unmatched brace is a literal
+
+            on_literal(format_literal {begin, i - begin, i - begin - escapes, escapes != 0});
+
+            replacement_field field;
+            std::size_t j = i + 1;
+            for (; is_digit(pattern[j]); ++j)
+                field.argument = field.argument * 10 + static_cast<std::size_t>(pattern[j] - '0');
+            const bool numbered = j != i + 1;
+            if (mode != indexing::none && mode != (numbered ? indexing::manual : indexing::automatic))
+                throw format_error("Cannot mix automatic and manual argument indexing");
+            mode = numbered ? indexing::manual : indexing::automatic;
+            if (!numbered)
+                field.argument = next++;
+            if (field.argument >= N)
+                throw format_error(numbered ? "Argument index out of range" : "Not enough arguments provided");
+            used[field.argument] = true;
+            if (j != close)
+                field.spec = parse_spec(pattern.substr(j + 1, close - j - 1), kinds[field.argument]);
+            on_field(field);
+
+            begin = close + 1;
+            escapes = 0;
+            i = close;
+        }
+        on_literal(format_literal {begin, pattern.size() - begin, pattern.size() - begin - escapes, escapes != 0});
+        for (const bool argument_used : used)
+            if (!argument_used)
+                throw format_error("Too many arguments provided");
+    }
+
+    /// Gives access to the container of an `std::back_insert_iterator`, which is one of its protected members
+    template <typename Container>
+    struct back_insert_access : std::back_insert_iterator<Container> {
+        [[nodiscard]] static Container& container_of(std::back_insert_iterator<Container>& out) noexcept {
+            return *(out.*(&back_insert_access::container));
+        }
+    };
+
+    template <typename Out>
+    struct is_back_insert_iterator : std::false_type {};
+
+    template <typename Container>
+    struct is_back_insert_iterator<std::back_insert_iterator<Container>> : std::true_type {};
+
+    /// Writes `text` into `out`, with a bulk copy for the pointers and the containers that can `append` a range of chars
+    template <typename Out>
+    Out write_text(Out out, std::string_view text) {
+        if constexpr (std::is_pointer_v<Out>)
+            return std::copy(text.begin(), text.end(), out);
+        else if constexpr (is_back_insert_iterator<Out>::value) {
+            auto& container = back_insert_access<typename Out::container_type>::container_of(out);
+            if constexpr (requires { container.append(text.data(), text.size()); })
+                container.append(text.data(), text.size());
+            else
+                container.insert(container.end(), text.begin(), text.end());
+            return out;
+        } else {
+            for (const char c : text) {
+                *out = c;
+                ++out;
+            }
+            return out;
+        }
+    }
+
+    /// Emits `text` in runs, dropping the backslashes that escape the next character
+    template <typename Emit>
+    void emit_unescaped(Emit& emit, std::string_view text) {
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            if (text[i] == '\\') {
+                emit(text.substr(begin, i - begin));
+                begin = ++i; // The escaped character starts the next run
+            }
+        }
+        emit(text.substr(std::min(begin, text.size())));
+    }
+
+    /// Emits `count` copies of `fill`
+    template <typename Emit>
+    void emit_fill(Emit& emit, char fill, std::size_t count) {
+        std::array<char, 32> chunk;
+        chunk.fill(fill);
+        while (count > 0) {
+            const std::size_t size = std::min(count, chunk.size());
+            emit(std::string_view {chunk.data(), size});
+            count -= size;
+        }
+    }
+
+    /// Enough for any integer in binary with its prefix, the shortest representation of any floating point number, or a quantity with its units
+    constexpr std::size_t inline_text_size = 160;
+
+    /// The storage of a formatted argument: an inline buffer, and a string for the rare texts that don't fit in it
+    struct text_buffer {
+        std::array<char, inline_text_size> chars;
+        std::string overflow {};
+    };
+
+    /// A formatted argument, before it's padded to the width of its field
+    struct formatted_argument {
+        std::string_view text;
+        /// The size of the sign and base prefix of a number, where its zero padding goes, or `npos` when it can't be padded with zeros
+        std::size_t prefix = std::string_view::npos;
+        /// The alignment when the field doesn't have one: the numbers are aligned to the right and everything else to the left
+        char align = '<';
+    };
+
+    template <typename T>
+    concept StdCharsConvertible = requires (char* first, const T& value) {
+        { std::to_chars(first, first, value) } -> std::same_as<std::to_chars_result>;
+    };
+
+    template <typename T>
+    concept CharsConvertible = requires (char* first, const T& value) {
+        { to_chars(first, first, value) } -> std::same_as<std::to_chars_result>;
+    };
+
+    constexpr void to_upper(char* first, char* last) noexcept {
+        for (; first != last; ++first)
+            if (*first >= 'a' && *first <= 'z')
+                *first = static_cast<char>(*first - 'a' + 'A');
+    }
+
+    template <std::integral T>
+    formatted_argument format_integer(T value, const format_spec& spec, text_buffer& buffer) {
+        using U = std::make_unsigned_t<T>;
+        char* const first = buffer.chars.data();
+        char* out = first;
+
+        U magnitude = static_cast<U>(value);
+        if constexpr (std::is_signed_v<T>) {
+            if (value < 0) {
+                magnitude = static_cast<U>(U {0} - magnitude);
+                *out++ = '-';
+            } else if (spec.sign != 0)
+                *out++ = spec.sign;
+        } else if (spec.sign != 0)
+            *out++ = spec.sign;
+
+        int base = 10;
+        switch (spec.type) {
+            case 'x': case 'X': base = 16; break;
+            case 'b': case 'B': base = 2; break;
+            case 'o': base = 8; break;
+            default: break;
+        }
+        if (spec.alternate && base != 10 && (base != 8 || magnitude != 0)) {
+            *out++ = '0';
+            if (base != 8)
+                *out++ = spec.type;
+        }
+
+        const auto prefix = static_cast<std::size_t>(out - first);
+        const auto result = std::to_chars(out, first + buffer.chars.size(), magnitude, base);
+        if (spec.type == 'X')
+            to_upper(out, result.ptr);
+        return {std::string_view {first, result.ptr}, prefix, '>'};
+    }
+
+    template <std::floating_point F>
+    formatted_argument format_floating(F value, const format_spec& spec, text_buffer& buffer) {
+        const int precision = spec.precision >= 0 || spec.type == 0 ? spec.precision : 6;
+        const auto write = [&](char* first, char* last) {
+            switch (spec.type) {
+                case 'e': case 'E': return std::to_chars(first, last, value, std::chars_format::scientific, precision);
+                case 'f': case 'F': return std::to_chars(first, last, value, std::chars_format::fixed, precision);
+                case 'g': case 'G': return std::to_chars(first, last, value, std::chars_format::general, precision);
+                default: return precision < 0
+                    ? std::to_chars(first, last, value) // The shortest representation that round-trips
+                    : std::to_chars(first, last, value, std::chars_format::general, precision);
+            }
+        };
+
+        const bool signed_explicitly = spec.sign != 0 && !std::signbit(value);
+        char* first = buffer.chars.data();
+        if (signed_explicitly)
+            first[0] = spec.sign;
+        auto result = write(first + signed_explicitly, first + buffer.chars.size());
+        if (result.ec == std::errc::value_too_large) { // A huge number in fixed notation, or a huge precision
+            buffer.overflow.resize(static_cast<std::size_t>(std::numeric_limits<F>::max_exponent10 + std::max(precision, 0)) + 8);
+            first = buffer.overflow.data();
+            if (signed_explicitly)
+                first[0] = spec.sign;
+            result = write(first + signed_explicitly, first + buffer.overflow.size());
+        }
+        if (spec.type == 'E' || spec.type == 'F' || spec.type == 'G')
+            to_upper(first, result.ptr);
+
+        const bool has_sign = signed_explicitly || std::signbit(value);
+        return {
+            std::string_view {first, result.ptr},
+            std::isfinite(value) ? static_cast<std::size_t>(has_sign) : std::string_view::npos,
+            '>'
+        };
+    }
+
+    /// Formats a single argument following its format specification, without its padding
+    template <typename T>
+    formatted_argument format_argument(const T& value, const format_spec& spec, text_buffer& buffer) {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            const std::string_view text {value};
+            return {spec.precision >= 0 ? zero::utf8::truncate_to_width(text, static_cast<std::size_t>(spec.precision)) : text};
+        } else if constexpr (std::is_same_v<T, char>) {
+            if (spec.type != 0 && spec.type != 'c')
+                return format_integer(static_cast<int>(value), spec, buffer);
+            buffer.chars[0] = value;
+            return {std::string_view {buffer.chars.data(), 1}};
+        } else if constexpr (std::is_same_v<T, bool>)
+            return {std::string_view {value ? "true" : "false"}};
+        else if constexpr (std::is_integral_v<T>) {
+            if (spec.type != 'c')
+                return format_integer(value, spec, buffer);
+            buffer.chars[0] = static_cast<char>(value);
+            return {std::string_view {buffer.chars.data(), 1}};
+        } else if constexpr (std::is_floating_point_v<T>)
+            return format_floating(value, spec, buffer);
+        else if constexpr (StdCharsConvertible<T> || CharsConvertible<T>) {
+            using std::to_chars;
+            auto result = to_chars(buffer.chars.data(), buffer.chars.data() + buffer.chars.size(), value);
+            if (result.ec != std::errc::value_too_large)
+                return {std::string_view {buffer.chars.data(), result.ptr}};
+            for (std::size_t size = 2 * inline_text_size; result.ec == std::errc::value_too_large; size *= 2) {
+                buffer.overflow.resize(size);
+                result = to_chars(buffer.overflow.data(), buffer.overflow.data() + size, value);
+            }
+            return {std::string_view {buffer.overflow.data(), result.ptr}};
+        } else {
+            std::ostringstream oss;
+            oss << value;
+            buffer.overflow = std::move(oss).str();
+            return {std::string_view {buffer.overflow}};
+        }
+    }
+
+    /// @return the number of fill characters that `argument` needs to reach the width of its field
+    inline std::size_t padding_of(const formatted_argument& argument, const format_spec& spec) {
+        if (spec.width == 0)
+            return 0;
+        const std::size_t columns = zero::utf8::display_width(argument.text);
+        return columns >= spec.width ? 0 : spec.width - columns;
+    }
+
+    /// Emits a formatted argument with `padding` fill characters, placed as its field is aligned
+    template <typename Emit>
+    void emit_padded(Emit& emit, const formatted_argument& argument, const format_spec& spec, std::size_t padding) {
+        if (padding == 0) {
+            emit(argument.text);
+            return;
+        }
+        if (spec.zero_pad && spec.align == 0 && argument.prefix != std::string_view::npos) {
+            emit(argument.text.substr(0, argument.prefix));
+            emit_fill(emit, '0', padding);
+            emit(argument.text.substr(argument.prefix));
+            return;
+        }
+        const char align = spec.align != 0 ? spec.align : argument.align;
+        const std::size_t before = align == '>' ? padding : align == '^' ? padding / 2 : 0;
+        emit_fill(emit, spec.fill, before);
+        emit(argument.text);
+        emit_fill(emit, spec.fill, padding - before);
+    }
+
+    /// Formats `value` and emits it padded to the width of its field
+    template <typename Emit, typename T>
+    void emit_argument(Emit& emit, const T& value, const format_spec& spec) {
+        text_buffer buffer;
+        const formatted_argument argument = format_argument(value, spec, buffer);
+        emit_padded(emit, argument, spec, padding_of(argument, spec));
+    }
+
+    /// Formats the argument selected by `field`, known only at runtime, into `buffer`
+    template <typename... Args>
+    formatted_argument format_field(const replacement_field& field, text_buffer& buffer, const Args&... args) {
+        formatted_argument argument;
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((Is == field.argument ? void(argument = format_argument(args, field.spec, buffer)) : void()), ...);
+        }(std::index_sequence_for<Args...> {});
+        return argument;
+    }
+
+    /// Emits the argument selected by `field`, known only at runtime
+    template <typename Emit, typename... Args>
+    void emit_field(Emit& emit, const replacement_field& field, const Args&... args) {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((Is == field.argument ? emit_argument(emit, args, field.spec) : void()), ...);
+        }(std::index_sequence_for<Args...> {});
+    }
+
+    /// Writes into `out` until `limit` characters are written, and keeps counting the ones that don't fit
+    template <typename Out>
+    struct bounded_output {
+        Out out;
+        std::ptrdiff_t limit;
+        std::ptrdiff_t count = 0;
+
+        void operator()(std::string_view text) {
+            const auto room = std::clamp<std::ptrdiff_t>(limit - count, 0, static_cast<std::ptrdiff_t>(text.size()));
+            out = write_text(std::move(out), text.substr(0, static_cast<std::size_t>(room)));
+            count += static_cast<std::ptrdiff_t>(text.size());
+        }
+    };
 }
 
 export namespace zero::fmt {
+    /**
+     * A format string checked and split at compile time for the arguments `Args`. It's built
+     * implicitly from a string literal (or any constant expression convertible to `std::string_view`)
+     * @see format_string
+     */
+    template <typename... Args>
+    class basic_format_string {
+    public:
+        /**
+         * The maximum number of replacement fields, which are stored in the format string, so their number must be
+         * known from the arguments: one for each of them, and up to 8 more, as the numbered ones can repeat an argument
+         */
+        static constexpr std::size_t max_fields = sizeof...(Args) + 8;
 
-    template<typename... Args>
-    std::string formatter(const std::string& format, Args... args) {
-        std::deque<std::string> argStrings{ stringify(args)... };
-        std::string result;
-        bool escape_next = false;
+    private:
+        std::string_view _pattern;
+        std::array<formatting::__detail::format_literal, max_fields + 1> _literals;
+        std::array<formatting::__detail::replacement_field, max_fields> _fields;
+        std::size_t _fields_count;
+        std::size_t _literals_size;
+
+    public:
+        template <typename S>
+            requires std::is_convertible_v<const S&, std::string_view>
+        consteval basic_format_string(const S& pattern)
+            : _pattern {pattern}
+            , _literals {}
+            , _fields {}
+            , _fields_count {0}
+            , _literals_size {0}
+        {
+            std::size_t literals = 0;
+            formatting::__detail::walk_pattern(_pattern, formatting::__detail::kinds_of<Args...>,
+                [&](const formatting::__detail::format_literal& literal) {
+                    _literals[literals++] = literal;
+                    _literals_size += literal.written;
+                },
+                [&](const formatting::__detail::replacement_field& field) {
+                    if (_fields_count == max_fields)
+                        throw format_error("Too many replacement fields: a pattern can only repeat its arguments in 8 more fields");
+                    _fields[_fields_count++] = field;
+                }
+            );
+        }
+
+        /// @return the whole pattern
+        [[nodiscard]] constexpr std::string_view get() const noexcept { return _pattern; }
 
-        for (size_t i = 0; i < format.size(); ++i) {
-            if (format[i] == '\\' && !escape_next) {
-                escape_next = true;
-            } else if (format[i] == '{' && i + 1 < format.size() && format[i + 1] == '}' && !escape_next) {
-                if (argStrings.empty())
-                    throw std::runtime_error("Not enough arguments provided");
+        /// @return the number of replacement fields
+        [[nodiscard]] constexpr std::size_t fields() const noexcept { return _fields_count; }
+
+        /// @return the index of the argument written into the replacement field `index`
+        [[nodiscard]] constexpr std::size_t argument(std::size_t index) const noexcept { return _fields[index].argument; }
+
+        /// @return the literal text placed before the replacement field `index`, or after the last one
+        [[nodiscard]] constexpr std::string_view literal(std::size_t index) const noexcept {
+            return _pattern.substr(_literals[index].offset, _literals[index].size);
+        }
 
-                result += argStrings.front();
-                argStrings.pop_front();
-                ++i;  // Skip the next character ('}')
-            } else if (format[i] == '{' && escape_next) {
-                result += '{';
-                escape_next = false;
-            } else {
-                result += format[i];
-                escape_next = false;
+        /// @return the number of characters written for all the literals of the pattern
+        [[nodiscard]] constexpr std::size_t literals_size() const noexcept { return _literals_size; }
+
+        /**
+         * Formats the arguments, passing the formatted text to `emit` as a sequence of `std::string_view`,
+         * which is how every output of the formatter is written
+         */
+        template <typename Emit>
+        void format(Emit&& emit, const Args&... args) const {
+            for (std::size_t field = 0; field <= _fields_count; ++field) {
+                emit_literal(emit, field);
+                if (field != _fields_count)
+                    formatting::__detail::emit_field(emit, _fields[field], args...);
+            }
+        }
+
+        /**
+         * Formats the arguments like {@link format}, but all of them before emitting anything, so `reserve`
+         * is called first with the exact size of the formatted text
+         */
+        template <typename Reserve, typename Emit>
+        void format_reserved(Reserve&& reserve, Emit&& emit, const Args&... args) const {
+            // Most patterns don't repeat their arguments, and they only need the buffers of their arguments
+            if (_fields_count <= sizeof...(Args))
+                format_reserved_in<sizeof...(Args)>(reserve, emit, args...);
+            else
+                format_reserved_in<max_fields>(reserve, emit, args...);
+        }
+
+    private:
+        /// Formats every field into its own buffer from `Fields` of them, reserves the exact size and emits them
+        template <std::size_t Fields, typename Reserve, typename Emit>
+        void format_reserved_in(Reserve& reserve, Emit& emit, const Args&... args) const {
+            std::array<formatting::__detail::text_buffer, Fields> buffers;
+            std::array<formatting::__detail::formatted_argument, Fields> texts;
+            std::array<std::size_t, Fields> paddings {};
+            std::size_t size = _literals_size;
+            for (std::size_t field = 0; field < _fields_count; ++field) {
+                texts[field] = formatting::__detail::format_field(_fields[field], buffers[field], args...);
+                paddings[field] = formatting::__detail::padding_of(texts[field], _fields[field].spec);
+                size += texts[field].text.size() + paddings[field];
+            }
+            reserve(size);
+            for (std::size_t field = 0; field <= _fields_count; ++field) {
+                emit_literal(emit, field);
+                if (field != _fields_count)
+                    formatting::__detail::emit_padded(emit, texts[field], _fields[field].spec, paddings[field]);
             }
         }
 
-        if (!argStrings.empty())
-            throw std::runtime_error("Too many arguments provided");
+        template <typename Emit>
+        void emit_literal(Emit& emit, std::size_t index) const {
+            if (_literals[index].escaped)
+                formatting::__detail::emit_unescaped(emit, literal(index));
+            else if (_literals[index].size != 0)
+                emit(literal(index));
+        }
+    };
+
+    /// The type of the format string of the arguments `Args`, which prevents their deduction from the pattern
+    template <typename... Args>
+    using format_string = basic_format_string<std::type_identity_t<Args>...>;
+
+    /// A pattern only known at runtime, which is parsed and checked on every call
+    struct runtime_format_string {
+        std::string_view pattern;
+
+        /**
+         * Formats the arguments, passing the formatted text to `emit` as a sequence of `std::string_view`
+         * @throws format_error when the pattern is invalid or doesn't match the arguments
+         */
+        template <typename Emit, typename... Args>
+        void format(Emit&& emit, const Args&... args) const {
+            formatting::__detail::walk_pattern(pattern, formatting::__detail::kinds_of<Args...>,
+                [&](const formatting::__detail::format_literal& literal) {
+                    const std::string_view text = pattern.substr(literal.offset, literal.size);
+                    if (literal.escaped)
+                        formatting::__detail::emit_unescaped(emit, text);
+                    else
+                        emit(text);
+                },
+                [&](const formatting::__detail::replacement_field& field) {
+                    formatting::__detail::emit_field(emit, field, args...);
+                }
+            );
+        }
+    };
+
+    /// Wraps a pattern that isn't a constant expression, so it can be passed to the {@link formatter}
+    [[nodiscard]] constexpr runtime_format_string runtime_format(std::string_view pattern) noexcept {
+        return {pattern};
+    }
+
+    /// The result of {@link format_to_n}
+    template <typename Out>
+    struct format_to_n_result {
+        /// The iterator past the last written character
+        Out out;
+        /// The size of the whole formatted text, that can be bigger than the number of written characters
+        std::ptrdiff_t size;
+    };
 
+    /**
+     * @return the exact number of characters of the formatted text, so the callers can size their buffers
+     * before calling {@link format_to}. Nothing is allocated to measure the arithmetic arguments
+     */
+    template <typename... Args>
+    [[nodiscard]] std::size_t formatted_size(format_string<Args...> format, const Args&... args) {
+        std::size_t size = 0;
+        format.format([&](std::string_view text) { size += text.size(); }, args...);
+        return size;
+    }
+
+    /**
+     * Writes the formatted text into the output iterator `out`: a pointer into a buffer, an
+     * `std::back_insert_iterator` (whose container is appended in bulk), a
+     * `zero::iterator::legacy::output_iter` or any other iterator that a `char` can be assigned through
+     * @return the iterator past the last written character
+     */
+    template <typename Out, typename... Args>
+    Out format_to(Out out, format_string<Args...> format, const Args&... args) {
+        format.format([&](std::string_view text) { out = formatting::__detail::write_text(std::move(out), text); }, args...);
+        return out;
+    }
+
+    /**
+     * Writes the formatted text of a pattern only known at runtime into `out`
+     * @throws format_error when the pattern is invalid or doesn't match the arguments
+     */
+    template <typename Out, typename... Args>
+    Out format_to(Out out, runtime_format_string format, const Args&... args) {
+        format.format([&](std::string_view text) { out = formatting::__detail::write_text(std::move(out), text); }, args...);
+        return out;
+    }
+
+    /**
+     * Writes at most `n` characters of the formatted text into `out`
+     * @return the iterator past the last written character, and the size of the whole formatted text
+     */
+    template <typename Out, typename... Args>
+    format_to_n_result<Out> format_to_n(Out out, std::ptrdiff_t n, format_string<Args...> format, const Args&... args) {
+        formatting::__detail::bounded_output<Out> bounded {std::move(out), std::max<std::ptrdiff_t>(n, 0)};
+        format.format(bounded, args...);
+        return {std::move(bounded.out), bounded.count};
+    }
+
+    /**
+     * Formats the arguments into the replacement fields of a pattern checked at compile time
+     * @return the formatted string
+     */
+    template<typename... Args>
+    [[nodiscard]] std::string formatter(format_string<Args...> format, const Args&... args) {
+        std::string result;
+        format.format_reserved(
+            [&](std::size_t size) { result.reserve(size); },
+            [&](std::string_view text) { result += text; },
+            args...
+        );
+        return result;
+    }
+
+    /**
+     * Formats the arguments into the replacement fields of a pattern only known at runtime
+     * @throws format_error, a `std::runtime_error`, when the pattern is invalid or doesn't match the arguments
+     */
+    template<typename... Args>
+    [[nodiscard]] std::string formatter(runtime_format_string format, const Args&... args) {
+        std::string result;
+        result.reserve(format.pattern.size() + 16 * sizeof...(Args));
+        format.format([&](std::string_view text) { result += text; }, args...);
         return result;
     }
 }
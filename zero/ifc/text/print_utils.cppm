@@ -1,21 +1,244 @@
+/**
+* Provides functions to print formatted text
+*
+* The text is formatted straight into the buffer of a {@link Writer}, which writes it to its file
+* descriptor with a single `write(2)` call once the buffer is full or when it's explicitly flushed.
+* `print` and `println` use the standard output writer of the calling thread, so every thread
+* batches its output in its own buffer and the concurrent printers never contend for a lock.
+*
+* The printed text is deferred: on a terminal, until the end of its line, and otherwise (i.e. when
+* the output is piped) until the buffer is full, it's flushed or the thread ends. The text streamed
+* into `std::cout` meanwhile isn't ordered with it, so a program that uses both should `flush`
+* before using `std::cout`.
+*/
+
+module;
+
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+#include <errno.h>
+
 export module print_utils;
+
 import formatter;
+import stylizer;
 import std;
 
+namespace printing::__detail {
+    /// @return the number of bytes written to `fd`, or a negative number on error
+    inline long write_fd(int fd, const char* data, std::size_t size) noexcept {
+#if defined(_WIN32)
+        return ::_write(fd, data, static_cast<unsigned int>(std::min<std::size_t>(size, std::numeric_limits<int>::max())));
+#else
+        return static_cast<long>(::write(fd, data, size));
+#endif
+    }
+}
 
 export namespace zero::fmt {
+    /**
+     * A buffered writer of text into a file descriptor.
+     *
+     * Every record (a formatted text, or a single {@link write}) is kept whole in the buffer: when it doesn't
+     * fit, the previous records are flushed and it's moved to the front of the buffer, so the records of
+     * the writers that share a file descriptor don't interleave unless they're bigger than the buffer.
+     *
+     * When the file descriptor is a terminal, the writer is line buffered: every record with a new line flushes it.
+     * A writer isn't thread safe, so every thread should use its own, like {@link stdout_writer}
+     */
+    class Writer {
+    public:
+        static constexpr std::size_t default_capacity = 64 * 1024;
+
+        /**
+         * @param fd the file descriptor written, the standard output by default
+         * @param capacity the size of the buffer, that's flushed when it's full
+         */
+        explicit Writer(int fd = 1, std::size_t capacity = default_capacity)
+            : _fd {fd}
+            , _capacity {std::max<std::size_t>(capacity, 1)}
+            , _buffer {std::make_unique_for_overwrite<char[]>(_capacity)}
+            , _size {0}
+            , _record {0}
+            , _line_buffered {is_terminal(fd)} {}
+
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        /// Flushes the pending text, ignoring the errors
+        ~Writer() {
+            try {
+                flush();
+            } catch (...) {}
+        }
+
+        /// Appends `text` as a single record
+        void write(std::string_view text) {
+            append(text);
+            end_record();
+        }
+
+        /// Formats the arguments straight into the buffer
+        template <typename... Args>
+        void print(format_string<Args...> format, const Args&... args) {
+            format.format([this](std::string_view text) { append(text); }, args...);
+            end_record();
+        }
+
+        /// Formats the arguments straight into the buffer, followed by a new line
+        template <typename... Args>
+        void println(format_string<Args...> format, const Args&... args) {
+            format.format([this](std::string_view text) { append(text); }, args...);
+            end_line();
+        }
+
+        /**
+         * @throws format_error when the pattern doesn't match the arguments. The part of the record
+         * already formatted is discarded, unless it was bigger than the buffer and it's already written
+         */
+        template <typename... Args>
+        void print(runtime_format_string format, const Args&... args) {
+            format_record(format, args...);
+            end_record();
+        }
+
+        /// @throws format_error when the pattern doesn't match the arguments, discarding the record like {@link print}
+        template <typename... Args>
+        void println(runtime_format_string format, const Args&... args) {
+            format_record(format, args...);
+            end_line();
+        }
+
+        /**
+         * Writes all the pending text to the file descriptor. When it's the standard output, `std::cout` is
+         * flushed first, so the text already streamed into it is written before. The text streamed into it
+         * later isn't ordered with the text that this writer still keeps
+         * @throws std::system_error when the file descriptor can't be written
+         */
+        void flush() {
+            write_all(_buffer.get(), _size);
+            _size = 0;
+            _record = 0;
+        }
+
+        [[nodiscard]] int fd() const noexcept { return _fd; }
+        [[nodiscard]] std::size_t capacity() const noexcept { return _capacity; }
+        /// @return the number of characters waiting in the buffer
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+        /// @return whether every new line is flushed, which is the default for the terminals
+        [[nodiscard]] bool line_buffered() const noexcept { return _line_buffered; }
+        void line_buffered(bool enabled) noexcept { _line_buffered = enabled; }
+
+    private:
+        int _fd;
+        std::size_t _capacity;
+        std::unique_ptr<char[]> _buffer;
+        std::size_t _size;
+        /// Where the record being written starts
+        std::size_t _record;
+        bool _line_buffered;
+
+        void append(std::string_view text) {
+            if (text.size() > _capacity - _size) {
+                // Flushes the complete records, and moves the one being written to the front
+                write_all(_buffer.get(), _record);
+                std::copy(_buffer.get() + _record, _buffer.get() + _size, _buffer.get());
+                _size -= _record;
+                _record = 0;
+                if (text.size() > _capacity - _size) { // A record bigger than the whole buffer is written as it comes
+                    write_all(_buffer.get(), _size);
+                    write_all(text.data(), text.size());
+                    _size = 0;
+                    return;
+                }
+            }
+            std::copy(text.begin(), text.end(), _buffer.get() + _size);
+            _size += text.size();
+        }
+
+        /// Formats a record at runtime, dropping what was appended of it when the formatting throws
+        template <typename... Args>
+        void format_record(runtime_format_string format, const Args&... args) {
+            try {
+                format.format([this](std::string_view text) { append(text); }, args...);
+            } catch (...) {
+                _size = _record;
+                throw;
+            }
+        }
+
+        /// Ends the record being written, and flushes the writer when it's line buffered and the record has a new line
+        void end_record() {
+            const bool new_line = _line_buffered
+                && std::string_view {_buffer.get() + _record, _size - _record}.find('\n') != std::string_view::npos;
+            _record = _size;
+            if (new_line)
+                flush();
+        }
+
+        void end_line() {
+            append("\n");
+            _record = _size;
+            if (_line_buffered)
+                flush();
+        }
+
+        void write_all(const char* data, std::size_t size) {
+            if (size == 0)
+                return;
+            if (_fd == 1)
+                std::cout.flush();
+            while (size > 0) {
+                const long written = printing::__detail::write_fd(_fd, data, size);
+                if (written < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    throw std::system_error(errno, std::generic_category(), "Writer: can't write to the file descriptor");
+                }
+                data += written;
+                size -= static_cast<std::size_t>(written);
+            }
+        }
+    };
+
+    /**
+     * @return the standard output writer of the calling thread, which is flushed when the thread ends.
+     * Every thread has its own buffer, so printing never takes a lock
+     */
+    [[nodiscard]] Writer& stdout_writer() {
+        thread_local Writer writer {1};
+        return writer;
+    }
 
     template<typename... Args>
-    constexpr void print(const std::string& format, Args... args) {
-        std::cout << formatter(format, args...);
+    void print(format_string<Args...> format, const Args&... args) {
+        stdout_writer().print(format, args...);
     }
 
     template<typename... Args>
-    constexpr void println(const std::string& format, Args... args) {
-        print(format + "\n", args...);
+    void println(format_string<Args...> format, const Args&... args) {
+        stdout_writer().println(format, args...);
+    }
+
+    template<typename... Args>
+    void print(runtime_format_string format, const Args&... args) {
+        stdout_writer().print(format, args...);
+    }
+
+    template<typename... Args>
+    void println(runtime_format_string format, const Args&... args) {
+        stdout_writer().println(format, args...);
     }
 
     void newln() {
-        std::cout << "\n";
+        stdout_writer().println("");
+    }
+
+    /// Writes the pending text of the standard output writer of the calling thread
+    void flush() {
+        stdout_writer().flush();
     }
 }
@@ -12,22 +12,459 @@ concept SplittableString =
     std::is_same_v<std::string, std::remove_reference_t<T>> ||
     std::is_same_v<std::string_view, std::remove_reference_t<T>>;
 
+namespace str_manip::__detail {
+    /*
+     * The searches scan the text a 64 bits word at a time (SWAR, SIMD within a register): a word is
+     * compared with a byte broadcast to all its lanes, and the lanes that are equal are found at once
+     */
+
+    constexpr std::uint64_t low_bits = 0x0101010101010101ull;
+    constexpr std::uint64_t low_seven_bits = 0x7F7F7F7F7F7F7F7Full;
+
+    [[nodiscard]] constexpr std::uint64_t broadcast(char c) noexcept {
+        return low_bits * static_cast<unsigned char>(c);
+    }
+
+    /// @return the 8 bytes at `p`, the first one in the least significant lane
+    [[nodiscard]] inline std::uint64_t load(const char* p) noexcept {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        if constexpr (std::endian::native == std::endian::big)
+            word = std::byteswap(word);
+        return word;
+    }
+
+    /// @return the highest bit of every lane of `word` that's zero set, and every other bit clear
+    [[nodiscard]] constexpr std::uint64_t zero_lanes(std::uint64_t word) noexcept {
+        return ~(((word & low_seven_bits) + low_seven_bits) | word | low_seven_bits);
+    }
+
+    [[nodiscard]] constexpr std::size_t first_lane(std::uint64_t mask) noexcept {
+        return static_cast<std::size_t>(std::countr_zero(mask)) / 8;
+    }
+
+    [[nodiscard]] constexpr std::size_t last_lane(std::uint64_t mask) noexcept {
+        return static_cast<std::size_t>(63 - std::countl_zero(mask)) / 8;
+    }
+
+    /// @return whether the needle starts at `p`, once its first and last characters are known to match
+    [[nodiscard]] inline bool matches_inner(const char* p, std::string_view needle) noexcept {
+        return needle.size() <= 2 || std::memcmp(p + 1, needle.data() + 1, needle.size() - 2) == 0;
+    }
+
+    /**
+     * @return the lanes of the 8 positions starting at `p` where the first and the last characters of
+     * the needle match (a packed pair filter), that are only a few candidates to be compared completely
+     */
+    [[nodiscard]] inline std::uint64_t candidates(const char* p, std::size_t needle_size, std::uint64_t first, std::uint64_t last) noexcept {
+        return zero_lanes(load(p) ^ first) & zero_lanes(load(p + needle_size - 1) ^ last);
+    }
+
+    /// A text read backwards when `Reverse` is set, so the same search finds the last occurrence of a needle
+    template <bool Reverse>
+    struct directed_view {
+        std::string_view text;
+
+        [[nodiscard]] constexpr std::ptrdiff_t size() const noexcept { return static_cast<std::ptrdiff_t>(text.size()); }
+
+        [[nodiscard]] constexpr unsigned char operator[](std::ptrdiff_t i) const noexcept {
+            return static_cast<unsigned char>(text[static_cast<std::size_t>(Reverse ? size() - 1 - i : i)]);
+        }
+    };
+
+    /// @return the start (minus one) of the maximal suffix of `needle` in the lexicographic order, or its inverse when `Inverse` is set, and its period
+    template <bool Inverse, bool Reverse>
+    [[nodiscard]] constexpr std::pair<std::ptrdiff_t, std::ptrdiff_t> maximal_suffix(directed_view<Reverse> needle) noexcept {
+        std::ptrdiff_t suffix = -1;
+        std::ptrdiff_t period = 1;
+        std::ptrdiff_t j = 0;
+        std::ptrdiff_t k = 1;
+        while (j + k < needle.size()) {
+            const unsigned char a = needle[j + k];
+            const unsigned char b = needle[suffix + k];
+            if (Inverse ? a > b : a < b) {
+                j += k;
+                k = 1;
+                period = j - suffix;
+            } else if (a == b) {
+                if (k != period)
+                    ++k;
+                else {
+                    j += period;
+                    k = 1;
+                }
+            } else {
+                suffix = j++;
+                k = period = 1;
+            }
+        }
+        return {suffix, period};
+    }
+
+    /**
+     * The two-way string matching algorithm (Crochemore and Perrin), linear in the size of the text
+     * and the needle for any of them, using constant space. The needle is split in its critical
+     * factorization, and the right part is compared first, so the text never goes back more than the
+     * period of the needle. @return the first position at or after `from` where the needle starts, or `npos`
+     */
+    template <bool Reverse>
+    [[nodiscard]] constexpr std::size_t two_way(directed_view<Reverse> text, directed_view<Reverse> needle, std::size_t from) noexcept {
+        const std::ptrdiff_t m = needle.size();
+        const auto [suffix, period] = maximal_suffix<false>(needle);
+        const auto [inverse_suffix, inverse_period] = maximal_suffix<true>(needle);
+        const std::ptrdiff_t critical = std::max(suffix, inverse_suffix);
+        std::ptrdiff_t shift = suffix > inverse_suffix ? period : inverse_period;
+
+        bool periodic = true;
+        for (std::ptrdiff_t i = 0; i <= critical && periodic; ++i)
+            periodic = needle[i] == needle[i + shift];
+
+        std::ptrdiff_t memory = -1; // The prefix of the needle known to match after a shift by the period
+        if (!periodic)
+            shift = std::max(critical + 1, m - critical - 1) + 1;
+        for (auto j = static_cast<std::ptrdiff_t>(from); j <= text.size() - m;) {
+            std::ptrdiff_t i = std::max(critical, memory) + 1;
+            while (i < m && needle[i] == text[i + j])
+                ++i;
+            if (i < m) {
+                j += i - critical;
+                memory = -1;
+                continue;
+            }
+            i = critical;
+            while (i > memory && needle[i] == text[i + j])
+                --i;
+            if (i <= memory)
+                return static_cast<std::size_t>(j);
+            j += shift;
+            if (periodic)
+                memory = m - shift - 1;
+        }
+        return std::string_view::npos;
+    }
+
+    /**
+     * The bytes compared for the false candidates of a search, per byte of the text already scanned, above
+     * which it switches to {@link two_way}, as the needle and the text are periodic enough for the filter to
+     * stop working, i.e. a needle of many equal characters in a text of them
+     */
+    constexpr std::size_t max_compared_per_byte = 16;
+
+    [[nodiscard]] inline std::size_t find(std::string_view haystack, std::string_view needle, std::size_t from) noexcept {
+        if (needle.size() > haystack.size() || from > haystack.size() - needle.size())
+            return std::string_view::npos;
+        if (needle.empty())
+            return from;
+        const char* const data = haystack.data();
+        if (needle.size() == 1) {
+            const void* found = std::memchr(data + from, needle.front(), haystack.size() - from);
+            return found == nullptr ? std::string_view::npos : static_cast<std::size_t>(static_cast<const char*>(found) - data);
+        }
+
+        const std::size_t starts = haystack.size() - needle.size() + 1; // The positions where the needle can start
+        const std::uint64_t first = broadcast(needle.front());
+        const std::uint64_t last = broadcast(needle.back());
+        std::size_t compared = 0;
+        std::size_t i = from;
+        for (; i + 8 <= starts; i += 8)
+            for (std::uint64_t mask = candidates(data + i, needle.size(), first, last); mask != 0; mask &= mask - 1) {
+                const std::size_t position = i + first_lane(mask);
+                if (matches_inner(data + position, needle))
+                    return position;
+                compared += needle.size();
+                if (compared > max_compared_per_byte * (position - from + needle.size()))
+                    return two_way(directed_view<false> {haystack}, directed_view<false> {needle}, position + 1);
+            }
+        for (; i < starts; ++i)
+            if (data[i] == needle.front() && data[i + needle.size() - 1] == needle.back() && matches_inner(data + i, needle))
+                return i;
+        return std::string_view::npos;
+    }
+
+    [[nodiscard]] inline std::size_t rfind(std::string_view haystack, std::string_view needle, std::size_t from) noexcept {
+        if (needle.size() > haystack.size())
+            return std::string_view::npos;
+        const std::size_t starts = std::min(from, haystack.size() - needle.size()) + 1;
+        if (needle.empty())
+            return starts - 1;
+
+        const char* const data = haystack.data();
+        const std::uint64_t first = broadcast(needle.front());
+        const std::uint64_t last = broadcast(needle.back());
+        std::size_t compared = 0;
+        std::size_t end = starts;
+        for (; end >= 8; end -= 8) {
+            const std::size_t base = end - 8;
+            for (std::uint64_t mask = candidates(data + base, needle.size(), first, last); mask != 0;) {
+                const std::size_t lane = last_lane(mask);
+                const std::size_t position = base + lane;
+                if (matches_inner(data + position, needle))
+                    return position;
+                mask &= ~(std::uint64_t {0x80} << (8 * lane));
+                compared += needle.size();
+                if (compared > max_compared_per_byte * (starts - position + needle.size())) {
+                    // The text before `position`, and the needle, read backwards
+                    const std::string_view rest = haystack.substr(0, position - 1 + needle.size());
+                    const std::size_t found = two_way(directed_view<true> {rest}, directed_view<true> {needle}, 0);
+                    return found == std::string_view::npos ? found : position - 1 - found;
+                }
+            }
+        }
+        while (end-- > 0)
+            if (data[end] == needle.front() && data[end + needle.size() - 1] == needle.back() && matches_inner(data + end, needle))
+                return end;
+        return std::string_view::npos;
+    }
+
+    [[nodiscard]] inline std::size_t count(std::string_view haystack, char c) noexcept {
+        const char* const data = haystack.data();
+        const std::uint64_t pattern = broadcast(c);
+        std::size_t total = 0;
+        std::size_t i = 0;
+        for (; i + 8 <= haystack.size(); i += 8)
+            total += static_cast<std::size_t>(std::popcount(zero_lanes(load(data + i) ^ pattern)));
+        for (; i < haystack.size(); ++i)
+            total += data[i] == c;
+        return total;
+    }
+
+    /// The sets of characters small enough to be compared a word at a time, instead of looked up in a table
+    constexpr std::size_t max_broadcast_set = 4;
+
+    [[nodiscard]] inline std::size_t find_first_of_small(std::string_view haystack, std::string_view set, std::size_t from) noexcept {
+        std::array<std::uint64_t, max_broadcast_set> patterns {};
+        for (std::size_t c = 0; c < set.size(); ++c)
+            patterns[c] = broadcast(set[c]);
+
+        const char* const data = haystack.data();
+        std::size_t i = from;
+        for (; i + 8 <= haystack.size(); i += 8) {
+            const std::uint64_t word = load(data + i);
+            std::uint64_t mask = 0;
+            for (std::size_t c = 0; c < set.size(); ++c)
+                mask |= zero_lanes(word ^ patterns[c]);
+            if (mask != 0)
+                return i + first_lane(mask);
+        }
+        for (; i < haystack.size(); ++i)
+            if (set.find(data[i]) != std::string_view::npos)
+                return i;
+        return std::string_view::npos;
+    }
+
+    /// Every character, so a single character delimiter can be viewed without dangling
+    constexpr auto single_chars = [] {
+        std::array<char, 256> chars {};
+        for (std::size_t c = 0; c < chars.size(); ++c)
+            chars[c] = static_cast<char>(c);
+        return chars;
+    }();
+}
+
 export namespace zero {
+    /**
+     * A set of characters, stored as a table with an entry for every byte, so checking whether a
+     * character belongs to it is a single lookup. It can be built at compile time
+     */
+    class char_class {
+    public:
+        constexpr char_class() noexcept = default;
+
+        constexpr explicit char_class(std::string_view characters) noexcept {
+            for (const char c : characters)
+                _table[static_cast<unsigned char>(c)] = true;
+        }
+
+        [[nodiscard]] constexpr bool contains(char c) const noexcept { return _table[static_cast<unsigned char>(c)]; }
+
+    private:
+        std::array<bool, 256> _table {};
+    };
+
+    /**
+     * @return the position of the first occurrence of `needle` in `haystack` at or after `from`, or `npos`.
+     * The candidates are found a word at a time by their first and last characters, and then compared.
+     * When too many of them are false, it switches to the two-way algorithm, so it's linear in the worst case
+     */
+    [[nodiscard]] constexpr std::size_t find(std::string_view haystack, std::string_view needle, std::size_t from = 0) noexcept {
+        if consteval {
+            return haystack.find(needle, from);
+        } else {
+            return str_manip::__detail::find(haystack, needle, from);
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t find(std::string_view haystack, char needle, std::size_t from = 0) noexcept {
+        return find(haystack, std::string_view {&str_manip::__detail::single_chars[static_cast<unsigned char>(needle)], 1}, from);
+    }
+
+    /// @return the position of the last occurrence of `needle` in `haystack` that starts at or before `from`, or `npos`
+    [[nodiscard]] constexpr std::size_t rfind(std::string_view haystack, std::string_view needle, std::size_t from = std::string_view::npos) noexcept {
+        if consteval {
+            return haystack.rfind(needle, from);
+        } else {
+            return str_manip::__detail::rfind(haystack, needle, from);
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t rfind(std::string_view haystack, char needle, std::size_t from = std::string_view::npos) noexcept {
+        return rfind(haystack, std::string_view {&str_manip::__detail::single_chars[static_cast<unsigned char>(needle)], 1}, from);
+    }
+
+    [[nodiscard]] constexpr bool contains(std::string_view haystack, std::string_view needle) noexcept {
+        return find(haystack, needle) != std::string_view::npos;
+    }
+
+    [[nodiscard]] constexpr bool contains(std::string_view haystack, char needle) noexcept {
+        return find(haystack, needle) != std::string_view::npos;
+    }
+
+    /// @return the position of the first character of `haystack` at or after `from` that belongs to `set`, or `npos`
+    [[nodiscard]] constexpr std::size_t find_first_of(std::string_view haystack, const char_class& set, std::size_t from = 0) noexcept {
+        const std::size_t size = haystack.size();
+        std::size_t i = from;
+        for (; i + 4 <= size; i += 4) // Four independent lookups at a time
+            if (set.contains(haystack[i]) | set.contains(haystack[i + 1]) | set.contains(haystack[i + 2]) | set.contains(haystack[i + 3]))
+                break;
+        for (; i < size; ++i)
+            if (set.contains(haystack[i]))
+                return i;
+        return std::string_view::npos;
+    }
+
+    /**
+     * @return the position of the first character of `haystack` at or after `from` that's one of `set`, or `npos`.
+     * The small sets are compared a word at a time, and the bigger ones are looked up in a {@link char_class}
+     */
+    [[nodiscard]] constexpr std::size_t find_first_of(std::string_view haystack, std::string_view set, std::size_t from = 0) noexcept {
+        if consteval {
+            return haystack.find_first_of(set, from);
+        } else {
+            if (from >= haystack.size() || set.empty())
+                return std::string_view::npos;
+            if (set.size() == 1)
+                return find(haystack, set.front(), from);
+            if (set.size() <= str_manip::__detail::max_broadcast_set)
+                return str_manip::__detail::find_first_of_small(haystack, set, from);
+            return find_first_of(haystack, char_class {set}, from);
+        }
+    }
+
+    /// @return the number of occurrences of `needle` in `haystack`
+    [[nodiscard]] constexpr std::size_t count(std::string_view haystack, char needle) noexcept {
+        if consteval {
+            return static_cast<std::size_t>(std::ranges::count(haystack, needle));
+        } else {
+            return str_manip::__detail::count(haystack, needle);
+        }
+    }
+
+    /// @return the number of non overlapping occurrences of `needle` in `haystack`, or zero for an empty needle
+    [[nodiscard]] constexpr std::size_t count(std::string_view haystack, std::string_view needle) noexcept {
+        if (needle.size() == 1)
+            return count(haystack, needle.front());
+        std::size_t total = 0;
+        if (!needle.empty())
+            for (std::size_t i = find(haystack, needle); i != std::string_view::npos; i = find(haystack, needle, i + needle.size()))
+                ++total;
+        return total;
+    }
+
+    /**
+     * A lazy view of the tokens of a text separated by a delimiter, that can have many characters,
+     * which is searched with {@link find}. The tokens are `std::string_view` slices of the original text, so nothing is copied or allocated,
+     * and the text must outlive the view. Like `std::views::split`, the consecutive delimiters yield empty
+     * tokens, a trailing delimiter yields an empty last token, and an empty text has no tokens.
+     * An empty delimiter yields the whole text as a single token
+     */
+    class split_view : public std::ranges::view_interface<split_view> {
+    public:
+        class iterator {
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr iterator() noexcept = default;
+
+            constexpr iterator(std::string_view text, std::string_view delimiter) noexcept
+                : _text {text}
+                , _delimiter {delimiter}
+                , _begin {0}
+                , _end {delimiter.empty() ? text.size() : std::min(find(text, delimiter), text.size())}
+                , _done {text.empty()} {}
+
+            [[nodiscard]] constexpr std::string_view operator*() const noexcept {
+                return _text.substr(_begin, _end - _begin);
+            }
+
+            constexpr iterator& operator++() noexcept {
+                if (_end == _text.size())
+                    _done = true;
+                else {
+                    _begin = _end + _delimiter.size();
+                    _end = std::min(find(_text, _delimiter, _begin), _text.size());
+                }
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept {
+                iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) noexcept {
+                return lhs._done == rhs._done && (lhs._done || lhs._begin == rhs._begin);
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+                return it._done;
+            }
+
+        private:
+            std::string_view _text {};
+            std::string_view _delimiter {};
+            /// The bounds of the current token
+            std::size_t _begin = 0;
+            std::size_t _end = 0;
+            bool _done = true;
+        };
+
+        constexpr split_view() noexcept = default;
+
+        constexpr split_view(std::string_view text, std::string_view delimiter) noexcept
+            : _text {text}, _delimiter {delimiter} {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept { return {_text, _delimiter}; }
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    private:
+        std::string_view _text {};
+        std::string_view _delimiter {};
+    };
+
+    /// @return a lazy view of the tokens of `text` separated by `delimiter`
+    [[nodiscard]] constexpr split_view split(std::string_view text, std::string_view delimiter) noexcept {
+        return {text, delimiter};
+    }
+
+    /// @return a lazy view of the tokens of `text` separated by the character `delimiter`
+    [[nodiscard]] constexpr split_view split(std::string_view text, char delimiter) noexcept {
+        return {text, std::string_view {&str_manip::__detail::single_chars[static_cast<unsigned char>(delimiter)], 1}};
+    }
+
+    /**
+     * @return a copy of every token of `str` separated by the whole `delimiter`
+     * @see split for the lazy version, that doesn't copy the tokens
+     */
     template <SplittableString T>
     [[nodiscard]]
     constexpr auto split_str(T&& str, const char* delimiter) -> std::vector<std::string> {
         std::vector<std::string> tokens;
-
-        std::istringstream iss;
-        if constexpr (std::is_same_v<std::remove_reference_t<T>, std::string_view>)
-            iss = std::istringstream(std::string {str});
-        else
-            iss = std::istringstream(std::forward<T>(str));
-
-        std::string token;
-        while (std::getline(iss, token, *delimiter))
-            tokens.push_back(token);
-
+        for (const std::string_view token : split(std::string_view {str}, std::string_view {delimiter}))
+            tokens.emplace_back(token);
         return tokens;
     }
 }
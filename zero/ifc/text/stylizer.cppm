@@ -1,7 +1,19 @@
 /**
 * Provides functions and enums for string styling
+*
+* The modifiers are a bitmask, and the parameters of the ANSI escape sequences of every
+* color and every combination of modifiers are precomputed at compile time, so stylizing
+* a text only appends a single escape sequence, the text and a single reset code.
 */
 
+module;
+
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
 export module stylizer;
 
 import std;
@@ -22,29 +34,165 @@ export namespace zero::fmt {
         BLACK = 16
     };
 
-    enum class Modifier {
-        BOLD = 1,
-        FAINT = 2,
-        ITALIC = 3,
-        UNDERLINE = 4,
-        BLINK = 5,
-        REVERSE = 7,
-        HIDDEN = 8
+    /// The text modifiers, flags that can be combined with `|`
+    enum class Modifier : std::uint8_t {
+        NONE = 0,
+        BOLD = 1 << 0,
+        FAINT = 1 << 1,
+        ITALIC = 1 << 2,
+        UNDERLINE = 1 << 3,
+        BLINK = 1 << 4,
+        REVERSE = 1 << 5,
+        HIDDEN = 1 << 6
     };
 
-    std::string stylize(const std::string& text, Color color, const std::vector<Modifier>& modifiers) {
-        std::string colorCode = color == Color::DEFAULT ? "" : "\033[38;5;" + std::to_string(static_cast<int>(color)) + "m";
-        std::string modifierCodes = "";
+    [[nodiscard]] constexpr Modifier operator|(Modifier lhs, Modifier rhs) noexcept {
+        return static_cast<Modifier>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+    }
+
+    [[nodiscard]] constexpr Modifier operator&(Modifier lhs, Modifier rhs) noexcept {
+        return static_cast<Modifier>(static_cast<std::uint8_t>(lhs) & static_cast<std::uint8_t>(rhs));
+    }
+
+    constexpr Modifier& operator|=(Modifier& lhs, Modifier rhs) noexcept { return lhs = lhs | rhs; }
+}
+
+namespace styling::__detail {
+    /// The parameters of a Select Graphic Rendition escape sequence, i.e. `1;4` or `38;5;196`
+    struct sgr_parameters {
+        std::array<char, 15> chars {};
+        std::size_t size = 0;
+
+        constexpr void append(std::string_view text) noexcept {
+            if (size != 0)
+                chars[size++] = ';';
+            for (const char c : text)
+                chars[size++] = c;
+        }
+
+        constexpr void append(unsigned number) noexcept {
+            std::array<char, 3> digits {};
+            std::size_t count = 0;
+            do {
+                digits[count++] = static_cast<char>('0' + number % 10);
+                number /= 10;
+            } while (number != 0);
+            if (size != 0)
+                chars[size++] = ';';
+            while (count != 0)
+                chars[size++] = digits[--count];
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {chars.data(), size}; }
+    };
+
+    /// The SGR codes of the modifiers, in the order of their bits
+    constexpr std::array<unsigned, 7> modifier_codes {1, 2, 3, 4, 5, 7, 8};
+
+    /// The parameters of every combination of modifiers, indexed by its bitmask
+    constexpr auto modifier_parameters = [] {
+        std::array<sgr_parameters, 1u << modifier_codes.size()> table {};
+        for (std::size_t mask = 0; mask < table.size(); ++mask)
+            for (std::size_t bit = 0; bit < modifier_codes.size(); ++bit)
+                if ((mask >> bit) & 1u)
+                    table[mask].append(modifier_codes[bit]);
+        return table;
+    }();
+
+    /// The parameters of the foreground color of every entry of the 256 colors palette, but the default one
+    constexpr auto color_parameters = [] {
+        std::array<sgr_parameters, 256> table {};
+        for (unsigned color = 1; color < table.size(); ++color) {
+            table[color].append("38;5");
+            table[color].append(color);
+        }
+        return table;
+    }();
+
+    inline bool is_terminal(int fd) noexcept {
+#if defined(_WIN32)
+        return ::_isatty(fd) != 0;
+#else
+        return ::isatty(fd) != 0;
+#endif
+    }
+
+    inline bool detect_colors(int fd) {
+        if (const char* no_color = std::getenv("NO_COLOR"); no_color != nullptr && *no_color != '\0')
+            return false;
+        if (const char* term = std::getenv("TERM"); term != nullptr && std::string_view {term} == "dumb")
+            return false;
+        return is_terminal(fd);
+    }
+}
+
+export namespace zero::fmt {
+    /// @return whether the file descriptor `fd` is a terminal
+    [[nodiscard]] bool is_terminal(int fd) noexcept {
+        return styling::__detail::is_terminal(fd);
+    }
 
-        for (const auto& modifier : modifiers) {
-            modifierCodes += "\033[" + std::to_string(static_cast<int>(modifier)) + "m";
+    /**
+     * @return whether the text written to `fd` should be stylized: it must be a terminal, and neither the
+     * `NO_COLOR` environment variable can be set (see https://no-color.org) nor `TERM` be `dumb`. The answer
+     * for the standard output and error is computed once
+     */
+    [[nodiscard]] bool colors_enabled(int fd = 1) {
+        if (fd == 1) {
+            static const bool enabled = styling::__detail::detect_colors(1);
+            return enabled;
         }
+        if (fd == 2) {
+            static const bool enabled = styling::__detail::detect_colors(2);
+            return enabled;
+        }
+        return styling::__detail::detect_colors(fd);
+    }
 
-        std::string resetCodes = "";
-        for (size_t i = 0; i < modifiers.size(); ++i) {
-            resetCodes += "\033[0m";
+    /**
+     * Appends the stylized `text` to `out`: a single escape sequence with the color and all the modifiers,
+     * the text, and a single reset code. The text is appended as it is when it has no style
+     */
+    void stylize_to(std::string& out, std::string_view text, Color color, Modifier modifiers = Modifier::NONE) {
+        const auto mask = static_cast<std::size_t>(modifiers) & (styling::__detail::modifier_parameters.size() - 1);
+        const auto palette = static_cast<std::size_t>(color) & 0xFFu;
+        if (mask == 0 && palette == 0) {
+            out += text;
+            return;
         }
 
-        return modifierCodes + colorCode + text + resetCodes + "\033[0m";
+        const std::string_view modifier_codes = styling::__detail::modifier_parameters[mask].view();
+        const std::string_view color_codes = styling::__detail::color_parameters[palette].view();
+        // Only grows when it doesn't fit, and geometrically, so appending many texts stays linear
+        const std::size_t needed = out.size() + text.size() + modifier_codes.size() + color_codes.size() + 8;
+        if (needed > out.capacity())
+            out.reserve(std::max(needed, 2 * out.capacity()));
+        out += "\033[";
+        out += modifier_codes;
+        if (!modifier_codes.empty() && !color_codes.empty())
+            out += ';';
+        out += color_codes;
+        out += 'm';
+        out += text;
+        out += "\033[0m";
+    }
+
+    void stylize_to(std::string& out, std::string_view text, Color color, std::initializer_list<Modifier> modifiers) {
+        Modifier mask = Modifier::NONE;
+        for (const Modifier modifier : modifiers)
+            mask |= modifier;
+        stylize_to(out, text, color, mask);
+    }
+
+    [[nodiscard]] std::string stylize(std::string_view text, Color color, Modifier modifiers = Modifier::NONE) {
+        std::string result;
+        stylize_to(result, text, color, modifiers);
+        return result;
+    }
+
+    [[nodiscard]] std::string stylize(std::string_view text, Color color, std::initializer_list<Modifier> modifiers) {
+        std::string result;
+        stylize_to(result, text, color, modifiers);
+        return result;
     }
 }
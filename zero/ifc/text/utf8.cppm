@@ -0,0 +1,358 @@
+/**
+* Provides functions to validate, decode, encode and measure UTF-8 text
+*
+* The text is scanned a 64 bits word at a time while it's ASCII, which is checked for all the
+* bytes of a word at once, so only the code points that aren't ASCII are decoded one by one.
+* Every function can be used at compile time too, where the text is scanned a byte at a time.
+*
+* The invalid sequences are decoded as the replacement character U+FFFD, one for every maximal
+* subpart of an invalid sequence, as the Unicode standard recommends.
+*/
+
+export module utf8;
+
+import std;
+
+export namespace zero::utf8 {
+    /// The code point that replaces the invalid sequences of a text
+    constexpr char32_t replacement_character = U'\uFFFD';
+
+    /// The greatest code point
+    constexpr char32_t max_code_point = U'\U0010FFFF';
+
+    /// A code point encoded in UTF-8
+    struct encoded {
+        std::array<char, 4> bytes {};
+        std::uint8_t size = 0;
+
+        /// @return a view of the code units, which must not outlive this object
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {bytes.data(), size}; }
+    };
+
+    /// A code point decoded from a text
+    struct decoded {
+        /// The code point, or the replacement character when the sequence is invalid
+        char32_t code_point = replacement_character;
+        /// The number of code units that were decoded, at least one
+        std::uint8_t size = 1;
+        bool valid = false;
+    };
+}
+
+namespace utf8::__detail {
+    constexpr std::uint64_t high_bits = 0x8080808080808080ull;
+
+    /// @return the 8 bytes at `p`, the first one in the least significant lane
+    [[nodiscard]] inline std::uint64_t load(const char* p) noexcept {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        if constexpr (std::endian::native == std::endian::big)
+            word = std::byteswap(word);
+        return word;
+    }
+
+    /// @return the position of the first byte of `text` at or after `from` that isn't ASCII, or its size
+    [[nodiscard]] constexpr std::size_t skip_ascii(std::string_view text, std::size_t from) noexcept {
+        if !consteval {
+            const char* const data = text.data();
+            for (; from + 16 <= text.size(); from += 16)
+                if (((load(data + from) | load(data + from + 8)) & high_bits) != 0)
+                    break;
+            for (; from + 8 <= text.size(); from += 8)
+                if (const std::uint64_t mask = load(data + from) & high_bits; mask != 0)
+                    return from + static_cast<std::size_t>(std::countr_zero(mask)) / 8;
+        }
+        while (from < text.size() && static_cast<unsigned char>(text[from]) < 0x80)
+            ++from;
+        return from;
+    }
+
+    /// How a sequence that starts with a given byte goes on: its size, and the valid range of its second byte
+    struct lead_byte {
+        std::uint8_t size = 0;
+        unsigned char second_min = 0x80;
+        unsigned char second_max = 0xBF;
+    };
+
+    /// The well-formed sequences of the table 3-7 of the Unicode standard, indexed by their first byte. A size of zero is an invalid first byte
+    constexpr auto lead_bytes = [] {
+        std::array<lead_byte, 256> table {};
+        for (std::size_t byte = 0; byte < 0x80; ++byte)
+            table[byte].size = 1;
+        for (std::size_t byte = 0xC2; byte <= 0xDF; ++byte)
+            table[byte].size = 2;
+        for (std::size_t byte = 0xE0; byte <= 0xEF; ++byte)
+            table[byte].size = 3;
+        for (std::size_t byte = 0xF0; byte <= 0xF4; ++byte)
+            table[byte].size = 4;
+        table[0xE0].second_min = 0xA0; // Overlong
+        table[0xED].second_max = 0x9F; // Surrogates
+        table[0xF0].second_min = 0x90; // Overlong
+        table[0xF4].second_max = 0x8F; // Above U+10FFFF
+        return table;
+    }();
+
+    [[nodiscard]] constexpr bool is_continuation(unsigned char byte) noexcept { return (byte & 0xC0) == 0x80; }
+
+    /// @return the code point that starts at `at`, which must be a position of `text`
+    [[nodiscard]] constexpr zero::utf8::decoded decode(std::string_view text, std::size_t at) noexcept {
+        const auto first = static_cast<unsigned char>(text[at]);
+        const lead_byte lead = lead_bytes[first];
+        if (lead.size == 1)
+            return {first, 1, true};
+        if (lead.size == 0)
+            return {};
+
+        constexpr std::array<unsigned char, 5> payload_masks {0, 0, 0x1F, 0x0F, 0x07};
+        char32_t code_point = first & payload_masks[lead.size];
+        for (std::uint8_t i = 1; i < lead.size; ++i) {
+            if (at + i >= text.size())
+                return {zero::utf8::replacement_character, i, false};
+            const auto byte = static_cast<unsigned char>(text[at + i]);
+            const bool in_range = i == 1 ? byte >= lead.second_min && byte <= lead.second_max : is_continuation(byte);
+            if (!in_range)
+                return {zero::utf8::replacement_character, i, false};
+            code_point = (code_point << 6) | (byte & 0x3Fu);
+        }
+        return {code_point, lead.size, true};
+    }
+
+    /// A range of code points, both ends included
+    struct code_point_range {
+        char32_t first;
+        char32_t last;
+    };
+
+    /// The combining marks and the format characters, that don't take a column of their own
+    constexpr auto zero_width_ranges = std::to_array<code_point_range>({
+        {0x0300, 0x036F}, {0x0483, 0x0489}, {0x0591, 0x05BD}, {0x05BF, 0x05BF}, {0x05C1, 0x05C2}, {0x05C4, 0x05C5},
+        {0x05C7, 0x05C7}, {0x0610, 0x061A}, {0x061C, 0x061C}, {0x064B, 0x065F}, {0x0670, 0x0670}, {0x06D6, 0x06DC},
+        {0x06DF, 0x06E4}, {0x06E7, 0x06E8}, {0x06EA, 0x06ED}, {0x0711, 0x0711}, {0x0730, 0x074A}, {0x0900, 0x0902},
+        {0x093A, 0x093A}, {0x093C, 0x093C}, {0x0941, 0x0948}, {0x094D, 0x094D}, {0x0951, 0x0957}, {0x0962, 0x0963},
+        {0x0E31, 0x0E31}, {0x0E34, 0x0E3A}, {0x0E47, 0x0E4E}, {0x1160, 0x11FF}, {0x180B, 0x180F}, {0x1AB0, 0x1AFF},
+        {0x1DC0, 0x1DFF}, {0x200B, 0x200F}, {0x202A, 0x202E}, {0x2060, 0x2064}, {0x20D0, 0x20FF}, {0x302A, 0x302D},
+        {0x3099, 0x309A}, {0xFE00, 0xFE0F}, {0xFE20, 0xFE2F}, {0xFEFF, 0xFEFF}, {0x1D167, 0x1D169}, {0x1D173, 0x1D182},
+        {0x1D185, 0x1D18B}, {0x1D1AA, 0x1D1AD}, {0x1F3FB, 0x1F3FF}, {0xE0001, 0xE0001}, {0xE0020, 0xE007F}, {0xE0100, 0xE01EF}
+    });
+
+    /// The East Asian wide and fullwidth characters, and the emoji presented as such, that take two columns
+    constexpr auto wide_ranges = std::to_array<code_point_range>({
+        {0x1100, 0x115F}, {0x231A, 0x231B}, {0x2329, 0x232A}, {0x23E9, 0x23EC}, {0x23F0, 0x23F0}, {0x23F3, 0x23F3},
+        {0x25FD, 0x25FE}, {0x2614, 0x2615}, {0x2648, 0x2653}, {0x267F, 0x267F}, {0x2693, 0x2693}, {0x26A1, 0x26A1},
+        {0x26AA, 0x26AB}, {0x26BD, 0x26BE}, {0x26C4, 0x26C5}, {0x26CE, 0x26CE}, {0x26D4, 0x26D4}, {0x26EA, 0x26EA},
+        {0x26F2, 0x26F3}, {0x26F5, 0x26F5}, {0x26FA, 0x26FA}, {0x26FD, 0x26FD}, {0x2705, 0x2705}, {0x270A, 0x270B},
+        {0x2728, 0x2728}, {0x274C, 0x274C}, {0x274E, 0x274E}, {0x2753, 0x2755}, {0x2757, 0x2757}, {0x2795, 0x2797},
+        {0x27B0, 0x27B0}, {0x27BF, 0x27BF}, {0x2B1B, 0x2B1C}, {0x2B50, 0x2B50}, {0x2B55, 0x2B55}, {0x2E80, 0x3029},
+        {0x302E, 0x303E}, {0x3041, 0x3098}, {0x309B, 0x33FF}, {0x3400, 0x4DBF}, {0x4E00, 0x9FFF}, {0xA000, 0xA4CF},
+        {0xA960, 0xA97F}, {0xAC00, 0xD7A3}, {0xF900, 0xFAFF}, {0xFE10, 0xFE19}, {0xFE30, 0xFE6F}, {0xFF00, 0xFF60},
+        {0xFFE0, 0xFFE6}, {0x16FE0, 0x16FE4}, {0x17000, 0x18CFF}, {0x1B000, 0x1B2FF}, {0x1F004, 0x1F004}, {0x1F0CF, 0x1F0CF},
+        {0x1F18E, 0x1F18E}, {0x1F191, 0x1F19A}, {0x1F200, 0x1F265}, {0x1F300, 0x1F3FA}, {0x1F400, 0x1F64F}, {0x1F680, 0x1F6FF},
+        {0x1F7E0, 0x1F7EB}, {0x1F90C, 0x1F9FF}, {0x1FA70, 0x1FAFF}, {0x20000, 0x3FFFD}
+    });
+
+    /// @return whether `code_point` is in any of the sorted `ranges`
+    [[nodiscard]] constexpr bool contains(std::span<const code_point_range> ranges, char32_t code_point) noexcept {
+        const auto it = std::ranges::lower_bound(ranges, code_point, {}, &code_point_range::last);
+        return it != ranges.end() && it->first <= code_point;
+    }
+}
+
+export namespace zero::utf8 {
+    /**
+     * @return the UTF-8 encoding of `code_point`, or of the replacement character when it isn't
+     * a Unicode scalar value (a surrogate or a number above U+10FFFF)
+     */
+    [[nodiscard]] constexpr encoded encode(char32_t code_point) noexcept {
+        if ((code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > max_code_point)
+            code_point = replacement_character;
+
+        const auto byte = [](char32_t bits) { return static_cast<char>(static_cast<unsigned char>(bits)); };
+        if (code_point < 0x80)
+            return {{byte(code_point)}, 1};
+        if (code_point < 0x800)
+            return {{byte(0xC0 | (code_point >> 6)), byte(0x80 | (code_point & 0x3F))}, 2};
+        if (code_point < 0x10000)
+            return {{byte(0xE0 | (code_point >> 12)), byte(0x80 | ((code_point >> 6) & 0x3F)), byte(0x80 | (code_point & 0x3F))}, 3};
+        return {{
+            byte(0xF0 | (code_point >> 18)), byte(0x80 | ((code_point >> 12) & 0x3F)),
+            byte(0x80 | ((code_point >> 6) & 0x3F)), byte(0x80 | (code_point & 0x3F))
+        }, 4};
+    }
+
+    /// Appends the UTF-8 encoding of `code_point` to `out`
+    void encode_to(std::string& out, char32_t code_point) {
+        out += encode(code_point).view();
+    }
+
+    /// @return the UTF-8 encoding of the code points of `text`
+    [[nodiscard]] std::string encode(std::u32string_view text) {
+        std::string result;
+        result.reserve(text.size());
+        for (const char32_t code_point : text)
+            encode_to(result, code_point);
+        return result;
+    }
+
+    /// @return the code point that starts at the position `at` of `text`, that must be smaller than its size
+    [[nodiscard]] constexpr decoded decode(std::string_view text, std::size_t at = 0) noexcept {
+        return ::utf8::__detail::decode(text, at);
+    }
+
+    /// @return the position of the first invalid sequence of `text`, or `npos` when it's valid UTF-8
+    [[nodiscard]] constexpr std::size_t find_invalid(std::string_view text) noexcept {
+        for (std::size_t i = ::utf8::__detail::skip_ascii(text, 0); i < text.size(); i = ::utf8::__detail::skip_ascii(text, i)) {
+            const decoded code_point = ::utf8::__detail::decode(text, i);
+            if (!code_point.valid)
+                return i;
+            i += code_point.size;
+        }
+        return std::string_view::npos;
+    }
+
+    [[nodiscard]] constexpr bool is_valid(std::string_view text) noexcept {
+        return find_invalid(text) == std::string_view::npos;
+    }
+
+    /**
+     * @return the number of code points of `text`, counted a word at a time as the bytes that aren't
+     * continuation bytes. For an invalid text, it's not the number of decoded code points
+     */
+    [[nodiscard]] constexpr std::size_t length(std::string_view text) noexcept {
+        std::size_t continuations = 0;
+        std::size_t i = 0;
+        if !consteval {
+            for (; i + 8 <= text.size(); i += 8) { // The continuation bytes have their highest bit set, and the next one clear
+                const std::uint64_t word = ::utf8::__detail::load(text.data() + i);
+                continuations += static_cast<std::size_t>(std::popcount(word & ~(word << 1) & ::utf8::__detail::high_bits));
+            }
+        }
+        for (; i < text.size(); ++i)
+            continuations += ::utf8::__detail::is_continuation(static_cast<unsigned char>(text[i]));
+        return text.size() - continuations;
+    }
+
+    /**
+     * @return the number of columns that `code_point` takes in a terminal: zero for the combining marks
+     * and the format characters, two for the East Asian wide characters and the emoji, and one for the
+     * rest. Like in `std::format`, the control characters take a column too
+     */
+    [[nodiscard]] constexpr std::size_t width(char32_t code_point) noexcept {
+        if (code_point < 0x300)
+            return 1;
+        if (::utf8::__detail::contains(::utf8::__detail::zero_width_ranges, code_point))
+            return 0;
+        return ::utf8::__detail::contains(::utf8::__detail::wide_ranges, code_point) ? 2 : 1;
+    }
+
+    /// @return the number of columns that `text` takes in a terminal. Every invalid sequence takes one
+    [[nodiscard]] constexpr std::size_t display_width(std::string_view text) noexcept {
+        std::size_t columns = 0;
+        std::size_t i = 0;
+        while (true) {
+            const std::size_t ascii_end = ::utf8::__detail::skip_ascii(text, i);
+            columns += ascii_end - i;
+            if (ascii_end == text.size())
+                return columns;
+            const decoded code_point = ::utf8::__detail::decode(text, ascii_end);
+            columns += width(code_point.code_point);
+            i = ascii_end + code_point.size;
+        }
+    }
+
+    /**
+     * @return the longest prefix of `text` that takes at most `columns` columns in a terminal, without
+     * cutting any code point, and with the zero width code points that follow it
+     */
+    [[nodiscard]] constexpr std::string_view truncate_to_width(std::string_view text, std::size_t columns) noexcept {
+        std::size_t used = 0;
+        std::size_t i = 0;
+        while (i < text.size()) {
+            const std::size_t ascii_end = std::min(::utf8::__detail::skip_ascii(text, i), i + (columns - used));
+            used += ascii_end - i;
+            i = ascii_end;
+            if (i == text.size() || static_cast<unsigned char>(text[i]) < 0x80)
+                break;
+            const decoded code_point = ::utf8::__detail::decode(text, i);
+            const std::size_t code_point_width = width(code_point.code_point);
+            if (used + code_point_width > columns)
+                break;
+            used += code_point_width;
+            i += code_point.size;
+        }
+        return text.substr(0, i);
+    }
+
+    /// A lazy view of the code points of a UTF-8 text, where every invalid sequence is a replacement character
+    class code_point_view : public std::ranges::view_interface<code_point_view> {
+    public:
+        class iterator {
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = char32_t;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr iterator() noexcept = default;
+
+            constexpr iterator(std::string_view text, std::size_t position) noexcept
+                : _text {text}
+                , _position {position}
+                , _current {position < text.size() ? decode(text, position) : decoded {}} {}
+
+            [[nodiscard]] constexpr char32_t operator*() const noexcept { return _current.code_point; }
+
+            /// @return the position of the current code point in the text
+            [[nodiscard]] constexpr std::size_t position() const noexcept { return _position; }
+
+            constexpr iterator& operator++() noexcept {
+                _position += _current.size;
+                if (_position < _text.size())
+                    _current = decode(_text, _position);
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept {
+                iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) noexcept {
+                return lhs._position == rhs._position;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+                return it._position >= it._text.size();
+            }
+
+        private:
+            std::string_view _text {};
+            std::size_t _position = 0;
+            decoded _current {};
+        };
+
+        constexpr code_point_view() noexcept = default;
+
+        constexpr explicit code_point_view(std::string_view text) noexcept : _text {text} {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept { return {_text, 0}; }
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    private:
+        std::string_view _text {};
+    };
+
+    /// @return a lazy view of the code points of `text`
+    [[nodiscard]] constexpr code_point_view code_points(std::string_view text) noexcept {
+        return code_point_view {text};
+    }
+
+    /// @return the code points of `text`, with a replacement character for every invalid sequence
+    [[nodiscard]] std::u32string decode_all(std::string_view text) {
+        std::u32string result;
+        result.reserve(length(text));
+        for (const char32_t code_point : code_points(text))
+            result += code_point;
+        return result;
+    }
+}
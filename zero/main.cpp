@@ -245,7 +245,7 @@ void run_formatter_and_stylize_examples() {
 
     std::cout << "#######Check formatter########\n\n";
 
-    std::string format_str = "x = {10, y = 20, z = {}}";
+    constexpr std::string_view format_str = "x = {10, y = 20, z = {}}";
     std::cout << formatter(format_str, 10) << std::endl;
 
 
@@ -269,26 +269,26 @@ void run_formatter_and_stylize_examples() {
     std::cout << hiddenText << "\n";
 
     std::cout << "\n\n#######Check combination full text########\n\n";
-    std::string format_str1 = "[WARNING] {} is deprecated. Please use {} instead.";
+    constexpr std::string_view format_str1 = "[WARNING] {} is deprecated. Please use {} instead.";
     std::string warning_msg = formatter(format_str1, "methodA", "methodB");
     std::string stylized_warning_msg = stylize(warning_msg, Color::YELLOW, {Modifier::BOLD});
     std::cout << stylized_warning_msg << std::endl;
 
-    std::string format_str2 = "[ERROR] Failed to open file: {}";
+    constexpr std::string_view format_str2 = "[ERROR] Failed to open file: {}";
     std::string error_msg = formatter(format_str2, "/path/to/file");
     std::string stylized_error_msg = stylize(error_msg, Color::RED, {Modifier::BOLD, Modifier::UNDERLINE});
     std::cout << stylized_error_msg << std::endl;
 
     std::cout << "\n\n#######Check combination partial text########\n\n";
-    std::string format_str3 = "{} Successfully connected to server: {}";
+    constexpr std::string_view format_str3 = "{} Successfully connected to server: {}";
     std::string stylized_info_msg = stylize("[INFO]", Color::GREEN, {Modifier::FAINT});
     std::string info_msg = formatter(format_str3,stylized_info_msg, "192.168.1.1");
     std::cout << info_msg << std::endl;
 
     std::cout << "\n\n#######Check unicode symbols########\n";
-    std::string format_str4 = "{} Triple integral symbol: {}";
+    constexpr std::string_view format_str4 = "{} Triple integral symbol: {}";
     std::string stylized_info_msg_2 = stylize("[INFO]", Color::GREEN, {Modifier::FAINT});
-    std::string info_msg_2 = formatter(format_str4, stylized_info_msg_2, "∭");
+    std::string info_msg_2 = formatter(format_str4, stylized_info_msg_2, symbol_v<MathSymbol::TripleIntegral>);
     std::cout << info_msg_2 << "\n\n";
 }
 
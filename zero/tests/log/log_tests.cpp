@@ -0,0 +1,111 @@
+/**
+ * @brief Tests for the `log` module
+ */
+
+import std;
+import log;
+
+#include <stdio.h>
+#include "../deps/catch.hpp"
+
+using namespace zero::log;
+
+namespace {
+    std::vector<std::string> read_lines(std::FILE* file) {
+        std::rewind(file);
+        std::vector<std::string> lines;
+        std::string line;
+        for (int c = std::fgetc(file); c != EOF; c = std::fgetc(file)) {
+            if (c == '\n')
+                lines.push_back(std::exchange(line, {}));
+            else
+                line += static_cast<char>(c);
+        }
+        return lines;
+    }
+
+    bool ends_with(std::string_view text, std::string_view suffix) {
+        return text.size() >= suffix.size() && text.substr(text.size() - suffix.size()) == suffix;
+    }
+}
+
+TEST_CASE("The messages are formatted and written by the background thread", "[log]") {
+    std::FILE* file = std::tmpfile();
+    REQUIRE( file != nullptr );
+
+    SECTION("The messages keep their arguments, even the strings that don't outlive the call") {
+        logger log {{.fd = fileno(file)}};
+        {
+            const std::string temporary = "a temporary string";
+            log.info("{} {:>4} {:.2f}", temporary, 42, 3.14159);
+        }
+        log.error("{} {}", 'c', true);
+        log.flush();
+
+        const auto lines = read_lines(file);
+        REQUIRE( lines.size() == 2 );
+        CHECK( ends_with(lines[0], "[INFO ] a temporary string   42 3.14") );
+        CHECK( ends_with(lines[1], "[ERROR] c true") );
+    }
+
+    SECTION("The messages below the minimum level are discarded") {
+        basic_logger<level::info> log {{.fd = fileno(file), .min_level = level::warn}};
+        log.debug("Removed at compile time");
+        log.info("Discarded at runtime");
+        log.warn("Logged");
+        log.min_level(level::trace);
+        log.info("Logged too");
+        log.flush();
+
+        const auto lines = read_lines(file);
+        REQUIRE( lines.size() == 2 );
+        CHECK( ends_with(lines[0], "[WARN ] Logged") );
+        CHECK( ends_with(lines[1], "[INFO ] Logged too") );
+    }
+
+    SECTION("A message almost as big as the queue is written when it has to start at the beginning of the buffer") {
+        const auto policy = GENERATE(overflow_policy::block, overflow_policy::drop);
+        const std::string big(4096 - 64, 'x');
+        {
+            logger log {{.fd = fileno(file), .queue_capacity = 4096, .policy = policy}};
+            log.info("{}", 's');
+            log.flush();
+            log.info("{}", big);
+        }
+
+        const auto lines = read_lines(file);
+        REQUIRE( lines.size() == 2 );
+        CHECK( ends_with(lines[0], "[INFO ] s") );
+        CHECK( ends_with(lines[1], "[INFO ] " + big) );
+    }
+
+    SECTION("Every message of many threads is written in order with the block and grow policies") {
+        const auto policy = GENERATE(overflow_policy::block, overflow_policy::grow);
+        constexpr int threads = 8;
+        constexpr int messages = 1000;
+        {
+            logger log {{.fd = fileno(file), .queue_capacity = 4096, .policy = policy}};
+            std::vector<std::thread> producers;
+            for (int thread = 0; thread < threads; ++thread)
+                producers.emplace_back([&log, thread] {
+                    for (int message = 0; message < messages; ++message)
+                        log.info("{} {}", thread, message);
+                });
+            for (auto& producer : producers)
+                producer.join();
+        }
+
+        const auto lines = read_lines(file);
+        REQUIRE( lines.size() == threads * messages );
+        std::array<int, threads> next {};
+        for (const auto& line : lines) {
+            std::istringstream fields {line.substr(line.find(']') + 2)};
+            int thread = 0;
+            int message = 0;
+            fields >> thread >> message;
+            CHECK( message == next[static_cast<std::size_t>(thread)]++ );
+        }
+    }
+
+    std::fclose(file);
+}
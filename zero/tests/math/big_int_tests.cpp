@@ -0,0 +1,45 @@
+#include "big_int_tests.h"
+
+using namespace zero::math;
+
+TestSuite big_int_suite {"BigInt TS"};
+
+void big_int_tests() {
+    TEST_CASE(big_int_suite, "BigInt round-trips its decimal representation", [] {
+        const auto yotta = BigInt {"1000000000000000000000000"};
+        assertEquals(yotta.to_string() == "1000000000000000000000000", true);
+        assertEquals(BigInt {"-000123"}.to_string() == "-123", true);
+        assertEquals(BigInt {0}.to_string() == "0", true);
+    });
+    TEST_CASE(big_int_suite, "Small values are kept inline", [] {
+        const BigInt a {std::numeric_limits<std::int64_t>::min()};
+        assertEquals(a.size(), std::size_t {1});
+        assertEquals(a.is_negative(), true);
+        const BigInt b = BigInt {std::numeric_limits<std::uint64_t>::max()} + BigInt {1};
+        assertEquals(b.size(), std::size_t {2});
+    });
+    TEST_CASE(big_int_suite, "Arithmetic follows the built-in integers semantics", [] {
+        assertEquals(BigInt {-7} / BigInt {2} == BigInt {-3}, true);
+        assertEquals(BigInt {-7} % BigInt {2} == BigInt {-1}, true);
+        assertEquals(BigInt {7} - BigInt {7} == BigInt {}, true);
+        assertEquals(BigInt {-3} < BigInt {2}, true);
+    });
+    TEST_CASE(big_int_suite, "Karatsuba products are consistent with the division", [] {
+        // 2^4096 - 1 and 3^1500 are both above the Karatsuba threshold
+        const BigInt a = BigInt::pow(BigInt {2}, 4096) - BigInt {1};
+        const BigInt b = BigInt::pow(BigInt {3}, 1500);
+        const BigInt product = a * b;
+        assertEquals(product / b == a, true);
+        assertEquals(product % a == BigInt {}, true);
+        assertEquals((product + BigInt {5}) % b == BigInt {5}, true);
+    });
+    TEST_CASE(big_int_suite, "Division by zero throws", [] {
+        bool thrown = false;
+        try {
+            static_cast<void>(BigInt {1} / BigInt {0});
+        } catch (const std::domain_error&) {
+            thrown = true;
+        }
+        assertEquals(thrown, true);
+    });
+}
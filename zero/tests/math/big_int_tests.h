@@ -0,0 +1,12 @@
+/**
+* Tests for the BigInt arbitrary-precision integer type
+*/
+
+#pragma once
+
+import tsuite;
+import math;
+import std;
+
+extern TestSuite big_int_suite;
+extern void big_int_tests();
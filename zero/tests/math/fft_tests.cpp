@@ -0,0 +1,101 @@
+#include "fft_tests.h"
+
+using namespace zero::math;
+
+TestSuite fft_suite {"FFT TS"};
+
+namespace {
+    std::vector<std::complex<double>> signal(std::size_t size) {
+        std::vector<std::complex<double>> values(size);
+        for (std::size_t i = 0; i < size; ++i)
+            values[i] = {std::sin(0.3 * static_cast<double>(i)) + 0.25, std::cos(0.7 * static_cast<double>(i * i % 17))};
+        return values;
+    }
+
+    std::vector<std::complex<double>> naive_dft(const std::vector<std::complex<double>>& input) {
+        const std::size_t n = input.size();
+        std::vector<std::complex<double>> output(n);
+        for (std::size_t k = 0; k < n; ++k)
+            for (std::size_t j = 0; j < n; ++j)
+                output[k] += input[j] * std::polar(1.0, -2 * std::numbers::pi * static_cast<double>(j * k % n) / static_cast<double>(n));
+        return output;
+    }
+
+    double max_error(std::span<const std::complex<double>> lhs, std::span<const std::complex<double>> rhs) {
+        double error = 0;
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+            error = std::max(error, std::abs(lhs[i] - rhs[i]));
+        return error;
+    }
+}
+
+void fft_tests() {
+    TEST_CASE(fft_suite, "The transform matches the DFT for power of two, mixed radix and prime sizes", [] {
+        // Radix-4 and radix-2 stages, small prime butterflies and Bluestein's algorithm (97, 1009)
+        for (const std::size_t size : {1uz, 2uz, 8uz, 64uz, 512uz, 12uz, 30uz, 105uz, 31uz, 97uz, 1009uz}) {
+            const auto input = signal(size);
+            std::vector<std::complex<double>> output(size);
+            fft(input, output);
+            assertEquals(max_error(output, naive_dft(input)) < 1e-9 * static_cast<double>(size), true);
+        }
+    });
+    TEST_CASE(fft_suite, "The inverse transform recovers the signal, also in place", [] {
+        for (const std::size_t size : {16uz, 1024uz, 360uz, 4099uz}) {
+            const auto input = signal(size);
+            auto values = input;
+            fft(values, values);
+            ifft(values, values);
+            assertEquals(max_error(values, input) < 1e-12, true);
+        }
+    });
+    TEST_CASE(fft_suite, "The real transform matches the first half of the complex one", [] {
+        for (const std::size_t size : {2uz, 64uz, 90uz, 15uz, 1009uz}) {
+            std::vector<double> real(size);
+            std::vector<std::complex<double>> promoted(size), expected(size);
+            for (std::size_t i = 0; i < size; ++i)
+                promoted[i] = real[i] = std::sin(0.1 * static_cast<double>(i * i)) + static_cast<double>(i % 3);
+            fft(promoted, expected);
+
+            std::vector<std::complex<double>> spectrum(size / 2 + 1);
+            rfft(real, spectrum);
+            assertEquals(max_error(spectrum, std::span {expected}.first(spectrum.size())) < 1e-9, true);
+
+            std::vector<double> recovered(size);
+            irfft(spectrum, recovered);
+            for (std::size_t i = 0; i < size; ++i)
+                assertEquals(std::abs(recovered[i] - real[i]) < 1e-12, true);
+        }
+    });
+    TEST_CASE(fft_suite, "Batched transforms match the individual ones", [] {
+        constexpr std::size_t size = 256;
+        constexpr std::size_t count = 300;
+        const auto input = signal(size * count);
+        std::vector<std::complex<double>> batched(input.size());
+        fft_batch(input, batched, size, 4);
+        for (std::size_t i = 0; i < count; i += 37) {
+            std::vector<std::complex<double>> single(size);
+            fft(std::span {input}.subspan(i * size, size), single);
+            assertEquals(max_error(single, std::span {batched}.subspan(i * size, size)), 0.0);
+        }
+        ifft_batch(batched, batched, size);
+        assertEquals(max_error(batched, input) < 1e-12, true);
+    });
+    TEST_CASE(fft_suite, "The empty signals have an empty spectrum", [] {
+        std::vector<std::complex<double>> complex_signal, complex_spectrum;
+        fft(complex_signal, complex_spectrum);
+        ifft(complex_spectrum, complex_signal);
+        assertEquals(complex_spectrum.size(), 0uz);
+
+        std::vector<double> real_signal;
+        std::vector<std::complex<double>> real_spectrum;
+        rfft(real_signal, real_spectrum);
+        irfft(real_spectrum, real_signal);
+        assertEquals(RealFftPlan<double>(0).spectrum_size(), 0uz);
+        assertEquals(FftPlan<double>(0).size(), 0uz);
+    });
+    TEST_CASE(fft_suite, "The plans are cached by size", [] {
+        assertEquals(fft_plan(4096) == fft_plan(4096), true);
+        assertEquals(fft_plan(4096) == fft_plan(2048), false);
+        assertEquals(real_fft_plan<float>(100)->spectrum_size(), std::size_t {51});
+    });
+}
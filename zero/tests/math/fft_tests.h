@@ -0,0 +1,12 @@
+/**
+* Tests for the Fast Fourier Transforms of the fft library
+*/
+
+#pragma once
+
+import tsuite;
+import math;
+import std;
+
+extern TestSuite fft_suite;
+extern void fft_tests();
@@ -0,0 +1,64 @@
+#include "fixed_tests.h"
+
+using namespace zero::math;
+
+TestSuite fixed_suite {"Fixed-point TS"};
+
+using milli = fixed<std::int64_t, Rational<1, 1000>>;
+
+void fixed_tests() {
+    TEST_CASE(fixed_suite, "Fixed-point numbers are built from integers, doubles and other scales", [] {
+        static_assert(milli(3).raw == 3000);
+        static_assert(milli(1.2345).raw == 1235);
+        static_assert(milli(-1.2345).raw == -1235);
+        static_assert(fixed<std::int32_t, Rational<1, 100>>(milli(1.235)).raw == 124);
+        assertEquals(static_cast<double>(milli::from_raw(2500)), 2.5);
+    });
+    TEST_CASE(fixed_suite, "The arithmetic is exact and rounds half away from zero", [] {
+        static_assert((milli(1.5) + milli(2.25)).raw == 3750);
+        static_assert((milli(1.235) * milli(3)).raw == 3705);
+        static_assert((milli(3) / milli(7)).raw == 429);
+        static_assert((milli(-3) / milli(7)).raw == -429);
+        static_assert((milli(3) / milli(-7)).raw == -429);
+        static_assert(Rational<1000>::apply(milli(2.5)).raw == 2'500'000);
+        static_assert(milli(1.5) < milli(2));
+    });
+    TEST_CASE(fixed_suite, "The integers can be mixed with the fixed-point numbers", [] {
+        static_assert((milli(1.5) + 2).raw == 3500);
+        static_assert((2 - milli(1.5)).raw == 500);
+        static_assert((milli(1.5) * 3).raw == 4500);
+        static_assert((3 * milli(1.5)).raw == 4500);
+        static_assert((milli(1) / 3).raw == 333);
+        static_assert((milli(-2) / 3).raw == -667);
+        static_assert((milli(1) / -3).raw == -333);
+        static_assert((1 / milli(0.5)).raw == 2000);
+    });
+    TEST_CASE(fixed_suite, "The results out of the range of the representation throw", [] {
+        using centi16 = fixed<std::int16_t, Rational<1, 100>>;
+        const auto overflows = [](auto operation) {
+            try {
+                (void) operation();
+            } catch (const std::overflow_error&) {
+                return true;
+            }
+            return false;
+        };
+        assertEquals(overflows([] { return centi16(328); }), true);
+        assertEquals(overflows([] { return centi16(327.68); }), true);
+        assertEquals(overflows([] { return centi16(std::numeric_limits<double>::quiet_NaN()); }), true);
+        assertEquals(overflows([] { return centi16(300) + centi16(27.68); }), true);
+        assertEquals(overflows([] { return centi16(-300) - centi16(28); }), true);
+        assertEquals(overflows([] { return centi16(20) * centi16(20); }), true);
+        assertEquals(overflows([] { return centi16(200) * 2; }), true);
+        assertEquals(overflows([] { return -centi16::from_raw(std::numeric_limits<std::int16_t>::min()); }), true);
+        assertEquals(overflows([] { return centi16(milli(400)); }), true);
+        assertEquals(overflows([] { return centi16(327.67); }), false);
+        assertEquals(overflows([] { return centi16(300) + centi16(27); }), false);
+    });
+    TEST_CASE(fixed_suite, "The decimal scales are written with all their digits", [] {
+        std::array<char, 32> buffer {};
+        const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), milli(-12.5));
+        assertEquals(static_cast<long>(result.ptr - buffer.data()), 7L);
+        assertEquals(std::string_view(buffer.data(), result.ptr) == "-12.500", true);
+    });
+}
@@ -0,0 +1,12 @@
+/**
+* Tests for the fixed-point numbers
+*/
+
+#pragma once
+
+import tsuite;
+import math;
+import std;
+
+extern TestSuite fixed_suite;
+extern void fixed_tests();
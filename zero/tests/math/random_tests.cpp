@@ -0,0 +1,61 @@
+#include "random_tests.h"
+
+using namespace zero::math;
+
+TestSuite random_suite {"Random TS"};
+
+void random_tests() {
+    TEST_CASE(random_suite, "Pcg64 matches the reference stream", [] {
+        Pcg64 engine {42, 54};
+        assertEquals(engine(), std::uint64_t {0x86b1da1d72062b68});
+        assertEquals(engine(), std::uint64_t {0x1304aa46c9853d39});
+        assertEquals(engine(), std::uint64_t {0xa3670e9e0dd50358});
+    });
+    TEST_CASE(random_suite, "Pcg64 advance skips the same values that calling it would", [] {
+        Pcg64 stepped {7}, advanced {7};
+        for (int i = 0; i < 1000; ++i)
+            stepped();
+        advanced.advance(1000);
+        assertEquals(stepped == advanced, true);
+        assertEquals(stepped(), advanced());
+    });
+    TEST_CASE(random_suite, "Xoshiro256** matches the reference stream", [] {
+        Xoshiro256StarStar engine {std::array<std::uint64_t, 4> {1, 2, 3, 4}};
+        assertEquals(engine(), std::uint64_t {11520});
+        assertEquals(engine(), std::uint64_t {0});
+        assertEquals(engine(), std::uint64_t {1509978240});
+    });
+    TEST_CASE(random_suite, "The lanes of the SIMD engine are jumped xoshiro256** streams", [] {
+        Xoshiro256StarStar seed {1234};
+        Xoshiro256StarStarSimd<4> simd {seed};
+        std::array<std::uint64_t, 4 * 8> values {};
+        fill(simd, std::span<std::uint64_t> {values});
+
+        for (std::size_t lane = 0; lane < 4; ++lane) {
+            Xoshiro256StarStar scalar {seed};
+            for (std::size_t i = 0; i < lane; ++i)
+                scalar.jump();
+            for (std::size_t step = 0; step < 8; ++step)
+                assertEquals(values[step * 4 + lane], scalar());
+        }
+    });
+    TEST_CASE(random_suite, "Uniform doubles are in [0, 1) and centered", [] {
+        Xoshiro256StarStarSimd<> engine {99};
+        std::vector<double> values(100'003);
+        fill_uniform(engine, std::span<double> {values});
+        double sum = 0;
+        for (const double value : values) {
+            assertEquals(value >= 0.0 && value < 1.0, true);
+            sum += value;
+        }
+        assertEquals(std::abs(sum / static_cast<double>(values.size()) - 0.5) < 0.01, true);
+    });
+    TEST_CASE(random_suite, "The engines work with the standard distributions", [] {
+        Pcg64 engine {2024};
+        std::uniform_int_distribution<int> dice {1, 6};
+        for (int i = 0; i < 1000; ++i) {
+            const int roll = dice(engine);
+            assertEquals(roll >= 1 && roll <= 6, true);
+        }
+    });
+}
@@ -0,0 +1,13 @@
+/**
+* Tests for the engines and the bulk generation of the random library
+*/
+
+#pragma once
+
+import tsuite;
+import math;
+import std;
+
+extern TestSuite random_suite;
+
+extern void random_tests();
@@ -0,0 +1,46 @@
+#include "rational_tests.h"
+
+using namespace zero::math;
+
+TestSuite rational_suite {"Rational TS"};
+
+void rational_tests() {
+    TEST_CASE(rational_suite, "Rationals are reduced to their canonical form", [] {
+        static_assert(std::is_same_v<Rational<6, -4>::type, Rational<-3, 2>>);
+        assertEquals(static_cast<long>(Rational<6, -4>::num), -3L);
+        assertEquals(static_cast<long>(Rational<6, -4>::den), 2L);
+    });
+    TEST_CASE(rational_suite, "Products, quotients and powers are exact", [] {
+        using km_per_h = rational_divide<Rational<1000>, Rational<3600>>;
+        static_assert(std::is_same_v<km_per_h, Rational<5, 18>>);
+        static_assert(std::is_same_v<rational_product<Rational<2, 3>, Rational<3, 4>, Rational<2>>, Rational<1>>);
+
+        // yocto and yotta don't fit in 64 bits, but they are exactly representable here
+        using yotta = rational_power<Rational<10>, 24>;
+        using yocto = rational_power<Rational<10>, -24>;
+        static_assert(std::is_same_v<rational_multiply<yotta, yocto>, Rational<1>>);
+        assertEquals(rational_power<Rational<10>, -3>::value, 0.001);
+    });
+    TEST_CASE(rational_suite, "Integral amounts are scaled with integer arithmetic", [] {
+        assertEquals(Rational<5, 18>::apply(36), 10);
+        assertEquals(Rational<1, 1000>::apply(3000L), 3L);
+        assertEquals(Rational<1000>::apply(3), 3000);
+    });
+    TEST_CASE(rational_suite, "The intermediate products don't overflow the integral amounts", [] {
+        static_assert(Rational<1000, 3>::apply(3'000'000) == 1'000'000'000);
+        static_assert(Rational<5, 18>::apply(std::numeric_limits<std::int64_t>::max() / 2) == 1'281'023'894'007'607'750);
+        static_assert(Rational<-5, 18>::apply(std::int64_t {-36}) == 10);
+        static_assert(rational_power<Rational<10>, -24>::apply(5'000'000'000L) == 0);
+        assertEquals(Rational<7, 9>::apply(std::numeric_limits<std::int32_t>::max()), 1'670'265'058);
+
+        // Both terms are bigger than any 64-bit amount, so the product overflows even 128 bits
+        using yotta = rational_power<Rational<10>, 24>;
+        using almost_one = Rational<yotta::num, yotta::num + 1>;
+        static_assert(almost_one::apply(std::numeric_limits<std::int64_t>::max()) == 9'223'372'036'854'775'806);
+        static_assert(almost_one::apply(std::numeric_limits<std::int64_t>::min()) == -9'223'372'036'854'775'807);
+        assertEquals(rational_divide<Rational<-1>, almost_one>::apply(std::numeric_limits<std::int64_t>::min() + 1),
+            std::numeric_limits<std::int64_t>::max());
+        assertEquals(Rational<yotta::num + 1, yotta::num>::apply(std::numeric_limits<std::uint64_t>::max() - 1),
+            std::numeric_limits<std::uint64_t>::max() - 1);
+    });
+}
@@ -0,0 +1,12 @@
+/**
+* Tests for the compile-time Rational type and its type level operations
+*/
+
+#pragma once
+
+import tsuite;
+import math;
+import std;
+
+extern TestSuite rational_suite;
+extern void rational_tests();
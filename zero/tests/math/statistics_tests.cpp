@@ -0,0 +1,73 @@
+#include "statistics_tests.h"
+
+using namespace zero::math;
+
+TestSuite statistics_suite {"Statistics TS"};
+
+void statistics_tests() {
+    TEST_CASE(statistics_suite, "Welford moments of a known sequence", [] {
+        Moments<> moments;
+        for (const double sample : {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0})
+            moments.push(sample);
+        assertEquals(moments.count(), std::uint64_t {8});
+        // The mean and the variance are updated incrementally, so they can differ from the exact ones in the last bits
+        assertEquals(std::abs(moments.mean() - 5.0) < 1e-12, true);
+        assertEquals(std::abs(moments.variance() - 4.0) < 1e-12, true);
+        assertEquals(std::abs(moments.stddev() - 2.0) < 1e-12, true);
+        // The extremes are samples, so they're exact
+        assertEquals(moments.min(), 2.0);
+        assertEquals(moments.max(), 9.0);
+    });
+    TEST_CASE(statistics_suite, "Merged moments are the moments of the whole stream", [] {
+        Moments<> whole, lhs, rhs;
+        for (int i = 0; i < 1000; ++i) {
+            const double sample = 1e9 + i % 17;
+            whole.push(sample);
+            (i % 3 == 0 ? lhs : rhs).push(sample);
+        }
+        lhs.merge(rhs);
+        assertEquals(lhs.count(), whole.count());
+        assertEquals(std::abs(lhs.mean() - whole.mean()) < 1e-3, true);
+        assertEquals(std::abs(lhs.variance() - whole.variance()) < 1e-3, true);
+    });
+    TEST_CASE(statistics_suite, "TDigest estimates the quantiles of a uniform stream", [] {
+        TDigest lhs, rhs;
+        for (int i = 0; i < 100'000; ++i)
+            (i % 2 == 0 ? lhs : rhs).push(static_cast<double>(i));
+        lhs.merge(rhs);
+        assertEquals(lhs.count(), 100'000.0);
+        assertEquals(std::abs(lhs.quantile(0.5) - 50'000) < 1000, true);
+        assertEquals(std::abs(lhs.quantile(0.999) - 99'900) < 50, true);
+        assertEquals(lhs.quantile(1), 99'999.0);
+        assertEquals(lhs.centroids().size() < 200, true);
+    });
+    TEST_CASE(statistics_suite, "HdrHistogram keeps the configured significant digits", [] {
+        HdrHistogram histogram {3'600'000'000ULL, 3};
+        for (std::uint64_t i = 1; i <= 10'000; ++i)
+            histogram.record(i * 1000);
+        assertEquals(histogram.total_count(), std::uint64_t {10'000});
+        assertEquals(histogram.min(), std::uint64_t {1000});
+        assertEquals(histogram.max(), std::uint64_t {10'000'000});
+
+        const auto p99 = static_cast<double>(histogram.value_at_quantile(0.99));
+        assertEquals(std::abs(p99 - 9'900'000) / 9'900'000 < 1e-3, true);
+        assertEquals(histogram.record(4'000'000'000ULL), false);
+    });
+    TEST_CASE(statistics_suite, "HdrHistogram records concurrently and merges", [] {
+        HdrHistogram shared {1'000'000, 2};
+        HdrHistogram global {1'000'000, 2};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+            threads.emplace_back([&shared] {
+                for (std::uint64_t i = 0; i < 10'000; ++i)
+                    shared.record(i);
+            });
+        for (auto& thread : threads)
+            thread.join();
+        global.merge(shared);
+        global.merge(shared);
+        assertEquals(shared.total_count(), std::uint64_t {40'000});
+        assertEquals(global.total_count(), std::uint64_t {80'000});
+        assertEquals(global.count_at(5), std::uint64_t {8});
+    });
+}
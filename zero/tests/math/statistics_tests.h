@@ -0,0 +1,12 @@
+/**
+* Tests for the streaming accumulators of the statistics library
+*/
+
+#pragma once
+
+import tsuite;
+import math;
+import std;
+
+extern TestSuite statistics_suite;
+extern void statistics_tests();
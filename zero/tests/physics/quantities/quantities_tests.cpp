@@ -53,18 +53,303 @@ SCENARIO("Scenario: when we define some physical quantities in terms of magnitud
     WHEN("we perform a multiplication in the form of the binary expression of x * y") {
         const auto bases_multiplication = q1 * q2;
         const auto derived_multiplication = velocity * velocity2;
-        THEN("We are able to multiply quantities with the same dimension") {
-            REQUIRE(bases_multiplication.amount == 21600000.0);
-            REQUIRE_THAT(derived_multiplication.amount, Catch::WithinAbs(16666666.6666667, 0.01));
+        THEN("We get a quantity whose dimension has the sum of the exponents of both dimensions") {
+            STATIC_REQUIRE(exponents_of<decltype(bases_multiplication)::magnitude> == dimension_exponents {2, 0, 0, 0, 0, 0, 0, 0});
+            STATIC_REQUIRE(exponents_of<decltype(derived_multiplication)::magnitude> == dimension_exponents {0, 2, -2, 0, 0, 0, 0, 0});
+            REQUIRE(bases_multiplication.amount == 216000.0);
+            REQUIRE_THAT(
+                quantity<coherent_unit<dimension_exponents {0, 2, -2, 0, 0, 0, 0, 0}>>(derived_multiplication).amount,
+                Catch::WithinAbs(16666666.6666667, 0.01)
+            );
+        }
+        THEN("A mass by an acceleration is a force") {
+            const quantity<Newton> force = quantity<Kilogram> {2.} * quantity<MetersPerSecondSquared> {9.8};
+            const quantity<Joule> work = force * quantity<Meter> {3.};
+            REQUIRE_THAT(force.amount, Catch::WithinAbs(19.6, 1e-12));
+            REQUIRE_THAT(work.amount, Catch::WithinAbs(58.8, 1e-12));
         }
     }
 
     WHEN("we perform a division in the form of the binary expression of x / y") {
         const auto bases_division = q1 / q2;
         const auto derived_division = velocity / velocity2;
-        THEN("We are able to divide quantities with the same dimension") {
-            REQUIRE_THAT(bases_division.amount, Catch::WithinAbs(0.42, 0.01));
-            REQUIRE(derived_division.amount == 5400);
+        THEN("We get a quantity whose dimension has the difference of the exponents of both dimensions") {
+            STATIC_REQUIRE(DimensionlessMagnitude<decltype(bases_division)::magnitude>);
+            REQUIRE_THAT(static_cast<double>(bases_division), Catch::WithinAbs(416.67, 0.01));
+            REQUIRE(static_cast<double>(derived_division) == 5400);
+        }
+        THEN("A length by a time is a speed, and the inverse of a time is a frequency") {
+            const quantity<KilometersPerHour> speed = quantity<Meter> {100.} / quantity<Second> {10.};
+            const quantity<Hertz> frequency = 1. / quantity<Second> {0.5};
+            REQUIRE(speed.amount == 36);
+            REQUIRE(frequency.amount == 2);
+        }
+    }
+
+    WHEN("we combine quantities whose amounts are only known at runtime") {
+        std::vector<double> readings {10., 20., 30.};
+        auto total = quantity<KilometersPerHour> {0.};
+        for (const double reading : readings)
+            total = total + quantity<KilometersPerHour> {reading};
+        const auto mixed = quantity<MetersPerSecond> {readings[0]} + quantity<KilometersPerHour> {readings[2]};
+        THEN("The arithmetic operators work outside constant expressions") {
+            REQUIRE(total.amount == 60);
+            REQUIRE_THAT(mixed.amount, Catch::WithinAbs(18.3333333333, 0.0001));
+        }
+        THEN("The result is expressed in the magnitude with the bigger scale") {
+            const auto days = quantity<Hour> {12.} + quantity<Day> {1.};
+            REQUIRE(days.amount == 1.5);
+            STATIC_REQUIRE((velocity + velocity2).amount > 300'055);
+        }
+        THEN("The integral results are expressed in the magnitude with the smaller scale, so they aren't truncated") {
+            constexpr auto mass = quantity<Kilogram, int> {1} + quantity<Hectogram, int> {7};
+            STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(mass)>, quantity<Hectogram, int>>);
+            STATIC_REQUIRE(mass.amount == 17);
+            const auto seconds = quantity<Second, int> {30} + quantity<Hour, int> {1};
+            STATIC_REQUIRE(std::is_same_v<decltype(seconds)::magnitude, Second>);
+            REQUIRE(seconds.amount == 3630);
+            REQUIRE((quantity<Hour, long> {1} - quantity<Minute, long> {90}).amount == -30);
+        }
+        THEN("The amount of the result has the common type of both amounts, so it isn't truncated") {
+            const auto mass = quantity<Kilogram, int> {1} + quantity<Hectogram, double> {1.5};
+            STATIC_REQUIRE(std::is_same_v<decltype(mass)::amount_type, double>);
+            REQUIRE_THAT(mass.amount, Catch::WithinAbs(1.15, 1e-12));
+        }
+        THEN("The float amounts are computed in float, with no promotion to double") {
+            const auto mass = quantity<Kilogram, float> {1.f} + quantity<Hectogram, float> {5.f};
+            STATIC_REQUIRE(std::is_same_v<decltype(mass)::amount_type, float>);
+            REQUIRE(mass.amount == 1.5f);
+
+            quantity_array<Kilogram, float> masses {1.f, 2.f};
+            masses -= quantity_array<Hectogram, float> {5.f, 10.f};
+            REQUIRE(masses.sum().amount == 1.5f);
+        }
+        THEN("Only the conversions that keep the amount are implicit") {
+            STATIC_REQUIRE(std::is_convertible_v<quantity<Kilogram, int>, quantity<Hectogram, long>>);
+            STATIC_REQUIRE(std::is_convertible_v<quantity<Kilogram, float>, quantity<Hectogram, double>>);
+            STATIC_REQUIRE(!std::is_convertible_v<quantity<Kilogram, double>, quantity<Hectogram, int>>);
+            STATIC_REQUIRE(!std::is_convertible_v<quantity<Hectogram, int>, quantity<Kilogram, int>>);
+            REQUIRE(quantity<Kilogram, int> {quantity<Hectogram, int> {25}}.amount == 2);
+        }
+    }
+
+    WHEN("we convert a whole batch of readings at once") {
+        std::vector<quantity<MetersPerSecond>> speeds {quantity<MetersPerSecond> {1.}, quantity<MetersPerSecond> {300'000.}};
+        std::vector<quantity<KilometersPerHour>> converted(speeds.size());
+        convert<KilometersPerHour>(std::span {speeds}, std::span {converted});
+
+        std::vector<double> seconds {3600., 86'400.};
+        std::vector<double> days(seconds.size());
+        convert<Second, Day>(seconds, days);
+        THEN("Every element is converted with the same folded factor that to() uses") {
+            REQUIRE(converted[0].amount == speeds[0].to<KilometersPerHour>().amount);
+            REQUIRE(converted[1].amount == 1'080'000);
+            REQUIRE_THAT(days[0], Catch::WithinAbs(1. / 24, 1e-12));
+            REQUIRE(days[1] == 1);
+        }
+        THEN("Integral amounts are converted with exact integer arithmetic") {
+            REQUIRE(quantity<KilometersPerHour, int> {36}.to<MetersPerSecond>().amount == 10);
+            REQUIRE(quantity<Day, long> {2}.to<Hour>().amount == 48);
+        }
+    }
+
+    WHEN("we format a quantity without touching the heap") {
+        char buffer[32];
+        const auto [end, error] = to_chars(std::begin(buffer), std::end(buffer), quantity<Newton> {19.6});
+        std::string formatted;
+        format_to(std::back_inserter(formatted), quantity<Kilogram, int> {3});
+        THEN("the unit symbols are computed at compile time") {
+            STATIC_REQUIRE(symbol_of<Newton> == "kg*m*s-2");
+            STATIC_REQUIRE(symbol_of<KilometersPerHour> == "km*h-1");
+            STATIC_REQUIRE(symbol_of<Kilogram> == "kg");
+        }
+        THEN("the amount and the symbol are written into the output") {
+            REQUIRE(error == std::errc {});
+            REQUIRE(std::string_view(buffer, end) == "19.6 kg*m*s-2");
+            REQUIRE(formatted == "3 kg");
+        }
+        THEN("a buffer that is too short is reported") {
+            char small[4];
+            REQUIRE(to_chars(std::begin(small), std::end(small), quantity<Newton> {19.6}).ec == std::errc::value_too_large);
+        }
+    }
+}
+
+SCENARIO("Scenario: when the amounts of the quantities are fixed-point numbers", "[quantity<Magnitude, fixed<Rep, Scale>>...]") {
+    using grams = zero::math::fixed<std::int64_t, zero::math::Rational<1, 1000>>;
+    constexpr quantity<Kilogram, grams> mass {grams(2.5)};
+
+    WHEN("we convert them into another unit") {
+        constexpr auto hectograms = mass.to<Hectogram>();
+        THEN("the conversion is performed in integer arithmetic, with the scale adjusted at compile time") {
+            STATIC_REQUIRE(hectograms.amount.raw == 25'000);
+            STATIC_REQUIRE((mass + quantity<Hectogram, grams> {grams(5)}).amount.raw == 30'000);
+        }
+    }
+
+    WHEN("we print them") {
+        std::string formatted;
+        format_to(std::back_inserter(formatted), mass);
+        THEN("every decimal of the scale is written") {
+            REQUIRE(formatted == "2.500 kg");
+        }
+    }
+
+    WHEN("the amount doesn't fit in the representation once converted") {
+        using centi16 = zero::math::fixed<std::int16_t, zero::math::Rational<1, 100>>;
+        const quantity<Kilogram, centi16> heavy {centi16(300)};
+        const quantity<Hectogram, centi16> light {centi16(1)};
+        THEN("the operations aren't noexcept, and they throw instead of wrapping around") {
+            STATIC_REQUIRE(!noexcept(heavy.to<Hectogram>()));
+            STATIC_REQUIRE(noexcept(quantity<Kilogram, int> {300}.to<Hectogram>()));
+            REQUIRE_THROWS_AS(heavy.to<Hectogram>(), std::overflow_error);
+            REQUIRE_THROWS_AS(heavy + light, std::overflow_error);
+            REQUIRE_THROWS_AS(heavy * centi16(2), std::overflow_error);
+        }
+    }
+}
+
+SCENARIO("Scenario: when we inspect the metadata of a magnitude", "[dimension_names_of<Magnitude>...]") {
+    WHEN("we look at the dimensions and the units of a derived magnitude") {
+        THEN("they are tables computed at compile time") {
+            STATIC_REQUIRE(quantity<Newton>::dimensions() == std::array<std::string_view, 3> {"mass", "length", "time"});
+            STATIC_REQUIRE(unit_symbols_of<KilometersPerHour> == std::array<std::string_view, 2> {"km", "h"});
+            STATIC_REQUIRE(magnitude_name_of<Volt> == "Volt");
+        }
+        THEN("they can be printed without allocating") {
+            std::ostringstream out;
+            quantity<Newton>::print_dimensions(out);
+            REQUIRE(out.str() == "Newton has dimensions of: [mass, length, time]\n");
+        }
+    }
+}
+
+SCENARIO("Scenario: when we store many quantities of the same magnitude in a quantity_array", "[quantity_array<Magnitude, T>...]") {
+    const quantity_array<KilometersPerHour> readings {36., 72., 108.};
+
+    WHEN("we convert the whole array into another unit") {
+        const auto converted = readings.to<MetersPerSecond>();
+        THEN("every amount is converted, and the reductions are expressed in the new unit") {
+            REQUIRE(converted[0].amount == 10);
+            REQUIRE(converted.sum().amount == 60);
+            REQUIRE(converted.mean().amount == 20);
+            REQUIRE(converted.min().amount == 10);
+            REQUIRE(converted.max().amount == 30);
+        }
+    }
+
+    WHEN("we operate element-wise with an array of a common dimension") {
+        const quantity_array<MetersPerSecond> offsets(readings.size(), 1.);
+        const auto sum = offsets + readings;
+        const auto difference = readings - offsets;
+        THEN("the result is expressed in the magnitude with the bigger scale") {
+            STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(sum)>, quantity_array<MetersPerSecond>>);
+            REQUIRE(sum[1].amount == 21);
+            REQUIRE(difference[2].amount == 29);
+            REQUIRE((readings * 2.)[2].amount == 216);
+        }
+        THEN("arrays of different sizes are rejected") {
+            REQUIRE_THROWS_AS(readings + quantity_array<MetersPerSecond>(2), std::invalid_argument);
+        }
+    }
+
+    WHEN("we look at its layout") {
+        THEN("the unit costs nothing at runtime and the amounts are aligned for SIMD") {
+            STATIC_REQUIRE(sizeof(quantity_array<Newton>) == sizeof(std::size_t) + sizeof(double*));
+            REQUIRE(reinterpret_cast<std::uintptr_t>(readings.amounts().data()) % 64 == 0);
+        }
+    }
+}
+
+SCENARIO("Scenario: when we read physical quantities from text", "[parse_quantity<Magnitude, T>...]") {
+    WHEN("we parse a single quantity") {
+        THEN("it's converted into the requested magnitude") {
+            REQUIRE(parse_quantity<MetersPerSecond>("36 km/h").amount == 10);
+            REQUIRE(parse_quantity<Kilogram>("3e3 g").amount == 3);
+            REQUIRE(parse_quantity<Newton>("2 kg*m/s^2").amount == 2);
+            REQUIRE(parse_quantity<Hour, int>("2 d").amount == 48);
+        }
+        THEN("unknown symbols and other dimensions are rejected") {
+            REQUIRE_THROWS_AS(parse_quantity<Meter>("3 kg"), std::invalid_argument);
+            REQUIRE_THROWS_AS(parse_quantity<Meter>("3 parsecs"), std::invalid_argument);
+            REQUIRE_THROWS_AS(parse_quantity<Meter>("three m"), std::invalid_argument);
+            REQUIRE_THROWS_AS(parse_quantity<Meter>("3 m^"), std::invalid_argument);
+            REQUIRE_THROWS_AS(parse_quantity<Newton>("2 kg*m/s^"), std::invalid_argument);
+        }
+        THEN("the amounts out of the range of the type are rejected, instead of wrapping around") {
+            REQUIRE_THROWS_AS((parse_quantity<Kilogram, int>("1e30 kg")), std::invalid_argument);
+            REQUIRE_THROWS_AS((parse_quantity<Kilogram, float>("1e300 kg")), std::invalid_argument);
+            REQUIRE((parse_quantity<Kilogram, std::int64_t>("-9.2e18 kg")).amount == -9'200'000'000'000'000'000);
+
+            constexpr std::string_view text = "3e9 kg";
+            quantity<Kilogram, int> mass {7};
+            const auto [end, error] = from_chars(text.data(), text.data() + text.size(), mass);
+            REQUIRE(error == std::errc::result_out_of_range);
+            REQUIRE(end == text.data() + text.size());
+            REQUIRE(mass.amount == 7);
+        }
+        THEN("the numbers too long to be copied on the stack are rejected") {
+            REQUIRE_THROWS_AS(parse_quantity<Meter>(std::string(64, '1') + " m"), std::invalid_argument);
+            REQUIRE(parse_quantity<Meter>(std::string(63, '0') + " m").amount == 0);
+        }
+    }
+
+    WHEN("we stream a whole buffer of records") {
+        constexpr std::string_view log = "1 m/s\n2 m/s, 36 km/h;\r\n\n4 m*s-2\n5 m/s";
+        std::vector<double> speeds;
+        const auto [end, error] = parse_quantities<MetersPerSecond>(log, [&speeds](quantity<MetersPerSecond> speed) {
+            speeds.push_back(speed.amount);
+        });
+        THEN("every record is passed to the sink until the first malformed one") {
+            REQUIRE(speeds == std::vector<double> {1., 2., 10.});
+            REQUIRE(error == std::errc::invalid_argument);
+            REQUIRE(std::string_view {end, 6} == "m*s-2\n");
+        }
+    }
+}
+
+SCENARIO("Scenario: when the units of the quantities are only known at runtime", "[dynamic_quantity<T>...]") {
+    const auto unit = units_registry::find("km*h-1");
+    REQUIRE(unit.has_value());
+
+    WHEN("we convert a dynamic quantity") {
+        const dynamic_quantity<> speed {36., *unit};
+        THEN("it becomes a static quantity of the same dimension") {
+            REQUIRE(speed.to<MetersPerSecond>().amount == 10);
+            REQUIRE(speed.to(units_registry::id_of<MetersPerSecond>).amount == 10);
+            REQUIRE(dynamic_quantity<int>::from(quantity<Day, int> {2}).to<Hour>().amount == 48);
+            REQUIRE_THROWS_AS(speed.to<Newton>(), std::invalid_argument);
+        }
+        THEN("the factors between the registered units are computed at compile time") {
+            STATIC_REQUIRE(units_registry::factor(units_registry::id_of<Day>, units_registry::id_of<Hour>) == 24);
+            STATIC_REQUIRE(!units_registry::convertible(units_registry::id_of<Joule>, units_registry::id_of<Watt>));
+        }
+    }
+
+    WHEN("we convert a whole column of amounts") {
+        const std::vector<double> column {36., 72.};
+        std::vector<quantity<MetersPerSecond>> speeds(column.size());
+        units_registry::convert(*unit, std::span {column}, std::span {speeds});
+        THEN("the unit is resolved once for every amount") {
+            REQUIRE(speeds[0].amount == 10);
+            REQUIRE(speeds[1].amount == 20);
+        }
+    }
+
+    WHEN("the amounts are integral or fixed-point numbers") {
+        using grams = zero::math::fixed<std::int64_t, zero::math::Rational<1, 1000>>;
+        const std::vector<long> minutes {90, 1'000'000'000'000'001};
+        std::vector<quantity<Second, long>> seconds(minutes.size());
+        units_registry::convert(units_registry::id_of<Minute>, std::span {minutes}, std::span {seconds});
+        THEN("they're converted with the exact fraction between the units, like the static conversions") {
+            STATIC_REQUIRE(units_registry::exact(units_registry::id_of<KilometersPerHour>, units_registry::id_of<MetersPerSecond>).num == 5);
+            STATIC_REQUIRE(units_registry::exact(units_registry::id_of<KilometersPerHour>, units_registry::id_of<MetersPerSecond>).den == 18);
+            REQUIRE(seconds[1].amount == 60'000'000'000'000'060);
+            REQUIRE(dynamic_quantity<long> {37, *unit}.to<MetersPerSecond>().amount == 10);
+            REQUIRE(dynamic_quantity<long> {1'000'000'000'000'000'001, units_registry::id_of<Hectogram>}
+                .to(units_registry::id_of<Kilogram>).amount == 100'000'000'000'000'000);
+            REQUIRE(basic_dynamic_quantity<units_registry, grams> {grams(2.5), units_registry::id_of<Kilogram>}
+                .to<Hectogram>().amount.raw == 25'000);
         }
     }
 }
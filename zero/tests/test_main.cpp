@@ -8,10 +8,22 @@ import std;
 
 
 #include "./math/matrix_tests.h"
+#include "./math/big_int_tests.h"
+#include "./math/rational_tests.h"
+#include "./math/fixed_tests.h"
+#include "./math/statistics_tests.h"
+#include "./math/random_tests.h"
+#include "./math/fft_tests.h"
 //TEST_CASE( "Base tests entry point for The Zero Project", "[Zero Project]" ) {}
 
 int main() {
     matrix_tests();
+    big_int_tests();
+    rational_tests();
+    fixed_tests();
+    statistics_tests();
+    random_tests();
+    fft_tests();
     RUN_TESTS();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+/**
+ * @brief Tests for the `fixed_string` module
+ */
+
+import std;
+import fixed_string;
+
+#include "../deps/catch.hpp"
+
+using zero::fixed_string;
+
+namespace {
+    template <fixed_string Label>
+    struct labelled {
+        static constexpr std::string_view label = Label;
+    };
+}
+
+TEST_CASE("Fixed strings built at compile time", "[fixed_string]") {
+    constexpr fixed_string kg {"kg"};
+
+    SECTION("The size is part of the type, and deduced from the literals") {
+        STATIC_REQUIRE( std::is_same_v<decltype(kg), const fixed_string<2>> );
+        STATIC_REQUIRE( kg.size() == 2 );
+        STATIC_REQUIRE( fixed_string<0> {}.empty() );
+        CHECK( std::string_view {kg.c_str()} == "kg" );
+    }
+
+    SECTION("Concatenation") {
+        constexpr auto newton = kg + "*m*s-2";
+        STATIC_REQUIRE( newton == "kg*m*s-2" );
+        STATIC_REQUIRE( std::is_same_v<decltype(newton), const fixed_string<8>> );
+        STATIC_REQUIRE( "[" + kg + "]" == std::string_view {"[kg]"} );
+        STATIC_REQUIRE( kg + fixed_string {"/s"} == "kg/s" );
+    }
+
+    SECTION("Slicing") {
+        constexpr fixed_string symbol {"kg*m*s-2"};
+        STATIC_REQUIRE( symbol.substr<3>() == "m*s-2" );
+        STATIC_REQUIRE( symbol.substr<3, 1>() == "m" );
+        STATIC_REQUIRE( symbol.substr<8>().empty() );
+        STATIC_REQUIRE( symbol.first<2>() == kg );
+        STATIC_REQUIRE( symbol.last<2>() == "-2" );
+    }
+
+    SECTION("Comparison with fixed strings of any size and with views") {
+        STATIC_REQUIRE( kg == fixed_string {"kg"} );
+        STATIC_REQUIRE( kg != fixed_string {"kgs"} );
+        STATIC_REQUIRE( kg < fixed_string {"m"} );
+        STATIC_REQUIRE( std::string_view {"kg"} == kg );
+        STATIC_REQUIRE( (kg <=> std::string_view {"g"}) == std::strong_ordering::greater );
+    }
+
+    SECTION("Building from a view checks its size") {
+        STATIC_REQUIRE( fixed_string<2> {std::string_view {"km"}} == "km" );
+        CHECK_THROWS_AS( fixed_string<2> {std::string_view {"kmh"}}, std::length_error );
+    }
+
+    SECTION("Fixed strings are template arguments") {
+        STATIC_REQUIRE( labelled<"speed">::label == "speed" );
+        STATIC_REQUIRE( std::is_same_v<labelled<"kg">, labelled<kg>> );
+        STATIC_REQUIRE( zero::text_v<kg + "2"> == "kg2" );
+        CHECK( zero::text_v<kg>.data() == zero::text_v<fixed_string {"kg"}>.data() );
+    }
+}
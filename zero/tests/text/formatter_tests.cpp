@@ -0,0 +1,122 @@
+/**
+ * @brief Tests for the `formatter` module
+ */
+
+import std;
+import formatter;
+
+#include "../deps/catch.hpp"
+
+using namespace zero::fmt;
+
+TEST_CASE("Formatting with patterns checked at compile time", "[formatter]") {
+    SECTION("The arguments are written into the replacement fields in order") {
+        CHECK( formatter("[WARNING] {} is deprecated. Please use {} instead.", "methodA", std::string("methodB"))
+            == "[WARNING] methodA is deprecated. Please use methodB instead." );
+        CHECK( formatter("x = {}, y = {}, c = {}", 10, 2.5, 'c') == "x = 10, y = 2.5, c = c" );
+        CHECK( formatter("No fields") == "No fields" );
+    }
+
+    SECTION("Unmatched braces are literals, and a backslash escapes the next character") {
+        CHECK( formatter("x = {10, y = 20, z = {}}", 10) == "x = {10, y = 20, z = 10}" );
+        CHECK( formatter("\\{} is written as is, {} isn't", 1) == "{} is written as is, 1 isn't" );
+    }
+
+    SECTION("The pattern is split into its literals at compile time") {
+        constexpr format_string<int, int> pattern = "x = {}, y = {}";
+        STATIC_REQUIRE( pattern.literal(0) == "x = " );
+        STATIC_REQUIRE( pattern.literal(1) == ", y = " );
+        STATIC_REQUIRE( pattern.literal(2).empty() );
+    }
+}
+
+TEST_CASE("Formatting with patterns only known at runtime", "[formatter]") {
+    const std::string pattern = "{} + {}";
+    CHECK( formatter(runtime_format(pattern), 1, 2) == "1 + 2" );
+    CHECK_THROWS_AS( formatter(runtime_format(pattern), 1), std::runtime_error );
+    CHECK_THROWS_AS( formatter(runtime_format(pattern), 1, 2, 3), std::runtime_error );
+}
+
+TEST_CASE("Formatting into caller provided outputs", "[formatter]") {
+    SECTION("format_to writes into buffers and containers, and returns the end of the written text") {
+        std::array<char, 32> buffer {};
+        const char* end = format_to(buffer.data(), "x = {}, y = {}", 42, -0.5);
+        CHECK( std::string_view(buffer.data(), end) == "x = 42, y = -0.5" );
+
+        std::string text = "> ";
+        format_to(std::back_inserter(text), "{} {}", "appended", true);
+        CHECK( text == "> appended true" );
+
+        std::vector<char> chars;
+        format_to(std::back_inserter(chars), "\\{}{}", 'c');
+        CHECK( std::string_view(chars.data(), chars.size()) == "{}c" );
+    }
+
+    SECTION("formatted_size measures the text exactly") {
+        CHECK( formatted_size("x = {}, y = {}", 42, -0.5) == 16 );
+        CHECK( formatted_size("\\{}{}", 'c') == 3 );
+        CHECK( formatted_size("No fields") == 9 );
+    }
+
+    SECTION("format_to_n truncates the text, but reports its whole size") {
+        std::array<char, 8> buffer {};
+        const auto result = format_to_n(buffer.data(), 5, "value: {}", 12345);
+        CHECK( std::string_view(buffer.data(), result.out) == "value" );
+        CHECK( result.size == 12 );
+    }
+}
+
+TEST_CASE("Format specifications", "[formatter]") {
+    SECTION("Numbered fields select their argument, and can repeat it") {
+        CHECK( formatter("{1} {0} {1}", "a", "b") == "b a b" );
+    }
+
+    SECTION("Width, fill and alignment") {
+        CHECK( formatter("{:>6}|{:<6}|{:^6}|{:*^7}", 42, 42, "mid", "mid") == "    42|42    | mid  |**mid**" );
+        CHECK( formatter("{:6}|{:6}", 42, "left") == "    42|left  " );
+    }
+
+    SECTION("The width is measured in terminal columns") {
+        CHECK( formatter("[{:<6}|{:>4}|{:^5}]", "日本", "π=3", "∭") == "[日本  | π=3|  ∭  ]" );
+    }
+
+    SECTION("Signs, bases and zero padding") {
+        CHECK( formatter("{:+}|{: }|{:#x}|{:#X}|{:#b}|{:o}", 5, 7, 255, 255, 5, 8) == "+5| 7|0xff|0XFF|0b101|10" );
+        CHECK( formatter("{:#010x}|{:06}|{:c}|{:d}", 255, -42, 65, 'A') == "0x000000ff|-00042|A|65" );
+    }
+
+    SECTION("Floating point numbers are written in their shortest round-trip representation by default") {
+        CHECK( formatter("{}|{}|{}", 0.1, 1.0 / 3.0, 1e300) == "0.1|0.3333333333333333|1e+300" );
+        CHECK( formatter("{:.2f}|{:e}|{:.2E}|{:g}|{:.3}", 3.14159, 12345.678, 12345.678, 0.0001, 3.14159)
+            == "3.14|1.234568e+04|1.23E+04|0.0001|3.14" );
+        CHECK( formatter("{:08.3f}", -3.14159) == "-003.142" );
+    }
+
+    SECTION("The precision of a string truncates it") {
+        CHECK( formatter("{:.3}", "truncated") == "tru" );
+        CHECK( formatter("{:.3}|{:.3}", "héllo", "日本語") == "hél|日" );
+    }
+
+    SECTION("Invalid specifications of the patterns known at runtime throw") {
+        CHECK_THROWS_AS( formatter(runtime_format("{:.2}"), 1), format_error );
+        CHECK_THROWS_AS( formatter(runtime_format("{}{1}"), 1, 2), format_error );
+        CHECK_THROWS_AS( formatter(runtime_format("{:x}"), "text"), format_error );
+    }
+
+    SECTION("The widths and the precisions are bounded") {
+        CHECK( formatter("{:65535}", 1).size() == 65535 );
+        CHECK_THROWS_AS( formatter(runtime_format("{:65536}"), 1), format_error );
+        CHECK_THROWS_AS( formatter(runtime_format("{:.99999999999999999999f}"), 1.0), format_error );
+        CHECK_THROWS_AS( formatter(runtime_format("{:184467440737095516170}"), 1), format_error );
+    }
+
+    SECTION("The size of the result is reserved exactly, with the padding and the repeated fields") {
+        const format_string<int, double> pattern = "{0:>8}|{0:<8}|{1:.2f}|{1}";
+        std::size_t reserved = 0;
+        std::string result;
+        pattern.format_reserved([&](std::size_t size) { reserved = size; }, [&](std::string_view text) { result += text; }, 42, 3.14159);
+        CHECK( result == "      42|42      |3.14|3.14159" );
+        CHECK( reserved == result.size() );
+        CHECK( formatter(pattern, 42, 3.14159) == result );
+    }
+}
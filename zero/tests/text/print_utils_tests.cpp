@@ -0,0 +1,80 @@
+/**
+ * @brief Tests for the `print_utils` module
+ */
+
+import std;
+import formatter;
+import print_utils;
+
+#include <stdio.h>
+#include "../deps/catch.hpp"
+
+using namespace zero::fmt;
+
+namespace {
+    std::string read_all(std::FILE* file) {
+        std::rewind(file);
+        std::string contents;
+        std::array<char, 256> chunk;
+        while (const auto read = std::fread(chunk.data(), 1, chunk.size(), file))
+            contents.append(chunk.data(), read);
+        return contents;
+    }
+}
+
+TEST_CASE("A Writer batches the text in its buffer", "[print_utils]") {
+    std::FILE* file = std::tmpfile();
+    REQUIRE( file != nullptr );
+
+    {
+        Writer writer {fileno(file), 16};
+        writer.line_buffered(false);
+
+        SECTION("The text is kept in the buffer until it's full or flushed") {
+            writer.print("{} + {}", 1, 2);
+            writer.println(" = {}", 3);
+            CHECK( writer.size() == 10 );
+            CHECK( read_all(file).empty() );
+
+            writer.write("a whole record"); // Doesn't fit, so the previous records are written
+            CHECK( writer.size() == 14 );
+            CHECK( read_all(file) == "1 + 2 = 3\n" );
+
+            writer.flush();
+            CHECK( writer.size() == 0 );
+            CHECK( read_all(file) == "1 + 2 = 3\na whole record" );
+        }
+
+        SECTION("The records bigger than the buffer are written as they come") {
+            writer.write("ab");
+            writer.write("a record longer than the buffer");
+            CHECK( writer.size() == 0 );
+            CHECK( read_all(file) == "aba record longer than the buffer" );
+        }
+
+        SECTION("A line buffered writer flushes every line") {
+            writer.line_buffered(true);
+            writer.println("{:>4}", 42);
+            CHECK( writer.size() == 0 );
+            CHECK( read_all(file) == "  42\n" );
+
+            writer.print("no line, ");
+            CHECK( writer.size() == 9 );
+            writer.print("{}\n", "a line");
+            writer.write("end\n");
+            CHECK( writer.size() == 0 );
+            CHECK( read_all(file) == "  42\nno line, a line\nend\n" );
+        }
+
+        SECTION("A record that can't be formatted is discarded") {
+            writer.print("{} ", "kept");
+            CHECK_THROWS_AS( writer.print(runtime_format("{} {:x}"), 1, "text"), format_error );
+            CHECK_THROWS_AS( writer.println(runtime_format("{} {}"), 1), format_error );
+            CHECK( writer.size() == 5 );
+            writer.flush();
+            CHECK( read_all(file) == "kept " );
+        }
+    }
+
+    std::fclose(file);
+}
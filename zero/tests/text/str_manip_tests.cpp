@@ -0,0 +1,129 @@
+/**
+ * @brief Tests for the `str_manip` module
+ */
+
+import std;
+import str_manip;
+
+#include "../deps/catch.hpp"
+
+namespace {
+    std::vector<std::string_view> tokens(zero::split_view view) {
+        return {view.begin(), std::ranges::next(view.begin(), view.end())};
+    }
+}
+
+TEST_CASE("Splitting text lazily into views of its tokens", "[str_manip]") {
+    using tokens_t = std::vector<std::string_view>;
+
+    SECTION("Consecutive and trailing delimiters yield empty tokens") {
+        CHECK( tokens(zero::split("a,b,,c,", ',')) == tokens_t {"a", "b", "", "c", ""} );
+        CHECK( tokens(zero::split("", ',')).empty() );
+        CHECK( tokens(zero::split("no delimiter", ',')) == tokens_t {"no delimiter"} );
+    }
+
+    SECTION("The delimiters can have many characters") {
+        CHECK( tokens(zero::split("one<->two<->three", "<->")) == tokens_t {"one", "two", "three"} );
+        CHECK( tokens(zero::split("aaab", "ab")) == tokens_t {"aa", ""} );
+    }
+
+    SECTION("The tokens are slices of the original text") {
+        const std::string text = "key=value";
+        const auto first = *zero::split(text, '=').begin();
+        CHECK( first.data() == text.data() );
+    }
+
+    SECTION("The view can be used at compile time") {
+        constexpr auto count = std::ranges::distance(zero::split("zero::physics::kg", "::"));
+        STATIC_REQUIRE( count == 3 );
+    }
+
+    SECTION("split_str copies the tokens, splitting by the whole delimiter") {
+        CHECK( zero::split_str(std::string("x, y, z"), ", ") == std::vector<std::string> {"x", "y", "z"} );
+    }
+}
+
+TEST_CASE("Searching text", "[str_manip]") {
+    constexpr auto npos = std::string_view::npos;
+
+    SECTION("find and rfind agree with the standard library") {
+        const std::string text = "the quick brown fox jumps over the lazy dog, the end";
+        const std::string_view view = text;
+        for (const std::string_view needle : {"the", "t", "dog, ", "end", "the end", "", "cat", "g"})
+            for (std::size_t from = 0; from <= text.size() + 1; ++from) {
+                CHECK( zero::find(text, needle, from) == view.find(needle, from) );
+                CHECK( zero::rfind(text, needle, from) == view.rfind(needle, from) );
+            }
+        CHECK( zero::rfind(text, "the") == 45 );
+        CHECK( zero::find(text, 'q') == 4 );
+        CHECK( zero::rfind(text, 'q') == 4 );
+    }
+
+    SECTION("The candidates that only match the first and the last characters are rejected") {
+        const std::string text = std::string(100, 'a') + "abca" + std::string(20, 'a') + "abba";
+        CHECK( zero::find(text, "abba") == 124 );
+        CHECK( zero::rfind(text, "abca") == 100 );
+        CHECK_FALSE( zero::contains(text, "acca") );
+        CHECK( zero::contains(text, 'c') );
+    }
+
+    SECTION("The periodic needles and texts, that defeat the filter, are searched in linear time") {
+        const std::string needle = std::string(50, 'a') + "b" + std::string(50, 'a');
+        const std::string text = std::string(100'000, 'a') + needle + std::string(100'000, 'a');
+        CHECK( zero::find(text, needle) == 100'000 );
+        CHECK( zero::rfind(text, needle) == 100'000 );
+        CHECK( zero::find(text, needle, 100'001) == npos );
+        CHECK( zero::rfind(text, needle, 99'999) == npos );
+
+        std::minstd_rand random {7};
+        const auto periodic = [&](std::size_t size) {
+            std::string letters(size, 'a');
+            for (auto& letter : letters)
+                letter = random() % 8 == 0 ? 'b' : 'a';
+            return letters;
+        };
+        std::size_t mismatches = 0;
+        for (int round = 0; round < 500; ++round) {
+            const std::string haystack = periodic(4000);
+            const std::size_t size = 20 + random() % 60;
+            // Half of the needles are taken from the text, so they're found
+            const std::string pattern = round % 2 == 0 ? periodic(size) : haystack.substr(random() % (4000 - size), size);
+            const std::size_t from = random() % 4000;
+            const std::string_view view = haystack;
+            mismatches += zero::find(haystack, pattern, from) != view.find(pattern, from);
+            mismatches += zero::rfind(haystack, pattern, from) != view.rfind(pattern, from);
+        }
+        CHECK( mismatches == 0 );
+    }
+
+    SECTION("find_first_of with small and big sets of characters") {
+        const std::string text = "path/to/some_file-name.tar.gz";
+        CHECK( zero::find_first_of(text, "./") == 4 );
+        CHECK( zero::find_first_of(text, "./", 8) == 22 );
+        CHECK( zero::find_first_of(text, "-_.,;:!?") == 12 );
+        CHECK( zero::find_first_of(text, "xyz") == 28 );
+        CHECK( zero::find_first_of(text, "#") == npos );
+        CHECK( zero::find_first_of(text, "") == npos );
+
+        constexpr zero::char_class separators {" \t,;"};
+        CHECK( zero::find_first_of("a,b c", separators) == 1 );
+        CHECK( zero::find_first_of("a,b c", separators, 2) == 3 );
+        CHECK( zero::find_first_of("abc", separators) == npos );
+    }
+
+    SECTION("count counts the non overlapping occurrences") {
+        const std::string text = std::string(37, 'x') + "," + std::string(20, 'x') + ",";
+        CHECK( zero::count(text, ',') == 2 );
+        CHECK( zero::count(text, 'x') == 57 );
+        CHECK( zero::count("aaaaa", "aa") == 2 );
+        CHECK( zero::count("a::b::c", "::") == 2 );
+        CHECK( zero::count("abc", "") == 0 );
+    }
+
+    SECTION("The searches can be used at compile time") {
+        STATIC_REQUIRE( zero::find("zero::physics", "::") == 4 );
+        STATIC_REQUIRE( zero::rfind("a.b.c", '.') == 3 );
+        STATIC_REQUIRE( zero::find_first_of("key: value", " :") == 3 );
+        STATIC_REQUIRE( zero::count("1,2,3", ',') == 2 );
+    }
+}
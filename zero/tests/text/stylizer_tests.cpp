@@ -0,0 +1,29 @@
+/**
+ * @brief Tests for the `stylizer` module
+ */
+
+import std;
+import stylizer;
+
+#include "../deps/catch.hpp"
+
+using namespace zero::fmt;
+
+TEST_CASE("Stylizing text with precomputed escape sequences", "[stylizer]") {
+    SECTION("The color and all the modifiers are written in a single sequence, with a single reset") {
+        CHECK( stylize("text", Color::YELLOW, {Modifier::BOLD}) == "\033[1;38;5;226mtext\033[0m" );
+        CHECK( stylize("text", Color::RED, Modifier::BOLD | Modifier::UNDERLINE) == "\033[1;4;38;5;196mtext\033[0m" );
+        CHECK( stylize("text", Color::DEFAULT, {Modifier::ITALIC, Modifier::HIDDEN}) == "\033[3;8mtext\033[0m" );
+        CHECK( stylize("text", Color::GREY) == "\033[38;5;244mtext\033[0m" );
+    }
+
+    SECTION("A text without style is left untouched") {
+        CHECK( stylize("text", Color::DEFAULT) == "text" );
+    }
+
+    SECTION("stylize_to appends to an existing string") {
+        std::string out = "> ";
+        stylize_to(out, "text", Color::CYAN, Modifier::FAINT);
+        CHECK( out == "> \033[2;38;5;51mtext\033[0m" );
+    }
+}
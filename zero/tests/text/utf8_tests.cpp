@@ -0,0 +1,93 @@
+/**
+ * @brief Tests for the `utf8` module
+ */
+
+import std;
+import utf8;
+
+#include "../deps/catch.hpp"
+
+using namespace zero::utf8;
+
+TEST_CASE("Encoding and decoding UTF-8", "[utf8]") {
+    SECTION("Every scalar value is encoded and decoded back") {
+        std::size_t mismatches = 0;
+        for (char32_t code_point = 0; code_point <= max_code_point; ++code_point) {
+            if (code_point >= 0xD800 && code_point <= 0xDFFF)
+                continue;
+            const encoded units = encode(code_point);
+            const decoded back = decode(units.view());
+            mismatches += !back.valid || back.code_point != code_point || back.size != units.size;
+        }
+        CHECK( mismatches == 0 );
+    }
+
+    SECTION("The surrogates and the numbers above U+10FFFF are encoded as the replacement character") {
+        CHECK( encode(0xD800).view() == "�" );
+        CHECK( encode(0x110000).view() == "�" );
+    }
+
+    SECTION("Texts are encoded and decoded whole") {
+        CHECK( encode(U"x ∈ ℝ, 😀") == "x ∈ ℝ, 😀" );
+        CHECK( decode_all("x ∈ ℝ, 😀") == U"x ∈ ℝ, 😀" );
+    }
+
+    SECTION("Every maximal subpart of an invalid sequence is a replacement character") {
+        CHECK( decode_all("a\xF0\x9F\x98z") == U"a�z" );
+        CHECK( decode_all("\xC0\xAF") == U"��" );
+        CHECK( decode_all("\xED\xA0\x80") == U"���" );
+        CHECK( decode_all("\xE2\x88") == U"�" );
+    }
+
+    SECTION("The code points can be encoded at compile time") {
+        STATIC_REQUIRE( encode(U'∭').view() == "∭" );
+        STATIC_REQUIRE( decode("€").code_point == U'€' );
+    }
+}
+
+TEST_CASE("Validating UTF-8", "[utf8]") {
+    const std::string ascii(100, 'a');
+
+    CHECK( is_valid("") );
+    CHECK( is_valid(ascii + "ñ∑😀" + ascii) );
+    CHECK( find_invalid(ascii + "\xFF" + ascii) == 100 );
+    CHECK( find_invalid(ascii + "\xE0\x80\x80") == 100 ); // Overlong
+    CHECK( find_invalid("\xF4\x90\x80\x80") == 0 );       // Above U+10FFFF
+    CHECK( find_invalid(ascii + "€\xE2\x82") == 103 );    // Truncated
+    CHECK( find_invalid("\x80") == 0 );                   // A lone continuation byte
+    STATIC_REQUIRE( !is_valid("\xC0\xAF") );
+}
+
+TEST_CASE("Measuring UTF-8 text", "[utf8]") {
+    SECTION("length counts the code points") {
+        CHECK( length("") == 0 );
+        CHECK( length("∫∫ f(x, y) dx dy") == 16 );
+        STATIC_REQUIRE( length("héllo") == 5 );
+    }
+
+    SECTION("The wide characters take two columns, and the combining marks none") {
+        CHECK( width(U'a') == 1 );
+        CHECK( width(U'∭') == 1 );
+        CHECK( width(U'日') == 2 );
+        CHECK( width(U'😀') == 2 );
+        CHECK( width(0x0301) == 0 );
+        CHECK( display_width("été") == 3 );
+        CHECK( display_width("日本語 text") == 11 );
+        CHECK( display_width("\xFF") == 1 );
+    }
+
+    SECTION("Texts are truncated to a number of columns without cutting their characters") {
+        CHECK( truncate_to_width("日本語", 5) == "日本" );
+        CHECK( truncate_to_width("éé", 1) == "é" );
+        CHECK( truncate_to_width("abc", 10) == "abc" );
+        CHECK( truncate_to_width("abc", 0).empty() );
+    }
+
+    SECTION("The code points can be iterated lazily") {
+        std::u32string code_points_seen;
+        for (const char32_t code_point : code_points("π ≈ 3"))
+            code_points_seen += code_point;
+        CHECK( code_points_seen == U"π ≈ 3" );
+        CHECK( std::ranges::next(code_points("a∑b").begin(), 2).position() == 4 );
+    }
+}